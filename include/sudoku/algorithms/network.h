@@ -0,0 +1,132 @@
+/**
+ * @file network.h
+ * @brief Constraint network (CSP view of a Sudoku board)
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * Each cell is a CSP variable with a domain of still-possible values;
+ * two cells are neighbours when they share a row, column or subgrid.
+ * This is the data structure the AC-3 propagator and the MRV heuristic
+ * of the v3.0 AC3HB path work on.
+ *
+ * MEMORY:
+ * A network is ONE contiguous block (struct, domains and the neighbour
+ * table), created either with malloc() or inside a SudokuArena. Every
+ * cell has the same number of neighbours, 2(n-1) + (k-1)², so the
+ * neighbour table is a flat array with a fixed stride.
+ *
+ * LIMITATIONS:
+ * - Domains are 32-bit masks: boards up to 32×32 (subgrid_size ≤ 5)
+ */
+
+#ifndef SUDOKU_ALGORITHMS_NETWORK_H
+#define SUDOKU_ALGORITHMS_NETWORK_H
+
+#include <sudoku/core/types.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/** @brief Largest board_size a network can represent */
+#define NETWORK_MAX_BOARD_SIZE 32
+
+/**
+ * @brief Set of possible values of one cell
+ *
+ * Bit v-1 is set when value v is still possible.
+ */
+typedef struct {
+    uint32_t bits;      ///< Bitmask of possible values
+    int count;          ///< Number of bits set (cached popcount)
+} Domain;
+
+/** @brief Opaque constraint network */
+typedef struct ConstraintNetwork ConstraintNetwork;
+
+// ═══════════════════════════════════════════════════════════════════
+//                    CREATION AND DESTRUCTION
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Build the network for a board
+ *
+ * Givens get singleton domains; empty cells start with every value not
+ * already used by a filled neighbour.
+ *
+ * @param[in] board Board to model
+ * @return New network, or NULL on NULL board, board larger than
+ *         NETWORK_MAX_BOARD_SIZE or allocation failure
+ *
+ * @note Caller must free with constraint_network_destroy()
+ */
+ConstraintNetwork* constraint_network_create(const SudokuBoard *board);
+
+/**
+ * @brief Build the network inside an arena
+ *
+ * Same as constraint_network_create(), but the block comes from the
+ * arena and is reclaimed by sudoku_arena_reset(); calling
+ * constraint_network_destroy() on it is a no-op.
+ */
+ConstraintNetwork* constraint_network_create_in_arena(SudokuArena *arena,
+                                                      const SudokuBoard *board);
+
+/**
+ * @brief Destroy a network (NULL and arena networks are ignored)
+ */
+void constraint_network_destroy(ConstraintNetwork *net);
+
+// ═══════════════════════════════════════════════════════════════════
+//                    DOMAIN QUERIES
+// ═══════════════════════════════════════════════════════════════════
+
+Domain constraint_network_get_domain(const ConstraintNetwork *net, int row, int col);
+bool constraint_network_has_value(const ConstraintNetwork *net, int row, int col, int value);
+int constraint_network_domain_size(const ConstraintNetwork *net, int row, int col);
+bool constraint_network_domain_empty(const ConstraintNetwork *net, int row, int col);
+
+// ═══════════════════════════════════════════════════════════════════
+//                    DOMAIN MODIFICATIONS
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Remove a value from a cell's domain
+ * @return true if the value was present
+ */
+bool constraint_network_remove_value(ConstraintNetwork *net, int row, int col, int value);
+
+/**
+ * @brief Reduce a cell's domain to a single value
+ */
+void constraint_network_assign_value(ConstraintNetwork *net, int row, int col, int value);
+
+/**
+ * @brief Reset a cell's domain to every value (used when backtracking)
+ */
+void constraint_network_restore_domain(ConstraintNetwork *net, int row, int col);
+
+// ═══════════════════════════════════════════════════════════════════
+//                    NETWORK QUERIES
+// ═══════════════════════════════════════════════════════════════════
+
+int constraint_network_get_board_size(const ConstraintNetwork *net);
+
+/**
+ * @brief Cells sharing a constraint with (row, col)
+ *
+ * @param[out] count Number of neighbours (2(n-1) + (k-1)² for every cell)
+ * @return Read-only array owned by the network
+ */
+const SudokuPosition* constraint_network_get_neighbors(const ConstraintNetwork *net,
+                                                       int row, int col, int *count);
+
+/**
+ * @brief Sum of all domain sizes (search-space indicator)
+ */
+int constraint_network_total_possibilities(const ConstraintNetwork *net);
+
+/**
+ * @brief Print every domain to stdout (debugging)
+ */
+void constraint_network_print(const ConstraintNetwork *net);
+
+#endif // SUDOKU_ALGORITHMS_NETWORK_H
@@ -0,0 +1,158 @@
+/**
+ * @file arena.h
+ * @brief Region (arena) allocator for per-puzzle data
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * Generating one puzzle used to call malloc/free dozens of times: the
+ * board rows, the subgrid index list, the Phase 3 position list, one
+ * candidate array per backtracking node... In batch generation the
+ * allocator became a measurable share of the run time and the data for
+ * a single puzzle ended up scattered across the heap.
+ *
+ * An arena hands out memory by bumping an offset inside large blocks.
+ * Nothing is freed individually: the owner either rewinds to a mark
+ * (LIFO scratch use) or resets the whole arena between puzzles. After
+ * the first puzzle has grown the arena to its working size, generating
+ * the next one performs no allocator calls at all.
+ *
+ * OWNERSHIP MODEL:
+ * - A generation context or batch worker creates one arena and resets
+ *   it between puzzles (see SudokuGenerationConfig.arena)
+ * - Without an explicit arena, the library uses a lazily created
+ *   per-thread scratch arena for its internal buffers
+ * - An arena is NOT thread-safe: use one per thread
+ *
+ * Example (batch worker):
+ * @code
+ * SudokuArena *arena = sudoku_arena_create(0);
+ * SudokuGenerationConfig config = { .arena = arena };
+ *
+ * for (int i = 0; i < count; i++) {
+ *     SudokuBoard *board = sudoku_board_create_in_arena(arena, 3);
+ *     sudoku_generate_ex(board, &config, NULL);
+ *     save_puzzle(board);
+ *     sudoku_arena_reset(arena);      // board memory reclaimed here
+ * }
+ * sudoku_arena_destroy(arena);
+ * @endcode
+ */
+
+#ifndef SUDOKU_CORE_ARENA_H
+#define SUDOKU_CORE_ARENA_H
+
+#include <sudoku/core/types.h>
+#include <stddef.h>
+
+/**
+ * @brief Saved allocation point, used to rewind scratch allocations
+ *
+ * Obtained with sudoku_arena_mark() and consumed by
+ * sudoku_arena_release(). Marks must be released in LIFO order.
+ */
+typedef struct {
+    void *block;        ///< Block that was current when the mark was taken
+    size_t offset;      ///< Bytes used in that block at that moment
+} SudokuArenaMark;
+
+// ═══════════════════════════════════════════════════════════════════
+//                    LIFECYCLE
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Create an arena
+ *
+ * @param initial_capacity Size of the first block in bytes; 0 selects
+ *        a default (64 KiB) that fits a full 25×25 generation
+ * @return New arena, or NULL if allocation failed
+ *
+ * @note Caller MUST call sudoku_arena_destroy() when done
+ */
+SudokuArena* sudoku_arena_create(size_t initial_capacity);
+
+/**
+ * @brief Destroy an arena and every object allocated from it
+ *
+ * @param arena Arena to destroy (NULL is ignored)
+ *
+ * @warning Boards and networks created in the arena become invalid
+ */
+void sudoku_arena_destroy(SudokuArena *arena);
+
+/**
+ * @brief Discard every allocation, keeping the memory for reuse
+ *
+ * If the arena had to grow into several blocks, they are coalesced
+ * into one block of the combined size, so the next puzzle of the same
+ * shape is served from a single contiguous region without growing.
+ *
+ * @param arena Arena to reset (NULL is ignored)
+ */
+void sudoku_arena_reset(SudokuArena *arena);
+
+// ═══════════════════════════════════════════════════════════════════
+//                    ALLOCATION
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Allocate uninitialised memory from the arena
+ *
+ * @param arena Arena to allocate from
+ * @param size Bytes requested
+ * @return Pointer aligned for any fundamental type, or NULL if the
+ *         arena needed to grow and malloc failed
+ *
+ * @note Time complexity: O(1) except when a new block is needed
+ */
+void* sudoku_arena_alloc(SudokuArena *arena, size_t size);
+
+/**
+ * @brief Record the current allocation point
+ */
+SudokuArenaMark sudoku_arena_mark(const SudokuArena *arena);
+
+/**
+ * @brief Rewind the arena to a previously recorded mark
+ *
+ * Everything allocated after the mark is discarded. Used by the
+ * generator for scratch buffers that only live for one phase.
+ */
+void sudoku_arena_release(SudokuArena *arena, SudokuArenaMark mark);
+
+// ═══════════════════════════════════════════════════════════════════
+//                    STATISTICS
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Bytes currently handed out (including alignment padding)
+ */
+size_t sudoku_arena_used(const SudokuArena *arena);
+
+/**
+ * @brief Total bytes reserved from the system across all blocks
+ */
+size_t sudoku_arena_capacity(const SudokuArena *arena);
+
+/**
+ * @brief Number of blocks ever requested from malloc
+ *
+ * Stays constant once the arena has reached its working size, which
+ * is how tests verify that steady-state generation does not allocate.
+ */
+size_t sudoku_arena_system_allocs(const SudokuArena *arena);
+
+// ═══════════════════════════════════════════════════════════════════
+//                    PER-THREAD SCRATCH ARENA
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Free the calling thread's internal scratch memory
+ *
+ * The library creates the scratch arena (and, for 16×16 and larger
+ * solution counts, a 1 MiB transposition table) on first use and keeps
+ * them for the lifetime of the thread. Worker threads should call this
+ * before exiting; the main thread may skip it.
+ */
+void sudoku_arena_thread_cleanup(void);
+
+#endif // SUDOKU_CORE_ARENA_H
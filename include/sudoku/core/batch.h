@@ -0,0 +1,84 @@
+/**
+ * @file batch.h
+ * @brief Multi-puzzle solver over an interleaved puzzle batch
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * Verifying an imported puzzle pack means solving thousands of boards,
+ * and most of them fall to naked and hidden singles alone. The batch
+ * solver loads up to SUDOKU_BATCH_LANES puzzles of the same geometry
+ * side by side - one 16-bit candidate mask per cell and per puzzle,
+ * the masks of one cell for all puzzles adjacent in memory - and runs
+ * singles propagation on every lane at once. Built with AVX2
+ * (SUDOKU_ENABLE_AVX2) one instruction processes a cell of all 16
+ * puzzles; otherwise the same lane loops are left to the compiler.
+ *
+ * Lanes that propagation decides (solved, or contradiction) are done;
+ * lanes that stall ("diverge") are finished one by one by the
+ * grader's scalar search, starting from the singles already found.
+ *
+ * LIMITATIONS:
+ * - Lanes need boards up to 16×16 (16-bit masks); larger boards are
+ *   solved one at a time by the scalar search
+ * - Consecutive boards of the same geometry share a batch; mixing
+ *   sizes only makes the batches smaller
+ */
+
+#ifndef SUDOKU_CORE_BATCH_H
+#define SUDOKU_CORE_BATCH_H
+
+#include <sudoku/core/types.h>
+#include <stdbool.h>
+
+/** @brief Puzzles propagated together (one 256-bit vector of 16-bit masks) */
+#define SUDOKU_BATCH_LANES 16
+
+/**
+ * @brief How a batch was decided
+ */
+typedef struct {
+    int boards;             ///< Boards processed
+    int batches;            ///< Lane batches run (SIMD passes over the cells)
+    int by_propagation;     ///< Boards decided by lane-parallel singles alone
+    int by_search;          ///< Diverged (or too large) boards finished by search
+} SudokuBatchStats;
+
+/**
+ * @brief Count the solutions of many puzzles
+ *
+ * @param[in] boards Puzzles (not modified)
+ * @param[in] count Number of puzzles
+ * @param[in] limit Stop counting a puzzle at this many solutions (≥ 1)
+ * @param[out] solutions count entries: solutions found (≤ limit), or
+ *             -1 if the search gave up on a pathological puzzle
+ * @param[out] stats Optional breakdown (may be NULL)
+ * @return false on invalid arguments or allocation failure
+ *
+ * Example (verify a pack):
+ * @code
+ * int solutions[PACK_SIZE];
+ * sudoku_batch_count_solutions(pack, PACK_SIZE, 2, solutions, NULL);
+ * for (int i = 0; i < PACK_SIZE; i++) {
+ *     if (solutions[i] != 1) printf("puzzle %d is not unique\n", i);
+ * }
+ * @endcode
+ */
+bool sudoku_batch_count_solutions(const SudokuBoard *const *boards, int count, int limit,
+                                  int *solutions, SudokuBatchStats *stats);
+
+/**
+ * @brief Solve many puzzles in place
+ *
+ * Puzzles with exactly one solution are filled with it; the others are
+ * left untouched.
+ *
+ * @param[in,out] boards Puzzles
+ * @param[in] count Number of puzzles
+ * @param[out] solutions count entries: 0, 1, 2 (= two or more) or -1
+ * @param[out] stats Optional breakdown (may be NULL)
+ * @return false on invalid arguments or allocation failure
+ */
+bool sudoku_batch_solve(SudokuBoard *const *boards, int count,
+                        int *solutions, SudokuBatchStats *stats);
+
+#endif // SUDOKU_CORE_BATCH_H
@@ -13,6 +13,8 @@
 
 #include <sudoku/core/types.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #
 // ═══════════════════════════════════════════════════════════════════
 //                    MEMORY MANAGEMENT
@@ -82,6 +84,25 @@ SudokuBoard* sudoku_board_create_size(int subgrid_size);
  */
 SudokuBoard* sudoku_board_create(void);
 
+/**
+ * @brief Create a board inside a SudokuArena
+ *
+ * Same layout as sudoku_board_create_size() (one contiguous block),
+ * but carved out of the arena: no malloc() once the arena has grown
+ * to its working size. Intended for batch workers that reset the
+ * arena between puzzles.
+ *
+ * @param[in] arena Arena that owns the board's memory
+ * @param[in] subgrid_size Size of subgrids (valid: 2-10)
+ * @return Pointer to the new empty board, or NULL on error
+ *
+ * @note The board lives until sudoku_arena_reset() or
+ *       sudoku_arena_destroy(); sudoku_board_destroy() is a no-op
+ *
+ * @see sudoku/core/arena.h
+ */
+SudokuBoard* sudoku_board_create_in_arena(SudokuArena *arena, int subgrid_size);
+
 /**
  * @brief Destroy a Sudoku board and free its memory
  * 
@@ -108,6 +129,76 @@ SudokuBoard* sudoku_board_create(void);
  */
 void sudoku_board_destroy(SudokuBoard *board);
 
+// ═══════════════════════════════════════════════════════════════════
+//                    COPY, CLONE AND SNAPSHOT
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Create an independent heap copy of a board
+ * 
+ * Because a board is one contiguous block, cloning is one malloc plus
+ * one memcpy of the n² values.
+ * 
+ * @param[in] board Board to copy (heap or arena board)
+ * @return New heap board with the same cells and statistics, or NULL
+ *         on NULL input or allocation failure
+ * 
+ * @note Caller must free with sudoku_board_destroy()
+ * 
+ * Example:
+ * @code
+ * SudokuBoard *trial = sudoku_board_clone(board);
+ * // ... experiment on trial without touching board ...
+ * sudoku_board_destroy(trial);
+ * @endcode
+ */
+SudokuBoard* sudoku_board_clone(const SudokuBoard *board);
+
+/**
+ * @brief Copy cells and statistics into an existing board
+ * 
+ * @param[out] dst Target board (same subgrid_size as src)
+ * @param[in] src Source board
+ * @return false if either is NULL or the geometries differ
+ * 
+ * @note No allocation: safe in hot loops and batch pipelines
+ */
+bool sudoku_board_copy_into(SudokuBoard *dst, const SudokuBoard *src);
+
+/**
+ * @brief Bytes needed by sudoku_board_snapshot() for this board
+ * 
+ * (total_cells + 2) ints: the values followed by clues and empty.
+ */
+size_t sudoku_board_snapshot_size(const SudokuBoard *board);
+
+/**
+ * @brief Save the board state into a caller buffer
+ * 
+ * Lightweight alternative to cloning when the geometry is known: the
+ * caller owns the buffer (stack, arena...) and the copy is one memcpy.
+ * 
+ * @param[in] board Board to save
+ * @param[out] buffer At least sudoku_board_snapshot_size(board) bytes
+ * 
+ * Example:
+ * @code
+ * int *saved = malloc(sudoku_board_snapshot_size(board));
+ * sudoku_board_snapshot(board, saved);
+ * try_something(board);
+ * sudoku_board_restore(board, saved);   // back to the saved state
+ * @endcode
+ */
+void sudoku_board_snapshot(const SudokuBoard *board, int *buffer);
+
+/**
+ * @brief Restore a state saved with sudoku_board_snapshot()
+ * 
+ * @param[out] board Board to overwrite (same geometry as when saved)
+ * @param[in] buffer Snapshot buffer
+ */
+void sudoku_board_restore(SudokuBoard *board, const int *buffer);
+
 // ═══════════════════════════════════════════════════════════════════
 //                    BOARD INITIALIZATION
 // ═══════════════════════════════════════════════════════════════════
@@ -208,6 +299,7 @@ int sudoku_board_get_cell(const SudokuBoard *board, int row, int col);
  * @note Does NOT automatically update statistics - call
  *       sudoku_board_update_stats() if needed
  * @note Does NOT validate Sudoku rules - just sets the value
+ * @note Does update the state hash, in O(1) (sudoku_board_get_hash())
  * 
  * Example:
  * @code
@@ -218,6 +310,54 @@ int sudoku_board_get_cell(const SudokuBoard *board, int row, int col);
  */
 bool sudoku_board_set_cell(SudokuBoard *board, int row, int col, int value);
 
+// ═══════════════════════════════════════════════════════════════════
+//                    STATE HASH AND EQUALITY
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief 64-bit Zobrist hash of the board's cell values
+ * 
+ * Every board carries its hash: the XOR of one fixed random key per
+ * (cell, value) placed, over a per-geometry constant. Setting a cell
+ * updates it in O(1), so reading it never rescans the board. Use it to
+ * key caches and deduplication sets by board state.
+ * 
+ * @param[in] board Pointer to board
+ * @return Hash of the current cell values
+ * 
+ * @pre board != NULL
+ * 
+ * @note Equal cells (and geometry) always give equal hashes; equal
+ *       hashes almost always mean equal cells - confirm with
+ *       sudoku_board_equals() when a collision would matter
+ * @note Keys are fixed: hashes are stable across runs and processes
+ * @note Kept current by sudoku_board_set_cell() and every library
+ *       operation; internal code that writes cells directly resyncs it
+ *       with sudoku_board_update_stats(), like the clue counters
+ * 
+ * Example:
+ * @code
+ * uint64_t before = sudoku_board_get_hash(board);
+ * sudoku_board_set_cell(board, 0, 0, 5);
+ * sudoku_board_set_cell(board, 0, 0, 0);
+ * assert(sudoku_board_get_hash(board) == before);   // same state again
+ * @endcode
+ */
+uint64_t sudoku_board_get_hash(const SudokuBoard *board);
+
+/**
+ * @brief Test two boards for identical geometry and cell values
+ * 
+ * Compares the hashes first, so unequal boards are almost always
+ * rejected in O(1); only equal hashes are confirmed cell by cell.
+ * Statistics are not compared (they follow from the cells).
+ * 
+ * @param[in] a First board (may be NULL)
+ * @param[in] b Second board (may be NULL)
+ * @return true if both have the same size and cells (or both are NULL)
+ */
+bool sudoku_board_equals(const SudokuBoard *a, const SudokuBoard *b);
+
 // ═══════════════════════════════════════════════════════════════════
 //                    STATISTICS ACCESS
 // ═══════════════════════════════════════════════════════════════════
@@ -0,0 +1,123 @@
+/**
+ * @file cancel.h
+ * @brief Cancellation tokens and deadlines for generation and solving
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * Generation and solution counting can run for a long time on sparse
+ * or large boards. Services with per-request time budgets need a way
+ * to stop them that does not involve killing the thread.
+ *
+ * Two independent stop conditions exist:
+ * - A SudokuCancelToken: any thread may call sudoku_cancel_token_cancel()
+ *   and the operation using the token stops soon after
+ * - A deadline: an absolute time on the sudoku_clock_ns() clock
+ *
+ * Long searches check them every SUDOKU_INTERRUPT_INTERVAL nodes, so a
+ * check costs one counter decrement per node; loops whose iterations
+ * are already expensive (fill restarts, Phase 3 probes) check once per
+ * iteration. Interrupted operations report SUDOKU_STATUS_CANCELLED or
+ * SUDOKU_STATUS_DEADLINE_EXCEEDED instead of a plain failure.
+ *
+ * Example (100 ms budget, cancellable from another thread):
+ * @code
+ * SudokuCancelToken *token = sudoku_cancel_token_create();
+ * SudokuGenerationConfig config = {
+ *     .cancel = token,
+ *     .deadline_ns = sudoku_deadline_in_ms(100)
+ * };
+ * SudokuStatus status = sudoku_generate_with_status(board, &config, NULL);
+ * if (status == SUDOKU_STATUS_DEADLINE_EXCEEDED) {
+ *     reply_timeout();
+ * }
+ * sudoku_cancel_token_destroy(token);
+ * @endcode
+ */
+
+#ifndef SUDOKU_CORE_CANCEL_H
+#define SUDOKU_CORE_CANCEL_H
+
+#include <sudoku/core/types.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/** @brief Search nodes between two checks of a SudokuInterrupt */
+#define SUDOKU_INTERRUPT_INTERVAL 1024
+
+/**
+ * @brief Stop conditions handed to an interruptible solver call
+ *
+ * Either member may be unset (NULL / 0). A NULL SudokuInterrupt pointer
+ * means "never interrupt".
+ */
+typedef struct {
+    const SudokuCancelToken *cancel;    ///< Token to watch (NULL = none)
+    uint64_t deadline_ns;               ///< sudoku_clock_ns() deadline (0 = none)
+} SudokuInterrupt;
+
+// ═══════════════════════════════════════════════════════════════════
+//                    CANCELLATION TOKENS
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Create a token in the "not cancelled" state
+ *
+ * @return New token, or NULL on allocation failure
+ *
+ * @note Caller must free with sudoku_cancel_token_destroy()
+ */
+SudokuCancelToken* sudoku_cancel_token_create(void);
+
+/**
+ * @brief Destroy a token (NULL is ignored)
+ *
+ * @warning No operation may still be using the token
+ */
+void sudoku_cancel_token_destroy(SudokuCancelToken *token);
+
+/**
+ * @brief Request cancellation (safe from any thread, idempotent)
+ */
+void sudoku_cancel_token_cancel(SudokuCancelToken *token);
+
+/**
+ * @brief true once sudoku_cancel_token_cancel() was called
+ *        (false for NULL)
+ */
+bool sudoku_cancel_token_is_cancelled(const SudokuCancelToken *token);
+
+/**
+ * @brief Clear the flag so the token can be reused for a new request
+ */
+void sudoku_cancel_token_reset(SudokuCancelToken *token);
+
+// ═══════════════════════════════════════════════════════════════════
+//                    DEADLINES
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Current time in nanoseconds on the deadline clock
+ *
+ * Monotonic where the C library provides TIME_MONOTONIC (C23) or POSIX
+ * CLOCK_MONOTONIC, wall clock (TIME_UTC) otherwise. Only differences
+ * between two readings are meaningful.
+ */
+uint64_t sudoku_clock_ns(void);
+
+/**
+ * @brief Deadline @p ms milliseconds from now
+ */
+uint64_t sudoku_deadline_in_ms(uint64_t ms);
+
+/**
+ * @brief Evaluate the stop conditions once
+ *
+ * @param interrupt Conditions to check (NULL = never interrupted)
+ * @return SUDOKU_STATUS_CANCELLED, SUDOKU_STATUS_DEADLINE_EXCEEDED, or
+ *         SUDOKU_STATUS_OK if the operation may go on
+ *
+ * @note Reads the clock only when a deadline is set
+ */
+SudokuStatus sudoku_interrupt_check(const SudokuInterrupt *interrupt);
+
+#endif // SUDOKU_CORE_CANCEL_H
@@ -42,8 +42,11 @@
  * @note If stats is NULL, statistics are not collected with no performance impact
  * @note The function has a ~99.9% success rate on first attempt
  * 
- * @warning This function uses rand() internally. Call srand(time(NULL))
- *          before first use to ensure different puzzles each execution
+ * @note Randomness comes from the calling thread's own generator, seeded
+ *       from the clock: no setup is needed for different puzzles on
+ *       every run, and srand() has no effect. Call sudoku_random_seed()
+ *       for a reproducible sequence, or use sudoku_generate_from_id()
+ *       to regenerate one specific puzzle
  * 
  * @see sudoku_generate_with_difficulty() for difficulty-targeted generation
  * @see sudoku_set_verbosity() to control debug output during generation
@@ -53,19 +56,26 @@ bool sudoku_generate(SudokuBoard *board, SudokuGenerationStats *stats);
 /**
  * @brief Generate a Sudoku puzzle with specific difficulty target
  * 
- * Similar to sudoku_generate(), but attempts to produce a puzzle
- * at the specified difficulty level by adjusting elimination parameters.
+ * Similar to sudoku_generate(), but steers Phase 3 toward the
+ * requested difficulty:
+ * 
+ * - Every removal is graded; removals that overshoot are undone
+ * - Phase 3 stops once the puzzle is in the requested bucket
+ * - Attempts that can no longer reach the target (too hard after
+ *   Phase 2, or too few removable cells left) are abandoned early
+ *   and retried with a new board
  * 
  * @param[out] board Pointer to the board to fill (will be initialized)
  * @param[in] difficulty Desired difficulty level to target
- * @param[out] stats Pointer to store generation statistics (can be NULL)
- * @return true if generation succeeded, false on failure
+ * @param[out] stats Pointer to store generation statistics (can be NULL);
+ *             stats->difficulty_aborts counts abandoned attempts
+ * @return true if a puzzle of exactly that difficulty was produced,
+ *         false if none was found within the retry limit (the board is
+ *         then left empty and stats->status is SUDOKU_STATUS_FAILED)
  * 
- * @note Exact difficulty is not guaranteed, as it depends on the random
- *       puzzle structure. The function makes best effort to match target
- * 
- * @warning Not yet fully implemented - currently returns same as sudoku_generate()
- * @todo Implement difficulty-specific elimination parameter adjustment
+ * @note Difficulty is the one reported by sudoku_evaluate_difficulty()
+ * @note Same effect as sudoku_generate_ex() with
+ *       config.use_target_difficulty = true, except that it retries
  * 
  * @see sudoku_evaluate_difficulty() to check actual difficulty of result
  */
@@ -73,6 +83,122 @@ bool sudoku_generate_with_difficulty(SudokuBoard *board,
                                      SudokuDifficulty difficulty,
                                      SudokuGenerationStats *stats);
 
+// ═══════════════════════════════════════════════════════════════════
+//                    REPRODUCIBLE GENERATION
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Version of the ID → puzzle mapping of sudoku_generate_from_id()
+ * 
+ * Bumped whenever a change to the generator alters the puzzle an ID
+ * produces. Store it next to the IDs to detect stale ones.
+ */
+#define SUDOKU_GENERATION_ID_VERSION 2
+
+/**
+ * @brief Seed the calling thread's random generator
+ * 
+ * Every random choice of the library (fill, removals, transforms) draws
+ * from a per-thread xoshiro256** stream. Unseeded threads seed it from
+ * the clock; seeding it makes the following calls on this thread
+ * reproducible, independently of other threads. rand()/srand() are
+ * neither used nor affected.
+ * 
+ * @param[in] seed Any value
+ * 
+ * Example:
+ * @code
+ * sudoku_random_seed(42);
+ * sudoku_generate(board, NULL);   // same puzzle on every run
+ * @endcode
+ */
+void sudoku_random_seed(uint64_t seed);
+
+/**
+ * @brief Rebuild the puzzle identified by an ID
+ * 
+ * Runs sudoku_generate_with_difficulty() on a random stream derived
+ * only from @p id, so the same (id, board size, difficulty) produces
+ * the same puzzle on any machine, in any thread, whatever ran before:
+ * a puzzle can be stored as its 8-byte ID and regenerated on demand.
+ * 
+ * The calling thread's own stream is saved and restored around the
+ * call, so interleaving ID-based and ordinary generation does not
+ * change either.
+ * 
+ * @param[out] board Board to fill; its size selects the geometry
+ * @param[in] id Puzzle identifier (any value; consecutive IDs give
+ *               unrelated puzzles)
+ * @param[in] difficulty Difficulty bucket to target
+ * @param[out] stats Generation statistics (can be NULL)
+ * @return true on success; false on invalid arguments or if the ID
+ *         found no puzzle of that difficulty (same result every time)
+ * 
+ * @note Reproducible within one SUDOKU_GENERATION_ID_VERSION
+ * 
+ * Example:
+ * @code
+ * SudokuBoard *board = sudoku_board_create();
+ * sudoku_generate_from_id(board, 0x5EED, SUDOKU_MEDIUM, NULL);
+ * // ... later, anywhere: same call, same puzzle
+ * @endcode
+ */
+bool sudoku_generate_from_id(SudokuBoard *board, uint64_t id,
+                             SudokuDifficulty difficulty,
+                             SudokuGenerationStats *stats);
+
+// ═══════════════════════════════════════════════════════════════════
+//                    SHARED-SOLUTION VARIANTS
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Generate several distinct puzzles with the same solution
+ * 
+ * Fills ONE solution grid, then runs Phases 1-3 on a copy of it for
+ * each puzzle, with fresh random removal orders every time. On large
+ * boards the fill dominates the cost of a generation, so @p count
+ * puzzles cost one fill plus @p count carves instead of @p count
+ * fills ("daily variants": different clues, same answer).
+ * 
+ * Every option of @p config applies to each puzzle (difficulty target,
+ * symmetry, minimal_puzzle, fill_method for the one fill...). A carve
+ * that misses the target or repeats an earlier puzzle is retried on
+ * the same grid.
+ * 
+ * Second solutions found by one carve's uniqueness probes are kept and
+ * reject, without a probe, the removals of later carves they still
+ * satisfy. The puzzles are the same as without this cache.
+ * 
+ * @param[out] puzzles @p count caller-allocated boards, all of the same
+ *                     size; that size selects the geometry
+ * @param[in] count Number of puzzles wanted
+ * @param[in] config Generation options (can be NULL)
+ * @param[out] stats Fill statistics and the phases of the last puzzle;
+ *                   difficulty_aborts counts rejected carves,
+ *                   phase3_probes_refuted the probes skipped by cached
+ *                   second solutions over all carves, and status why
+ *                   generation stopped (can be NULL)
+ * @return Puzzles generated: @p count on success, fewer if the grid
+ *         ran out of new puzzles for the target or generation was
+ *         interrupted (puzzles[0..return-1] are valid), 0 on invalid
+ *         arguments or a failed fill
+ * 
+ * @note Small grids only have so many distinct puzzles of a given
+ *       difficulty: asking a 4×4 grid for many variants can fall short
+ * 
+ * Example:
+ * @code
+ * SudokuBoard *daily[7];
+ * for (int i = 0; i < 7; i++) daily[i] = sudoku_board_create();
+ * SudokuGenerationConfig config = { .use_target_difficulty = true,
+ *                                   .target_difficulty = SUDOKU_MEDIUM };
+ * int made = sudoku_generate_variants(daily, 7, &config, NULL);
+ * @endcode
+ */
+int sudoku_generate_variants(SudokuBoard *const *puzzles, int count,
+                             const SudokuGenerationConfig *config,
+                             SudokuGenerationStats *stats);
+
 // ═══════════════════════════════════════════════════════════════════
 //                    DIFFICULTY EVALUATION
 // ═══════════════════════════════════════════════════════════════════
@@ -80,23 +206,25 @@ bool sudoku_generate_with_difficulty(SudokuBoard *board,
 /**
  * @brief Evaluate the difficulty level of a puzzle
  * 
- * Analyzes a Sudoku puzzle and returns its estimated difficulty
- * based primarily on the number of clues (filled cells).
+ * Analyzes a Sudoku puzzle and returns its difficulty based on the
+ * hardest human solving technique it requires:
  * 
  * Difficulty criteria:
- * - EASY: 45+ clues
- * - MEDIUM: 35-44 clues
- * - HARD: 25-34 clues
- * - EXPERT: <25 clues
+ * - EASY: naked and hidden singles only
+ * - MEDIUM: locked candidates, naked/hidden pairs
+ * - HARD: naked/hidden triples, X-Wing, Swordfish
+ * - EXPERT: logic stalls, guessing (backtracking) required
  * 
  * @param[in] board Pointer to the board to evaluate
- * @return Estimated difficulty level
+ * @return Difficulty level, or SUDOKU_INVALID if the puzzle has no
+ *         unique solution
  * 
  * @pre board != NULL
  * 
- * @note This is a simple heuristic based on clue count. More sophisticated
- *       analysis could consider specific solving techniques required
+ * @note Boards larger than 64×64 cannot be graded and fall back to the
+ *       clue-percentage heuristic (≥55% EASY, ≥43% MEDIUM, ≥31% HARD)
  * 
+ * @see sudoku_grade_puzzle() for the full report (score, technique counts)
  * @see sudoku_difficulty_to_string() to convert result to readable format
  */
 SudokuDifficulty sudoku_evaluate_difficulty(const SudokuBoard *board);
@@ -199,9 +327,36 @@ int sudoku_get_verbosity(void);
  * 
  * @note If config is NULL or config->callback is NULL, behaves like sudoku_generate()
  * @note The callback is called synchronously during generation
+ * @note With config->use_target_difficulty set, returns false (and sets
+ *       stats->difficulty_aborts = 1) when this attempt cannot reach
+ *       config->target_difficulty; the caller decides whether to retry
  * @note Keep callbacks fast - don't do heavy computation inside them
  */
 bool sudoku_generate_ex(SudokuBoard *board,
                         const SudokuGenerationConfig *config,
                         SudokuGenerationStats *stats);
+
+/**
+ * @brief sudoku_generate_ex() with an explicit outcome
+ * 
+ * Generation can be stopped from outside through config->cancel (a
+ * SudokuCancelToken) and config->deadline_ns (see sudoku/core/cancel.h).
+ * Both are checked between fill attempts, before every Phase 3 probe
+ * and every SUDOKU_INTERRUPT_INTERVAL nodes inside the searches, so an
+ * interrupted call returns within milliseconds.
+ * 
+ * @param board Pointer to the board to fill (will be initialized)
+ * @param config Configuration (may be NULL)
+ * @param stats Pointer to store generation statistics (can be NULL);
+ *        stats->status receives the returned value
+ * @return SUDOKU_STATUS_OK on success, SUDOKU_STATUS_FAILED when no
+ *         puzzle was produced, SUDOKU_STATUS_CANCELLED or
+ *         SUDOKU_STATUS_DEADLINE_EXCEEDED when interrupted
+ * 
+ * @note An interrupted board is not a finished puzzle and must not be
+ *       handed out; sudoku_generate_ex() returns false in that case
+ */
+SudokuStatus sudoku_generate_with_status(SudokuBoard *board,
+                                         const SudokuGenerationConfig *config,
+                                         SudokuGenerationStats *stats);
 #endif // SUDOKU_CORE_GENERATOR_H
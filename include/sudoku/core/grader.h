@@ -0,0 +1,67 @@
+/**
+ * @file grader.h
+ * @brief Technique-based difficulty grading
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * Clue count is a weak predictor of difficulty: a 24-clue puzzle may
+ * fall to hidden singles while a 30-clue one needs an X-Wing. The grader
+ * solves the puzzle the way a human would, always trying the cheapest
+ * technique first, and reports which techniques were needed.
+ *
+ * Grading a 9×9 puzzle takes a few microseconds, so it can be called
+ * on every generated puzzle (and during generation) at production rates.
+ */
+
+#ifndef SUDOKU_CORE_GRADER_H
+#define SUDOKU_CORE_GRADER_H
+
+#include <sudoku/core/types.h>
+#include <stdbool.h>
+
+/**
+ * @brief Grade a puzzle by the human techniques needed to solve it
+ *
+ * Applies, in order of cost: naked single, hidden single, locked
+ * candidates, naked/hidden pairs, naked/hidden triples, X-Wing and
+ * Swordfish. If logic stalls, the remaining puzzle is finished by
+ * backtracking, which marks it as EXPERT.
+ *
+ * @param[in] board Puzzle to grade (not modified)
+ * @param[out] result Grading report
+ * @return true if the puzzle could be graded, false if board/result is
+ *         NULL or the board is larger than 64×64
+ *
+ * @post If the puzzle has no unique solution, result->difficulty is
+ *       SUDOKU_INVALID and result->solutions tells why (0 or 2)
+ *
+ * Example:
+ * @code
+ * SudokuGradeResult grade;
+ * if (sudoku_grade_puzzle(board, &grade)) {
+ *     printf("%s (hardest: %s, score %d)\n",
+ *            sudoku_difficulty_to_string(grade.difficulty),
+ *            sudoku_technique_to_string(grade.hardest),
+ *            grade.score);
+ * }
+ * @endcode
+ */
+bool sudoku_grade_puzzle(const SudokuBoard *board, SudokuGradeResult *result);
+
+/**
+ * @brief Difficulty bucket for a given hardest technique
+ *
+ * @param[in] hardest Hardest technique required
+ * @return EASY (singles), MEDIUM (locked candidates, pairs),
+ *         HARD (triples, fish) or EXPERT (backtracking)
+ */
+SudokuDifficulty sudoku_technique_difficulty(SudokuTechnique hardest);
+
+/**
+ * @brief Convert a technique to a human-readable string
+ *
+ * @return Static string, e.g. "Hidden Single"; "Unknown" if out of range
+ */
+const char* sudoku_technique_to_string(SudokuTechnique technique);
+
+#endif // SUDOKU_CORE_GRADER_H
@@ -0,0 +1,176 @@
+/**
+ * @file trace.h
+ * @brief Lock-free single-producer/single-consumer event trace buffer
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * Event callbacks run synchronously inside Phases 1-3: whatever a
+ * callback does (printf, fflush, writing a log file...) is time the
+ * generator is not generating. For detailed traces that is most of the
+ * run time.
+ *
+ * A SudokuTraceBuffer decouples the two sides. The generator (producer)
+ * copies each event into a compact timestamped record inside a ring
+ * buffer and returns immediately; the application (consumer) drains
+ * the records later, either after generation or from its own thread
+ * while generation is running.
+ *
+ *   generator ──push──▶ [ r r r r . . . . ] ──drain──▶ logger thread
+ *                        tail ▲      ▲ head
+ *
+ * CONCURRENCY:
+ * - Exactly ONE thread may push and ONE thread may drain at a time
+ *   (they may be the same thread). No locks are taken: head and tail
+ *   are C11 atomics on separate cache lines.
+ * - A buffer must not be shared by two concurrent generations.
+ *
+ * OVERFLOW:
+ * When the ring is full the configured SudokuTraceOverflow policy
+ * applies. Every record carries a sequence number, so drops show up
+ * as gaps in addition to the `dropped` counter.
+ *
+ * Example (drain after generation):
+ * @code
+ * SudokuTraceBuffer *trace = sudoku_trace_create(0, SUDOKU_TRACE_DROP_NEWEST);
+ * SudokuGenerationConfig config = {
+ *     .callback = sudoku_trace_callback,
+ *     .user_data = trace
+ * };
+ * sudoku_generate_ex(board, &config, NULL);
+ *
+ * SudokuTraceRecord records[256];
+ * size_t got;
+ * while ((got = sudoku_trace_drain(trace, records, 256)) > 0) {
+ *     write_log(records, got);
+ * }
+ * sudoku_trace_destroy(trace);
+ * @endcode
+ */
+
+#ifndef SUDOKU_CORE_TRACE_H
+#define SUDOKU_CORE_TRACE_H
+
+#include <sudoku/core/types.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// ═══════════════════════════════════════════════════════════════════
+//                    TYPES
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Compact copy of a SudokuEventData (32 bytes)
+ *
+ * The board pointer is NOT kept: it is only valid during the callback.
+ * Field meanings follow SudokuEventData.
+ */
+typedef struct {
+    uint64_t timestamp_ns;      ///< sudoku_clock_ns() at push time (monotonic, nanoseconds)
+    uint32_t sequence;          ///< Push order, including dropped events
+    uint16_t type;              ///< SudokuEventType
+    int16_t phase_number;       ///< SudokuEventData::phase_number
+    int32_t cells_removed_total;///< SudokuEventData::cells_removed_total
+    int32_t round_number;       ///< SudokuEventData::round_number
+    int16_t row;                ///< Cell row (-1 if not applicable)
+    int16_t col;                ///< Cell column (-1 if not applicable)
+    int16_t value;              ///< Cell value (0 if not applicable)
+} SudokuTraceRecord;
+
+/**
+ * @brief What the producer does when the ring is full
+ */
+typedef enum {
+    SUDOKU_TRACE_DROP_NEWEST = 0,   ///< Discard the new record (never blocks generation)
+    SUDOKU_TRACE_BLOCK              ///< Spin until the consumer frees a slot
+                                    ///< (requires a concurrently draining thread)
+} SudokuTraceOverflow;
+
+/**
+ * @brief Counters of a trace buffer
+ */
+typedef struct {
+    uint64_t pushed;            ///< Records stored in the ring
+    uint64_t dropped;           ///< Records discarded by SUDOKU_TRACE_DROP_NEWEST
+    uint64_t drained;           ///< Records handed to the consumer
+    size_t high_water;          ///< Largest occupancy seen by the producer
+    size_t capacity;            ///< Ring size in records
+} SudokuTraceStats;
+
+/** @brief Opaque ring buffer */
+typedef struct SudokuTraceBuffer SudokuTraceBuffer;
+
+// ═══════════════════════════════════════════════════════════════════
+//                    LIFECYCLE
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Create a trace buffer
+ *
+ * @param capacity Records the ring can hold, rounded up to a power of
+ *                 two (0 = 4096)
+ * @param policy Overflow policy
+ * @return New buffer, or NULL on allocation failure
+ *
+ * @note Caller must free with sudoku_trace_destroy()
+ */
+SudokuTraceBuffer* sudoku_trace_create(size_t capacity, SudokuTraceOverflow policy);
+
+/**
+ * @brief Destroy a trace buffer (NULL is ignored)
+ *
+ * @warning Neither side may be using the buffer any more
+ */
+void sudoku_trace_destroy(SudokuTraceBuffer *trace);
+
+// ═══════════════════════════════════════════════════════════════════
+//                    PRODUCER SIDE
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Append an event to the ring
+ *
+ * @param trace Buffer
+ * @param event Event to copy
+ * @return true if stored, false if dropped (or on NULL arguments)
+ */
+bool sudoku_trace_push(SudokuTraceBuffer *trace, const SudokuEventData *event);
+
+/**
+ * @brief SudokuEventCallback that pushes into the buffer in user_data
+ *
+ * Register it as SudokuGenerationConfig.callback with the buffer as
+ * user_data. Combine with SudokuGenerationConfig.event_mask to trace
+ * only some event types.
+ */
+void sudoku_trace_callback(const SudokuEventData *event, void *user_data);
+
+// ═══════════════════════════════════════════════════════════════════
+//                    CONSUMER SIDE
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Move up to max pending records into out, oldest first
+ *
+ * @param trace Buffer
+ * @param[out] out Destination array
+ * @param max Capacity of out
+ * @return Number of records copied (0 when the ring is empty)
+ */
+size_t sudoku_trace_drain(SudokuTraceBuffer *trace, SudokuTraceRecord *out, size_t max);
+
+/**
+ * @brief Number of records waiting to be drained (approximate while
+ *        the producer is running)
+ */
+size_t sudoku_trace_pending(const SudokuTraceBuffer *trace);
+
+/**
+ * @brief Read the buffer counters
+ *
+ * Safe to call from either side; values are a consistent-enough
+ * snapshot for monitoring, exact once the producer has stopped.
+ */
+void sudoku_trace_get_stats(const SudokuTraceBuffer *trace, SudokuTraceStats *stats);
+
+#endif // SUDOKU_CORE_TRACE_H
@@ -0,0 +1,89 @@
+/**
+ * @file transform.h
+ * @brief Validity-preserving board transforms (cheap puzzle variants)
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * Generating a unique puzzle is expensive: it needs a full backtracking
+ * fill plus one exact solution count per removal probe. Transforming an
+ * existing puzzle is not: relabelling digits and shuffling rows/columns
+ * inside the Sudoku symmetry group is a single O(n²) pass, and the
+ * result keeps the clue count and the uniqueness of the original.
+ *
+ * Typical use: generate one seed puzzle per difficulty and expand it
+ * into as many variants as needed.
+ */
+
+#ifndef SUDOKU_CORE_TRANSFORM_H
+#define SUDOKU_CORE_TRANSFORM_H
+
+#include <sudoku/core/types.h>
+#include <stdbool.h>
+
+// ═══════════════════════════════════════════════════════════════════
+//                    SINGLE-BOARD TRANSFORM
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Apply a random validity-preserving transform in place
+ *
+ * Draws a random element of the enabled symmetry families and applies
+ * it to the board. Empty cells (0) stay empty; only their position
+ * changes.
+ *
+ * @param[in,out] board Board to transform (any supported size)
+ * @param[in] flags Bitwise OR of SudokuTransformFlags
+ * @return true on success, false on NULL board or allocation failure
+ *
+ * @post Clue count and number of solutions are unchanged
+ *
+ * @note Time complexity: O(n²) with a single n² scratch buffer
+ * @note Draws from the calling thread's generator; seed it with
+ *       sudoku_random_seed() for reproducible output
+ *
+ * Example:
+ * @code
+ * SudokuBoard *puzzle = sudoku_board_create();
+ * sudoku_generate(puzzle, NULL);
+ * sudoku_board_transform(puzzle, SUDOKU_TRANSFORM_ALL);
+ * // puzzle is still unique, with the same difficulty profile
+ * @endcode
+ */
+bool sudoku_board_transform(SudokuBoard *board, unsigned int flags);
+
+// ═══════════════════════════════════════════════════════════════════
+//                    BATCH EXPANSION
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Expand one seed puzzle into several transformed variants
+ *
+ * Allocates @p count new boards of the same geometry as @p seed, copies
+ * the seed into each one and applies an independent random transform.
+ *
+ * @param[in] seed Source puzzle (not modified)
+ * @param[out] variants Array receiving @p count board pointers
+ * @param[in] count Number of variants to produce
+ * @param[in] flags Bitwise OR of SudokuTransformFlags
+ * @return Number of variants produced (== count on success); on
+ *         allocation failure the boards produced so far are kept
+ *
+ * @note Caller owns every returned board and must free each one
+ *       with sudoku_board_destroy()
+ *
+ * Example:
+ * @code
+ * SudokuBoard *variants[100];
+ * int made = sudoku_board_transform_batch(seed, variants, 100,
+ *                                         SUDOKU_TRANSFORM_ALL);
+ * for (int i = 0; i < made; i++) {
+ *     sudoku_board_destroy(variants[i]);
+ * }
+ * @endcode
+ */
+int sudoku_board_transform_batch(const SudokuBoard *seed,
+                                 SudokuBoard **variants,
+                                 int count,
+                                 unsigned int flags);
+
+#endif // SUDOKU_CORE_TRANSFORM_H
@@ -25,6 +25,7 @@
 #define SUDOKU_TYPES_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
 // ═══════════════════════════════════════════════════════════════════
 //                    DEFAULT SIZE CONSTANTS
@@ -156,6 +157,33 @@ typedef struct {
     int col;    ///< Column index (0 to board_size-1)
 } SudokuPosition;
 
+/**
+ * @brief Opaque region allocator for per-puzzle data
+ *
+ * Defined in arena.c; see sudoku/core/arena.h for the API.
+ */
+typedef struct SudokuArena SudokuArena;
+
+/**
+ * @brief Opaque cancellation flag shared between threads
+ *
+ * Defined in cancel.c; see sudoku/core/cancel.h for the API.
+ */
+typedef struct SudokuCancelToken SudokuCancelToken;
+
+/**
+ * @brief Result of an interruptible operation
+ *
+ * Lets callers tell "no puzzle / no solution" apart from "stopped
+ * because the caller asked" when a generation or a solver call ends.
+ */
+typedef enum {
+    SUDOKU_STATUS_OK = 0,               ///< Finished normally
+    SUDOKU_STATUS_FAILED,               ///< Finished without a result
+    SUDOKU_STATUS_CANCELLED,            ///< Stopped by a SudokuCancelToken
+    SUDOKU_STATUS_DEADLINE_EXCEEDED     ///< Stopped at the deadline
+} SudokuStatus;
+
 // ═══════════════════════════════════════════════════════════════════
 //                    BOARD STRUCTURE (Configurable Size)
 // ═══════════════════════════════════════════════════════════════════
@@ -248,8 +276,10 @@ typedef struct {
      * - 1 to board_size: Valid numbers
      * 
      * Memory layout:
-     * - Pointer to array of row pointers (heap allocated)
-     * - Each row is a contiguous array of integers (heap allocated)
+     * - Pointer to array of row pointers
+     * - Rows are consecutive slices of ONE contiguous array, so
+     *   cells[0] addresses all board_size² values in row-major order
+     * - Struct, row pointers and values share a single allocation
      * - Total memory: board_size * sizeof(int*) + board_size² * sizeof(int)
      * 
      * Access patterns:
@@ -292,6 +322,35 @@ typedef struct {
      * @see sudoku_board_get_empty() for accessor function
      */
     int empty;
+
+    /**
+     * @brief true if the board lives inside a SudokuArena
+     *
+     * Arena boards are reclaimed by sudoku_arena_reset() or
+     * sudoku_arena_destroy(); sudoku_board_destroy() ignores them.
+     *
+     * @see sudoku_board_create_in_arena()
+     */
+    bool arena_owned;
+
+    // ─────────────────────────────────────────────────────────────
+    //  State Hash
+    // ─────────────────────────────────────────────────────────────
+
+    /**
+     * @brief 64-bit Zobrist hash of the cell values
+     *
+     * Updated in O(1) by sudoku_board_set_cell(); recomputed by
+     * sudoku_board_update_stats() after direct writes to cells.
+     *
+     * @see sudoku_board_get_hash() for accessor function
+     */
+    uint64_t hash;
+
+    /**
+     * @brief Zobrist key table of this geometry (NULL: keys computed)
+     */
+    const uint64_t *zobrist;
 } SudokuBoard;
 
 // ═══════════════════════════════════════════════════════════════════
@@ -334,9 +393,52 @@ typedef struct {
  */
 typedef struct {
     int index;              ///< Subgrid index (0 to board_size-1)
+    int subgrid_size;       ///< Subgrid dimension (k in k×k), used for cell offsets
     SudokuPosition base;    ///< Top-left corner position of this subgrid
 } SudokuSubGrid;
 
+// ═══════════════════════════════════════════════════════════════════
+//                    VALIDITY-PRESERVING TRANSFORMS
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Families of symmetry operations applied by sudoku_board_transform()
+ *
+ * Every operation in this list maps a valid Sudoku onto another valid
+ * Sudoku with the SAME number of solutions. A puzzle with a unique
+ * solution therefore stays unique, and its clue count never changes.
+ *
+ * For a board of size n = k² (k = subgrid_size):
+ * | Flag       | Operation                                 | Choices |
+ * |------------|-------------------------------------------|---------|
+ * | DIGITS     | Relabel the digits 1..n                   | n!      |
+ * | BANDS      | Permute the k horizontal bands            | k!      |
+ * | ROWS       | Permute rows inside each band             | (k!)^k  |
+ * | STACKS     | Permute the k vertical stacks             | k!      |
+ * | COLUMNS    | Permute columns inside each stack         | (k!)^k  |
+ * | TRANSPOSE  | Reflect across the main diagonal          | 2       |
+ * | ROTATE     | Rotate by 0/90/180/270 degrees            | 4       |
+ *
+ * For 9×9 this yields 9!·6⁸·2 ≈ 1.2·10¹² distinct variants per seed,
+ * so a single expensive generation can be recycled into many puzzles
+ * that look unrelated to a human player.
+ *
+ * Flags combine with bitwise OR. SUDOKU_TRANSFORM_ALL enables everything.
+ *
+ * @see sudoku_board_transform()
+ */
+typedef enum {
+    SUDOKU_TRANSFORM_NONE      = 0,
+    SUDOKU_TRANSFORM_DIGITS    = 1 << 0,  ///< Random digit relabelling
+    SUDOKU_TRANSFORM_BANDS     = 1 << 1,  ///< Random band order
+    SUDOKU_TRANSFORM_ROWS      = 1 << 2,  ///< Random row order within bands
+    SUDOKU_TRANSFORM_STACKS    = 1 << 3,  ///< Random stack order
+    SUDOKU_TRANSFORM_COLUMNS   = 1 << 4,  ///< Random column order within stacks
+    SUDOKU_TRANSFORM_TRANSPOSE = 1 << 5,  ///< Transpose with probability 1/2
+    SUDOKU_TRANSFORM_ROTATE    = 1 << 6,  ///< Random quarter-turn rotation
+    SUDOKU_TRANSFORM_ALL       = 0x7F     ///< All of the above
+} SudokuTransformFlags;
+
 // ═══════════════════════════════════════════════════════════════════
 //                    GENERATION STATISTICS
 // ═══════════════════════════════════════════════════════════════════
@@ -418,6 +520,60 @@ typedef struct {
      */
     int total_attempts;
 
+    /**
+     * @brief Generations abandoned early by difficulty targeting
+     * 
+     * Only non-zero when a target difficulty is requested. Counts
+     * attempts dropped because the puzzle was already harder than the
+     * target after Phase 2, or because Phase 3 could no longer remove
+     * enough clues to reach it.
+     */
+    int difficulty_aborts;
+
+    /**
+     * @brief Board-fill restarts (attempts cut by the node budget or
+     *        ending in a dead end)
+     */
+    int fill_restarts;
+
+    /**
+     * @brief Backtracking nodes spent filling the board, all attempts
+     */
+    long fill_nodes;
+
+    /**
+     * @brief Uniqueness probes (solver calls) made by Phase 3
+     */
+    int phase3_probes;
+
+    /**
+     * @brief Phase 3 removals certified without a probe
+     * 
+     * A removal that leaves the value as a naked or hidden single in
+     * its cell cannot create a second solution, and neither can one
+     * whose puzzle naked and hidden singles still solve completely, so
+     * the solver is not called for either.
+     */
+    int phase3_probes_saved;
+
+    /**
+     * @brief Phase 3 removals rejected without a probe
+     * 
+     * Only sudoku_generate_variants() fills this: a second solution
+     * found while carving an earlier variant of the same grid still
+     * solves the reduced puzzle.
+     */
+    int phase3_probes_refuted;
+
+    /**
+     * @brief How the generation ended
+     * 
+     * SUDOKU_STATUS_CANCELLED or SUDOKU_STATUS_DEADLINE_EXCEEDED when it
+     * was interrupted; the board then holds whatever state the
+     * interrupted step left (not a finished puzzle).
+     */
+    SudokuStatus status;
+
     // 🆕 NEW: AC-3 metrics
     int ac3_revisions;          ///< Number of arc revisions
     int ac3_propagations;       ///< Constraint propagations
@@ -449,9 +605,11 @@ typedef struct {
  * | HARD       | 31-42% | 25-34     | 79-109      | 194-268     |
  * | EXPERT     | <31%   | <25       | <79         | <194        |
  * 
- * @note These thresholds are heuristics based on clue count only.
- *       Actual solving difficulty also depends on which techniques
- *       are required (naked pairs, X-wings, etc.).
+ * @note Since technique grading was added, these percentages are only
+ *       used to classify boards too large to grade (>64×64) and as the
+ *       clue-count stopping point of difficulty-targeted generation.
+ *       The actual bucket comes from the hardest technique required
+ *       (see SudokuTechnique).
  * 
  * @see sudoku_evaluate_difficulty() for the evaluation function
  * @see sudoku_difficulty_to_string() for string conversion
@@ -464,6 +622,57 @@ typedef enum {
     SUDOKU_INVALID      ///< Invalid board state (error condition)
 } SudokuDifficulty;
 
+// ═══════════════════════════════════════════════════════════════════
+//                    TECHNIQUE-BASED GRADING
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Human solving techniques, ordered from cheapest to hardest
+ *
+ * The grader always applies the cheapest technique that makes progress,
+ * so the hardest technique it had to use is a good proxy for how hard
+ * the puzzle feels to a human solver.
+ *
+ * | Technique          | Bucket  |
+ * |--------------------|---------|
+ * | Naked/Hidden single| EASY    |
+ * | Locked candidates  | MEDIUM  |
+ * | Naked/Hidden pair  | MEDIUM  |
+ * | Naked/Hidden triple| HARD    |
+ * | X-Wing, Swordfish  | HARD    |
+ * | Backtracking       | EXPERT  |
+ *
+ * @see sudoku_grade_puzzle()
+ */
+typedef enum {
+    SUDOKU_TECH_NONE = 0,           ///< Nothing needed (board already full)
+    SUDOKU_TECH_NAKED_SINGLE,       ///< Cell with a single candidate
+    SUDOKU_TECH_HIDDEN_SINGLE,      ///< Digit with a single place in a unit
+    SUDOKU_TECH_LOCKED_CANDIDATES,  ///< Pointing / claiming (box-line)
+    SUDOKU_TECH_NAKED_PAIR,         ///< Two cells sharing two candidates
+    SUDOKU_TECH_HIDDEN_PAIR,        ///< Two digits confined to two cells
+    SUDOKU_TECH_NAKED_TRIPLE,       ///< Three cells sharing three candidates
+    SUDOKU_TECH_HIDDEN_TRIPLE,      ///< Three digits confined to three cells
+    SUDOKU_TECH_X_WING,             ///< Fish of size 2
+    SUDOKU_TECH_SWORDFISH,          ///< Fish of size 3
+    SUDOKU_TECH_BACKTRACKING,       ///< Logic stalled, search was required
+    SUDOKU_TECH_COUNT               ///< Number of techniques (not a technique)
+} SudokuTechnique;
+
+/**
+ * @brief Result of grading a puzzle with the logical solver
+ *
+ * @see sudoku_grade_puzzle() which fills this structure
+ */
+typedef struct {
+    SudokuDifficulty difficulty;    ///< Bucket derived from @c hardest
+    SudokuTechnique hardest;        ///< Hardest technique required
+    int score;                      ///< Weighted sum of technique uses
+    int solutions;                  ///< 0, 1, 2 (= two or more), -1 if unknown
+    bool solved_by_logic;           ///< true if no guessing was needed
+    int technique_uses[SUDOKU_TECH_COUNT];  ///< Times each technique applied
+} SudokuGradeResult;
+
 // ═══════════════════════════════════════════════════════════════════
 //                    EVENT SYSTEM FOR GENERATION MONITORING
 // ═══════════════════════════════════════════════════════════════════
@@ -541,6 +750,37 @@ typedef enum {
 
 } SudokuEventType;
 
+/**
+ * @brief Bit of one event type inside an event mask
+ *
+ * Event masks select which events a callback is subscribed to
+ * (see SudokuGenerationConfig::event_mask). Events whose bit is clear
+ * are never built, so unsubscribed per-cell events cost one test.
+ *
+ * @code
+ * config.event_mask = SUDOKU_EVENT_BIT(SUDOKU_EVENT_PHASE1_COMPLETE) |
+ *                     SUDOKU_EVENT_BIT(SUDOKU_EVENT_PHASE3_COMPLETE);
+ * @endcode
+ */
+#define SUDOKU_EVENT_BIT(type) (1ULL << (type))
+
+/** @brief Every event type (0 in event_mask means the same) */
+#define SUDOKU_EVENT_MASK_ALL (~0ULL)
+
+/** @brief High-volume events emitted once per cell, arc or value */
+#define SUDOKU_EVENT_MASK_CELLS \
+    (SUDOKU_EVENT_BIT(SUDOKU_EVENT_PHASE1_CELL_SELECTED) | \
+     SUDOKU_EVENT_BIT(SUDOKU_EVENT_PHASE2_CELL_SELECTED) | \
+     SUDOKU_EVENT_BIT(SUDOKU_EVENT_PHASE3_CELL_TESTING)  | \
+     SUDOKU_EVENT_BIT(SUDOKU_EVENT_PHASE3_CELL_REMOVED)  | \
+     SUDOKU_EVENT_BIT(SUDOKU_EVENT_PHASE3_CELL_KEPT)     | \
+     SUDOKU_EVENT_BIT(SUDOKU_EVENT_AC3_REVISION)         | \
+     SUDOKU_EVENT_BIT(SUDOKU_EVENT_AC3_VALUE_REMOVED)    | \
+     SUDOKU_EVENT_BIT(SUDOKU_EVENT_HEURISTIC_SELECT))
+
+/** @brief Lifecycle and phase start/complete events only */
+#define SUDOKU_EVENT_MASK_PHASES (SUDOKU_EVENT_MASK_ALL & ~SUDOKU_EVENT_MASK_CELLS)
+
 /**
  * @brief Data associated with a generation event
  * 
@@ -658,14 +898,85 @@ typedef enum {
     // HEURISTIC_COMBINED = 4  ///< Use all heuristics
 } HeuristicStrategy;
 
+/**
+ * @brief Restart schedule for the board-filling backtracker
+ * 
+ * Filling is heavy-tailed: most attempts finish in a few thousand
+ * nodes, a few run for minutes after an unlucky early choice. Each
+ * attempt therefore gets a node budget (unit × schedule factor); when
+ * it runs out the fill restarts from fresh random diagonals.
+ * 
+ * - LUBY: 1,1,2,1,1,2,4,1,1,2,1,1,2,4,8,... (within a log factor of the
+ *   optimal schedule for an unknown run-time distribution)
+ * - GEOMETRIC: 1,2,4,8,... (fewer restarts, longer worst attempts)
+ */
+typedef enum {
+    SUDOKU_RESTART_LUBY = 0,        ///< Luby sequence (default)
+    SUDOKU_RESTART_GEOMETRIC        ///< Budget doubles on every restart
+} SudokuRestartPolicy;
+
+/**
+ * @brief Clue-pattern symmetry of the generated puzzle
+ * 
+ * With a symmetry other than NONE, cells are grouped into orbits (the
+ * cell and its images, 1 to 4 cells) and Phases 1-3 only ever remove
+ * whole orbits, so the clue pattern is symmetric by construction.
+ * Phase 3 runs one uniqueness probe per orbit instead of one per cell.
+ * 
+ * | Symmetry           | Image of (r, c)             | Orbit size |
+ * |--------------------|-----------------------------|------------|
+ * | ROTATE_180         | (n-1-r, n-1-c)              | 2          |
+ * | ROTATE_90          | (c, n-1-r), (n-1-r, n-1-c)… | 4          |
+ * | DIAGONAL           | (c, r)                      | 2          |
+ * | MIRROR_HORIZONTAL  | (n-1-r, c)  top ↔ bottom    | 2          |
+ * | MIRROR_VERTICAL    | (r, n-1-c)  left ↔ right    | 2          |
+ * 
+ * Cells on an axis or at the centre form smaller orbits.
+ */
+typedef enum {
+    SUDOKU_SYMMETRY_NONE = 0,           ///< No constraint (default)
+    SUDOKU_SYMMETRY_ROTATE_180,         ///< Half-turn rotation
+    SUDOKU_SYMMETRY_ROTATE_90,          ///< Quarter-turn rotation
+    SUDOKU_SYMMETRY_DIAGONAL,           ///< Main-diagonal reflection
+    SUDOKU_SYMMETRY_MIRROR_HORIZONTAL,  ///< Reflection across the horizontal axis
+    SUDOKU_SYMMETRY_MIRROR_VERTICAL     ///< Reflection across the vertical axis
+} SudokuSymmetry;
+
+/**
+ * @brief How the generator builds the full grid it carves the puzzle from
+ * 
+ * - BACKTRACKING: random diagonal subgrids completed by a budgeted,
+ *   restarting search (4×4 draws from the table of all grids). Covers
+ *   every possible grid, but the search is slow on 25×25 and up.
+ * - PATTERN: the canonical shifted pattern, randomised with band,
+ *   stack, row, column and digit permutations. O(n²) and never fails
+ *   (milliseconds even for 100×100), but only reaches transforms of
+ *   one grid, so puzzles are less varied.
+ */
+typedef enum {
+    SUDOKU_FILL_BACKTRACKING = 0,       ///< Diagonal + search (default)
+    SUDOKU_FILL_PATTERN                 ///< Permuted pattern grid
+} SudokuFillMethod;
+
 // Ahora define SudokuGenerationConfig (tu código existente)
 typedef struct {
     SudokuEventCallback callback;
     void *user_data;
-    int max_attempts;
+    int max_attempts;                      ///< Board-fill attempts, restarts included (0 = 64)
     bool use_ac3;
     bool use_heuristics;
     HeuristicStrategy heuristic_strategy;  // ✅ Ahora compila
+    bool use_target_difficulty;            ///< Steer Phase 3 toward target_difficulty
+    SudokuDifficulty target_difficulty;    ///< Requested bucket when enabled
+    SudokuArena *arena;                    ///< Scratch arena (NULL = per-thread default)
+    uint64_t event_mask;                   ///< Events delivered to callback (0 = all)
+    bool minimal_puzzle;                   ///< Phase 3 tries every clue (minimal puzzle)
+    SudokuRestartPolicy restart_policy;    ///< Fill restart schedule (default Luby)
+    long fill_node_budget;                 ///< Budget unit per attempt (0 = n³, < 0 = unlimited)
+    SudokuCancelToken *cancel;             ///< Cancellation token (NULL = none)
+    uint64_t deadline_ns;                  ///< Absolute sudoku_clock_ns() deadline (0 = none)
+    SudokuSymmetry symmetry;               ///< Clue-pattern symmetry (default none)
+    SudokuFillMethod fill_method;          ///< Full-grid construction (default backtracking)
 } SudokuGenerationConfig;
 
 #endif // SUDOKU_TYPES_H
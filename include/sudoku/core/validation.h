@@ -14,6 +14,7 @@
 #define SUDOKU_CORE_VALIDATION_H
 
 #include <sudoku/core/types.h>
+#include <sudoku/core/cancel.h>
 
 // ═══════════════════════════════════════════════════════════════════
 //                    POSITION VALIDATION
@@ -145,4 +146,86 @@ bool sudoku_validate_board(const SudokuBoard *board);
  */
 int countSolutionsExact(SudokuBoard *board, int limit);
 
+/**
+ * @brief Interruptible version of countSolutionsExact()
+ * 
+ * Runs the same search but polls @p interrupt every
+ * SUDOKU_INTERRUPT_INTERVAL nodes and gives up as soon as the token is
+ * cancelled or the deadline passes. The board is restored either way.
+ * 
+ * @param board Board to analyze (temporarily modified, then restored)
+ * @param limit Maximum number of solutions to find before stopping
+ * @param interrupt Stop conditions (NULL = same as countSolutionsExact())
+ * @param[out] status SUDOKU_STATUS_OK if the count is complete,
+ *             SUDOKU_STATUS_CANCELLED / SUDOKU_STATUS_DEADLINE_EXCEEDED
+ *             if interrupted (may be NULL)
+ * @return Solutions found; when interrupted, only a lower bound
+ * 
+ * Example usage:
+ * @code
+ * SudokuInterrupt interrupt = { .deadline_ns = sudoku_deadline_in_ms(50) };
+ * SudokuStatus status;
+ * int solutions = countSolutionsExactEx(board, 2, &interrupt, &status);
+ * if(status != SUDOKU_STATUS_OK) {
+ *     printf("Gave up: uniqueness unknown\n");
+ * }
+ * @endcode
+ */
+int countSolutionsExactEx(SudokuBoard *board, int limit,
+                          const SudokuInterrupt *interrupt, SudokuStatus *status);
+
+// ═══════════════════════════════════════════════════════════════════
+//                    MINIMALITY
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Check that every clue of a unique puzzle is necessary
+ * 
+ * A puzzle is minimal when removing any single clue leaves more than
+ * one solution. Each clue costs one countSolutionsExact() probe; the
+ * probes are shared out among @p threads workers, each on its own copy
+ * of the board, and the remaining probes are abandoned as soon as one
+ * worker finds a redundant clue.
+ * 
+ * @param[in] board Puzzle to check (not modified)
+ * @param[in] threads Worker threads (values below 1 mean 1; the
+ *                    calling thread is one of them)
+ * @return true if the puzzle has a unique solution and no clue can be
+ *         removed; false otherwise (including NULL and allocation
+ *         failure)
+ * 
+ * @note Worker threads release their scratch memory before exiting
+ * 
+ * Example:
+ * @code
+ * if (!sudoku_is_minimal(puzzle, 8)) {
+ *     reject_import(puzzle);
+ * }
+ * @endcode
+ * 
+ * @see sudoku_find_redundant_clues() to list the removable clues
+ */
+bool sudoku_is_minimal(const SudokuBoard *board, int threads);
+
+/**
+ * @brief List the clues whose removal keeps the solution unique
+ * 
+ * Same probes as sudoku_is_minimal(), but every clue is checked.
+ * Positions are reported in row-major order whatever the thread count.
+ * 
+ * @param[in] board Puzzle to check (not modified)
+ * @param[in] threads Worker threads (values below 1 mean 1)
+ * @param[out] redundant Receives up to @p capacity positions (may be
+ *                       NULL when capacity is 0)
+ * @param[in] capacity Size of @p redundant
+ * @return Number of redundant clues (0 = minimal; may exceed
+ *         @p capacity), or -1 if the puzzle does not have a unique
+ *         solution, on NULL input or on allocation failure
+ * 
+ * @note Each clue is judged on its own: removing two redundant clues
+ *       together may break uniqueness
+ */
+int sudoku_find_redundant_clues(const SudokuBoard *board, int threads,
+                                SudokuPosition *redundant, int capacity);
+
 #endif // SUDOKU_CORE_VALIDATION_H
@@ -85,11 +85,11 @@
  * @code
  * #include <sudoku/sudoku.h>
  * #include <stdio.h>
- * #include <time.h>
  * 
  * int main(void) {
- *     // Initialize random number generator (required for generation)
- *     srand((unsigned int)time(NULL));
+ *     // No seeding needed: each thread's generator seeds itself from the
+ *     // clock. sudoku_random_seed(42) would make the run reproducible;
+ *     // sudoku_generate_from_id() rebuilds one puzzle from its ID
  *     
  *     // Set verbosity level (0=minimal, 1=compact, 2=detailed)
  *     sudoku_set_verbosity(1);
@@ -236,6 +236,37 @@
  */
 #include <sudoku/core/display.h>
 
+/**
+ * Transform functions (digit relabelling, row/column/band permutations)
+ * Cheap way to turn one generated puzzle into many equivalent ones.
+ */
+#include <sudoku/core/transform.h>
+
+/**
+ * Grading functions (technique-based difficulty analysis)
+ * Solves like a human would and reports the hardest technique needed.
+ */
+#include <sudoku/core/grader.h>
+
+/**
+ * Batch solver (many puzzles propagated side by side)
+ * Bulk verification of puzzle packs: singles on 16 puzzles at once.
+ */
+#include <sudoku/core/batch.h>
+
+/**
+ * Arena allocator (per-puzzle memory regions)
+ * Lets batch workers reuse memory across puzzles without malloc/free.
+ */
+#include <sudoku/core/arena.h>
+
+/**
+ * Asynchronous event tracing (lock-free SPSC ring buffer)
+ * Records events with timestamps without stalling generation.
+ */
+#include <sudoku/core/trace.h>
+#include <sudoku/core/cancel.h>
+
 // ═══════════════════════════════════════════════════════════════════
 //                    FUTURE MODULES (NOT YET IMPLEMENTED)
 // ═══════════════════════════════════════════════════════════════════
@@ -13,6 +13,11 @@
 
 #include "../internal/generator_internal.h"
 #include "../internal/board_internal.h"
+#include "../internal/arena_internal.h"
+#include "../internal/interrupt_internal.h"
+#include "../internal/kernels_internal.h"
+#include "../internal/random_internal.h"
+#include "../internal/grid4_internal.h"
 #include "sudoku/core/validation.h"
 #include <stdlib.h>
 #include <assert.h>
@@ -37,7 +42,7 @@
  * @param size Number of elements in the array
  * 
  * @note This function has internal linkage (static) - only visible in this file
- * @note Requires that srand() has been called to seed the random generator
+ * @note Draws from the thread's generator (random_internal.h)
  * @note Time complexity: O(n) where n is the size of the array
  * @note Space complexity: O(1) - only uses a temporary variable for swapping
  */
@@ -47,7 +52,7 @@ static void shuffle_numbers(int *array, int size) {
     for(int i = size - 1; i > 0; i--) {
         // Generate a random index j where 0 <= j <= i
         // This ensures we only swap with elements in the unshuffled portion
-        int j = rand() % (i + 1);
+        int j = random_below(i + 1);
         
         // Perform the swap using the traditional three-assignment pattern
         // This is the clearest and most efficient way to swap on modern CPUs
@@ -57,6 +62,127 @@ static void shuffle_numbers(int *array, int size) {
     }
 }
 
+/**
+ * @brief Search-wide state shared by every recursion level
+ */
+typedef struct {
+    long budget;        ///< Nodes left (ignored when unlimited)
+    long nodes;         ///< Nodes visited so far
+    bool unlimited;     ///< No node budget
+    InterruptPoller interrupt;  ///< Cancellation / deadline polling
+    const SudokuKernels *kernels;  ///< Geometry kernels (NULL = generic)
+} FillSearch;
+
+/**
+ * @brief One level of the backtracking search
+ * 
+ * Each recursion level owns one board_size-wide slice of a frame buffer
+ * allocated ONCE by sudoku_complete_backtracking_budget(): level d uses
+ * frames[d * board_size .. (d+1) * board_size - 1] for its shuffled
+ * candidate list and hands frames + board_size to the next level.
+ * 
+ * Every call counts as one node. When the budget runs out, or the
+ * caller's token/deadline fires, the search unwinds with false,
+ * exactly like a dead end.
+ * 
+ * @param board Board being completed (modified in place)
+ * @param frames This level's slice of the frame buffer
+ * @param search Node counter and budget
+ * @return true if the board was completed from this state
+ */
+static bool complete_recursive(SudokuBoard *board, int *frames, FillSearch *search) {
+    // BUDGET: give up this attempt (the caller restarts with fresh randomness)
+    search->nodes++;
+    if(!search->unlimited && --search->budget < 0) {
+        return false;
+    }
+    if(interrupt_poller_tick(&search->interrupt)) {
+        return false;
+    }
+    
+    // Declare a position structure to store coordinates of empty cell
+    SudokuPosition pos;
+    
+    // BASE CASE: Try to find an empty cell in the board
+    // If no empty cells remain, the board is complete - we succeeded!
+    bool found = search->kernels != NULL
+               ? search->kernels->find_empty(board->cells[0], &pos)
+               : sudoku_find_empty_cell(board, &pos);
+    if(!found) {
+        return true;  // Success! Propagate true up the recursion
+    }
+    
+    // RECURSIVE CASE: We found an empty cell that needs to be filled
+    
+    // Candidate order for this level lives in its own frame slice:
+    // For 4×4: [1, 2, 3, 4]
+    // For 9×9: [1, 2, 3, 4, 5, 6, 7, 8, 9]
+    // For 16×16: [1, 2, 3, ..., 16]
+    int *numbers = frames;
+    for(int i = 0; i < board->board_size; i++) {
+        numbers[i] = i + 1;
+    }
+    
+    // Shuffle the numbers to create variety in generated boards
+    // Without this, we'd always try numbers in the same order (1,2,3...)
+    // which would produce identical boards every time
+    shuffle_numbers(numbers, board->board_size);
+    
+    for(int i = 0; i < board->board_size; i++) {
+        int num = numbers[i];
+        
+        // PRUNING: Check if this number violates any Sudoku rules
+        bool safe = search->kernels != NULL
+                  ? search->kernels->is_safe(board->cells[0], pos.row, pos.col, num)
+                  : sudoku_is_safe_position(board, &pos, num);
+        if(safe) {
+            // The number is valid! Place it tentatively in the cell
+            board_set_cell_fast(board, pos.row, pos.col, num);
+            
+            // RECURSION: the next level works in the next frame slice
+            if(complete_recursive(board, frames + board->board_size, search)) {
+                return true;  // Success! Let the recursion unwind
+            }
+            
+            // BACKTRACKING: this number eventually led to a dead end.
+            // Undo the choice and try a different number.
+            board_set_cell_fast(board, pos.row, pos.col, 0);
+            
+            // Out of budget (or interrupted): stop trying siblings as well
+            if((!search->unlimited && search->budget < 0) ||
+               search->interrupt.status != SUDOKU_STATUS_OK) {
+                return false;
+            }
+        }
+        // If the number wasn't safe, we simply skip to the next iteration
+    }
+    
+    // FAILURE CASE: We tried all numbers and none led to success
+    // Note: In our hybrid generator this is extremely rare because we
+    // start with valid diagonal subgrids, but we handle it correctly
+    return false;
+}
+
+/**
+ * @brief Complete a 4×4 board from the table of all its grids
+ *
+ * Picks uniformly among the grids that agree with the board, so it is
+ * as varied as the shuffled search and never dead-ends on a board that
+ * has a completion.
+ */
+static bool complete_from_table(SudokuBoard *board) {
+    int solution[GRID4_CELLS];
+    if(!grid4_random_completion(board->cells[0], solution)) {
+        return false;
+    }
+    for(int i = 0; i < GRID4_CELLS; i++) {
+        if(board->cells[i / 4][i % 4] == 0) {
+            board_set_cell_fast(board, i / 4, i % 4, solution[i]);
+        }
+    }
+    return true;
+}
+
 /**
  * @brief Completes a partially filled board using recursive backtracking
  * 
@@ -76,10 +202,12 @@ static void shuffle_numbers(int *array, int size) {
  * Without shuffling, the algorithm would be deterministic and always produce
  * identical boards for the same starting configuration.
  * 
- * CONFIGURABLE SIZE ADAPTATION:
- * This function now works with boards of any valid size (4×4, 9×9, 16×16, etc.)
- * by allocating the numbers array dynamically based on board->board_size.
- * This requires careful memory management to avoid leaks in the recursive calls.
+ * MEMORY STRATEGY:
+ * Earlier versions malloc'd a board_size array at EVERY recursion node
+ * (hundreds of thousands of allocator calls for one 16×16 fill). The
+ * recursion depth is bounded by the number of empty cells, so we now
+ * take one (empty + 1) × board_size frame buffer from the thread's
+ * scratch arena up front and release it when the search ends.
  *
  * @param board Pointer to the board to complete (WILL BE MODIFIED IN PLACE)
  * @return true if the board was successfully completed
@@ -91,100 +219,70 @@ static void shuffle_numbers(int *array, int size) {
  * @post If returns false, board is in an indeterminate partial state
  * 
  * @warning Recursive function - uses stack space proportional to empty cells
- * @warning Each recursive call allocates board_size integers on the heap
  * @note Maximum recursion depth bounded by number of empty cells (< board_size²)
  * @note Excellent average performance due to early pruning via validation
- * @note Memory usage: O(depth × board_size) where depth is recursion level
+ * @note Memory usage: O(depth × board_size), one arena allocation
  */
 bool sudoku_complete_backtracking(SudokuBoard *board) {
+    return sudoku_complete_backtracking_budget(board, 0, NULL, NULL);
+}
+
+/**
+ * @brief Backtracking completion with a node budget
+ * 
+ * Same search as sudoku_complete_backtracking(), but it gives up after
+ * @p node_budget recursion nodes. Heavy-tailed runs (a bad early choice
+ * that takes minutes to refute) are cut short; the caller restarts from
+ * fresh random diagonals instead of waiting for them.
+ * 
+ * @param board Board to complete (modified in place)
+ * @param node_budget Maximum recursion nodes (≤ 0 = unlimited)
+ * @param[out] nodes_used Nodes visited (may be NULL)
+ * @param interrupt Cancellation token / deadline, polled every
+ *                  SUDOKU_INTERRUPT_INTERVAL nodes (NULL = none)
+ * @return true if completed, false on dead end, budget exhaustion,
+ *         interruption or allocation failure (board left partially
+ *         filled); sudoku_interrupt_check() tells interruption apart
+ */
+bool sudoku_complete_backtracking_budget(SudokuBoard *board, long node_budget,
+                                         long *nodes_used,
+                                         const SudokuInterrupt *interrupt) {
     // Precondition validation: ensure we received a valid board pointer
     assert(board != NULL);
     assert(board->board_size > 0);
     
-    // Declare a position structure to store coordinates of empty cell
-    SudokuPosition pos;
-    
-    // BASE CASE: Try to find an empty cell in the board
-    // If no empty cells remain, the board is complete - we succeeded!
-    if(!sudoku_find_empty_cell(board, &pos)) {
-        return true;  // Success! Propagate true up the recursion
-    }
-    
-    // RECURSIVE CASE: We found an empty cell that needs to be filled
-    
-    // ✅ CHANGE 1: Dynamic allocation based on actual board size
-    // Instead of a fixed-size array, we allocate exactly what we need
-    // For a 4×4 board: allocate 4 ints (16 bytes)
-    // For a 9×9 board: allocate 9 ints (36 bytes)
-    // For a 16×16 board: allocate 16 ints (64 bytes)
-    int *numbers = malloc(board->board_size * sizeof(int));
-    
-    // Critical error handling: if malloc fails, we cannot continue
-    // This is rare but must be handled to prevent undefined behavior
-    if(numbers == NULL) {
-        // Memory allocation failed - return false to indicate failure
-        // The board state is unchanged, so this is safe
-        return false;
+    // 4×4: every grid is tabulated (grid4_internal.h), nothing to search.
+    // The lookup counts as the single node of the attempt
+    if(board->subgrid_size == 2) {
+        if(nodes_used != NULL) *nodes_used = 1;
+        return complete_from_table(board);
     }
     
-    // ✅ CHANGE 2: Fill array with numbers 1 to board_size (not hardcoded to 9)
-    // For 4×4: [1, 2, 3, 4]
-    // For 9×9: [1, 2, 3, 4, 5, 6, 7, 8, 9]
-    // For 16×16: [1, 2, 3, ..., 16]
+    // Depth bound: one level per empty cell, plus the final base case
+    int empty = 0;
     for(int i = 0; i < board->board_size; i++) {
-        numbers[i] = i + 1;
+        for(int j = 0; j < board->board_size; j++) {
+            if(board->cells[i][j] == 0) empty++;
+        }
     }
+    size_t frame_bytes = (size_t)(empty + 1) * board->board_size * sizeof(int);
     
-    // Shuffle the numbers to create variety in generated boards
-    // Without this, we'd always try numbers in the same order (1,2,3...)
-    // which would produce identical boards every time
-    shuffle_numbers(numbers, board->board_size);
+    SudokuArena *arena = arena_scratch();
+    SudokuArenaMark mark = sudoku_arena_mark(arena);
+    int *frames = (int*)sudoku_arena_alloc(arena, frame_bytes);
     
-    // ✅ CHANGE 3: Iterate up to board_size (not hardcoded SUDOKU_SIZE)
-    // This ensures we try all possible numbers for this board size
-    for(int i = 0; i < board->board_size; i++) {
-        int num = numbers[i];
-        
-        // PRUNING: Check if this number violates any Sudoku rules
-        // The validation functions have already been adapted to work with
-        // any board size, so this just works transparently
-        if(sudoku_is_safe_position(board, &pos, num)) {
-            // The number is valid! Place it tentatively in the cell
-            board->cells[pos.row][pos.col] = num;
-            
-            // RECURSION: Try to complete the rest of the board with this
-            // number in place. If the recursion returns true, we found
-            // a complete valid solution!
-            if(sudoku_complete_backtracking(board)) {
-                // ✅ CRITICAL: Free memory before returning success
-                // This is essential to prevent memory leaks
-                // Every malloc must have a corresponding free
-                free(numbers);
-                return true;  // Success! Let the recursion unwind
-            }
-            
-            // BACKTRACKING: If we reach here, recursion returned false,
-            // which means this number eventually led to a dead end.
-            // We need to undo this choice and try a different number.
-            // This undoing is what gives "backtracking" its name.
-            board->cells[pos.row][pos.col] = 0;
-            
-            // The loop continues to try the next number
-        }
-        // If the number wasn't safe, we simply skip to the next iteration
-        // This is implicit pruning - we never attempt invalid placements
+    // Critical error handling: without frames we cannot search
+    if(frames == NULL) {
+        if(nodes_used != NULL) *nodes_used = 0;
+        return false;
     }
     
-    // FAILURE CASE: We tried all numbers and none led to success
-    // This means the current board state has no valid completion
-    
-    // ✅ CRITICAL: Free memory before returning failure
-    // Even in failure cases, we must free allocated memory
-    // This ensures no leaks occur during backtracking
-    free(numbers);
+    FillSearch search = { node_budget, 0, node_budget <= 0, { 0 },
+                          sudoku_kernels_for(board->subgrid_size) };
+    interrupt_poller_init(&search.interrupt, interrupt);
+    bool solved = complete_recursive(board, frames, &search);
     
-    // Return false to trigger backtracking in our caller
-    // Note: In our hybrid generator this is extremely rare because we
-    // start with valid diagonal subgrids, but we handle it correctly
-    return false;
+    sudoku_arena_release(arena, mark);
+    if(nodes_used != NULL) *nodes_used = search.nodes;
+    return solved;
 }
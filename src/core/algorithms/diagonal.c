@@ -19,8 +19,9 @@
 #include "sudoku/core/board.h"
 #include "sudoku/core/types.h"
 #include "board_internal.h"
+#include "arena_internal.h"
+#include "random_internal.h"
 #include <stdlib.h>
-#include <time.h>
 #include <string.h>
 
 /**
@@ -52,7 +53,7 @@ static void shuffle_numbers(int *array, int size) {
     // This ensures uniform distribution of permutations
     for (int i = size - 1; i > 0; i--) {
         // Generate random index in range [0, i]
-        int j = rand() % (i + 1);
+        int j = random_below(i + 1);
         
         // Swap elements using XOR trick (only if indices differ)
         // XOR swap works because: a^a = 0 and a^0 = a
@@ -99,7 +100,10 @@ static void fill_single_diagonal_subgrid(SudokuBoard *board,
     // Allocate temporary array for the shuffled numbers
     // We need 'size' numbers (not subgrid_size²) because each cell
     // gets a value from 1 to size, and we need one value per cell
-    int *numbers = (int *)malloc(size * sizeof(int));
+    // (taken from the thread's scratch arena: no malloc per subgrid)
+    SudokuArena *arena = arena_scratch();
+    SudokuArenaMark mark = sudoku_arena_mark(arena);
+    int *numbers = (int *)sudoku_arena_alloc(arena, size * sizeof(int));
     if (numbers == NULL) {
         // In a production system, we'd propagate this error upward
         // For now, we return silently which leaves the subgrid unfilled
@@ -123,8 +127,8 @@ static void fill_single_diagonal_subgrid(SudokuBoard *board,
         }
     }
     
-    // Always free dynamically allocated memory to prevent leaks
-    free(numbers);
+    // Rewind the scratch arena (the arena equivalent of free)
+    sudoku_arena_release(arena, mark);
 }
 
 /**
@@ -171,13 +175,8 @@ void fillDiagonal(SudokuBoard *board) {
     // Ahora: usamos la función getter pública
     int subgrid_size = sudoku_board_get_subgrid_size(board);
     
-    // Initialize random number generator (thread-safe singleton pattern)
-    // We only seed once per program execution to avoid predictable patterns
-    static int seeded = 0;
-    if (!seeded) {
-        srand((unsigned int)time(NULL));
-        seeded = 1;
-    }
+    // No seeding here: the thread's generator seeds itself on first use,
+    // or was seeded on purpose (sudoku_random_seed(), generate_from_id)
     
     // Fill each diagonal subgrid
     // In subgrid coordinates, diagonal subgrids are at (0,0), (1,1), (2,2), ...
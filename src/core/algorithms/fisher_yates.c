@@ -1,6 +1,7 @@
 // src/core/algorithms/fisher_yates.c
 #include <stdlib.h>
 #include "../internal/algorithms_internal.h"
+#include "../internal/random_internal.h"
 
 void sudoku_generate_permutation(int *array, int size, int start) {
  // ═══════════════════════════════════════════════════════════════════
@@ -20,7 +21,7 @@ void sudoku_generate_permutation(int *array, int size, int start) {
     
     // Shuffle (Fisher-Yates backward)
     for(int i = size - 1; i > 0; i--) {
-        int j = rand() % (i + 1);
+        int j = random_below(i + 1);
         int temp = array[i];
         array[i] = array[j];
         array[j] = temp;
@@ -0,0 +1,45 @@
+/**
+ * @file pattern.c
+ * @brief Full-grid construction from the canonical shifted pattern
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * fillDiagonal() + sudoku_complete_backtracking() is a search, and on
+ * 25×25 boards it is a slow and often fruitless one. A valid full grid
+ * can instead be written down directly: row r is the sequence 1..n
+ * shifted by (r mod k)·k + r/k. Rows of the same band are shifted by
+ * different multiples of k, so their boxes never repeat a digit, and
+ * every row has a different shift, so no column does either.
+ *
+ * The pattern grid is then randomised with the validity-preserving
+ * transforms of transform.c (band, stack, row and column shuffles,
+ * digit relabelling, transpose and rotation). The result is valid by
+ * construction in O(n²), for any size up to 100×100.
+ *
+ * TRADE-OFF:
+ * Every grid produced this way is a transform of the same pattern, a
+ * tiny corner of all possible grids. Puzzles carved out of them are
+ * still unique and fine to play, but less varied than those from the
+ * backtracking fill; this filler is meant for boards where the search
+ * is the bottleneck.
+ */
+
+#include "sudoku/core/board.h"
+#include "sudoku/core/transform.h"
+#include "board_internal.h"
+
+bool fillPattern(SudokuBoard *board) {
+    const int n = board->board_size;
+    const int k = board->subgrid_size;
+    int *cells = board->cells[0];   // Rows are contiguous
+
+    for (int r = 0; r < n; r++) {
+        int shift = (r % k) * k + r / k;
+        for (int c = 0; c < n; c++) {
+            cells[r * n + c] = (shift + c) % n + 1;
+        }
+    }
+
+    // Also refreshes the clue counters and the hash
+    return sudoku_board_transform(board, SUDOKU_TRANSFORM_ALL);
+}
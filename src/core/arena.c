@@ -0,0 +1,256 @@
+/**
+ * @file arena.c
+ * @brief Block-based bump allocator and per-thread scratch arena
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * MEMORY LAYOUT:
+ *
+ *   arena → [block 0: header | used ........ | free ]
+ *           [block 1: header | used .. | free       ]  (only after growth)
+ *
+ * Allocation bumps @c used in the current block. When it does not fit,
+ * the allocator moves on to the next block (kept from an earlier
+ * growth) or appends a new one twice as large. sudoku_arena_reset()
+ * merges all blocks into one, so growth happens at most once per shape
+ * of work.
+ */
+
+#include "sudoku/core/arena.h"
+#include "internal/arena_internal.h"
+#include "internal/solution_cache_internal.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+
+/** @brief Capacity used when sudoku_arena_create() is given 0 */
+#define ARENA_DEFAULT_CAPACITY (64 * 1024)
+
+/** @brief Alignment of every allocation (suitable for any scalar type) */
+#define ARENA_ALIGN (_Alignof(max_align_t))
+
+// ═══════════════════════════════════════════════════════════════════
+//                    INTERNAL STRUCTURES
+// ═══════════════════════════════════════════════════════════════════
+
+typedef struct ArenaBlock {
+    struct ArenaBlock *next;    ///< Next block (allocated by a later growth)
+    size_t size;                ///< Usable bytes after the header
+    size_t used;                ///< Bytes handed out from this block
+} ArenaBlock;
+
+struct SudokuArena {
+    ArenaBlock *first;          ///< Head of the block list
+    ArenaBlock *current;        ///< Block serving allocations
+    size_t system_allocs;       ///< Blocks requested from malloc so far
+};
+
+static size_t align_up(size_t n) {
+    return (n + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+}
+
+/** @brief Header size rounded so that block data stays aligned */
+#define BLOCK_HEADER (align_up(sizeof(ArenaBlock)))
+
+static unsigned char *block_data(ArenaBlock *block) {
+    return (unsigned char*)block + BLOCK_HEADER;
+}
+
+static ArenaBlock *block_create(SudokuArena *arena, size_t size) {
+    ArenaBlock *block = (ArenaBlock*)malloc(BLOCK_HEADER + size);
+    if (block == NULL) {
+        fprintf(stderr, "Error: Failed to allocate %zu-byte arena block\n", size);
+        return NULL;
+    }
+    block->next = NULL;
+    block->size = size;
+    block->used = 0;
+    arena->system_allocs++;
+    return block;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    LIFECYCLE
+// ═══════════════════════════════════════════════════════════════════
+
+SudokuArena* sudoku_arena_create(size_t initial_capacity) {
+    SudokuArena *arena = (SudokuArena*)malloc(sizeof(SudokuArena));
+    if (arena == NULL) {
+        fprintf(stderr, "Error: Failed to allocate SudokuArena structure\n");
+        return NULL;
+    }
+
+    arena->system_allocs = 0;
+    arena->first = block_create(arena,
+        align_up(initial_capacity > 0 ? initial_capacity : ARENA_DEFAULT_CAPACITY));
+    if (arena->first == NULL) {
+        free(arena);
+        return NULL;
+    }
+    arena->current = arena->first;
+    return arena;
+}
+
+void sudoku_arena_destroy(SudokuArena *arena) {
+    if (arena == NULL) {
+        return;
+    }
+
+    ArenaBlock *block = arena->first;
+    while (block != NULL) {
+        ArenaBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    free(arena);
+}
+
+void sudoku_arena_reset(SudokuArena *arena) {
+    if (arena == NULL) {
+        return;
+    }
+
+    if (arena->first->next != NULL) {
+        // Coalesce: one block as large as everything we needed so far.
+        // If malloc fails we simply keep the existing chain.
+        ArenaBlock *merged = block_create(arena, sudoku_arena_capacity(arena));
+        if (merged != NULL) {
+            ArenaBlock *block = arena->first;
+            while (block != NULL) {
+                ArenaBlock *next = block->next;
+                free(block);
+                block = next;
+            }
+            arena->first = merged;
+        }
+    }
+
+    arena->first->used = 0;
+    arena->current = arena->first;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    ALLOCATION
+// ═══════════════════════════════════════════════════════════════════
+
+void* sudoku_arena_alloc(SudokuArena *arena, size_t size) {
+    if (arena == NULL) {
+        return NULL;
+    }
+
+    size = align_up(size > 0 ? size : 1);
+
+    // FAST PATH: bump inside the current block
+    ArenaBlock *block = arena->current;
+    if (size <= block->size - block->used) {
+        void *ptr = block_data(block) + block->used;
+        block->used += size;
+        return ptr;
+    }
+
+    // Reuse blocks left over from an earlier growth (stale after release)
+    while (block->next != NULL) {
+        block = block->next;
+        block->used = 0;
+        if (size <= block->size) {
+            arena->current = block;
+            block->used = size;
+            return block_data(block);
+        }
+    }
+
+    // GROW: append a block at least twice as large as the last one
+    size_t grow = block->size * 2;
+    ArenaBlock *fresh = block_create(arena, grow > size ? grow : size);
+    if (fresh == NULL) {
+        return NULL;
+    }
+    block->next = fresh;
+    arena->current = fresh;
+    fresh->used = size;
+    return block_data(fresh);
+}
+
+SudokuArenaMark sudoku_arena_mark(const SudokuArena *arena) {
+    SudokuArenaMark mark = { NULL, 0 };
+    if (arena != NULL) {
+        mark.block = arena->current;
+        mark.offset = arena->current->used;
+    }
+    return mark;
+}
+
+void sudoku_arena_release(SudokuArena *arena, SudokuArenaMark mark) {
+    if (arena == NULL || mark.block == NULL) {
+        return;
+    }
+    arena->current = (ArenaBlock*)mark.block;
+    arena->current->used = mark.offset;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    STATISTICS
+// ═══════════════════════════════════════════════════════════════════
+
+size_t sudoku_arena_used(const SudokuArena *arena) {
+    if (arena == NULL) {
+        return 0;
+    }
+
+    size_t used = 0;
+    for (ArenaBlock *block = arena->first; block != NULL; block = block->next) {
+        used += block->used;
+        if (block == arena->current) {
+            break;  // Blocks after current are stale
+        }
+    }
+    return used;
+}
+
+size_t sudoku_arena_capacity(const SudokuArena *arena) {
+    if (arena == NULL) {
+        return 0;
+    }
+
+    size_t capacity = 0;
+    for (ArenaBlock *block = arena->first; block != NULL; block = block->next) {
+        capacity += block->size;
+    }
+    return capacity;
+}
+
+size_t sudoku_arena_system_allocs(const SudokuArena *arena) {
+    return arena != NULL ? arena->system_allocs : 0;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    PER-THREAD SCRATCH ARENA
+// ═══════════════════════════════════════════════════════════════════
+
+/** @brief Library-owned arena, created on first use */
+static _Thread_local SudokuArena *thread_scratch = NULL;
+
+/** @brief Caller-provided arena overriding the scratch one (may be NULL) */
+static _Thread_local SudokuArena *thread_active = NULL;
+
+SudokuArena* arena_scratch(void) {
+    if (thread_active != NULL) {
+        return thread_active;
+    }
+    if (thread_scratch == NULL) {
+        thread_scratch = sudoku_arena_create(0);
+    }
+    return thread_scratch;
+}
+
+SudokuArena* arena_set_active(SudokuArena *arena) {
+    SudokuArena *previous = thread_active;
+    thread_active = arena;
+    return previous;
+}
+
+void sudoku_arena_thread_cleanup(void) {
+    sudoku_arena_destroy(thread_scratch);
+    thread_scratch = NULL;
+    solution_cache_thread_cleanup();
+}
@@ -0,0 +1,474 @@
+/**
+ * @file batch.c
+ * @brief Lane-parallel singles propagation over a batch of puzzles
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * LAYOUT (structure of arrays):
+ *
+ *   cand[cell * SUDOKU_BATCH_LANES + lane]   bit d-1 → digit d possible
+ *
+ * The 16 masks of one cell are 32 contiguous bytes: one LaneVec. Every
+ * propagation step is written once on LaneVec, so a step costs the
+ * same whether one lane or sixteen are live.
+ *
+ * PROPAGATION (until no lane changes), one pass = two sweeps:
+ *   1. per unit: OR of the solved cells' digits, digits seen exactly
+ *      once (once & ~twice), and solved digits seen twice (conflict)
+ *   2. per cell: drop the digits solved in its row, column or box
+ *      (naked singles) and, if it holds a digit that is hidden in one
+ *      of its units, keep only that digit (hidden singles)
+ *
+ * Both rules are sound, so when every cell of a lane holds one digit
+ * and the lane has no conflict, that lane is THE solution; a lane with
+ * an empty mask or a conflict has none.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "sudoku/core/batch.h"
+#include "sudoku/core/board.h"
+#include "sudoku/core/validation.h"
+#include "internal/algorithms_internal.h"
+#include "internal/arena_internal.h"
+#include "internal/logic_internal.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+/** @brief Largest board_size that fits the 16-bit lane masks */
+#define BATCH_MAX_SIZE 16
+
+// ═══════════════════════════════════════════════════════════════════
+//                    LANE VECTORS
+// ═══════════════════════════════════════════════════════════════════
+
+#if defined(__AVX2__)
+
+typedef __m256i LaneVec;
+
+static inline LaneVec lv_load(const uint16_t *p) { return _mm256_loadu_si256((const __m256i *)p); }
+static inline void lv_store(uint16_t *p, LaneVec v) { _mm256_storeu_si256((__m256i *)p, v); }
+static inline LaneVec lv_zero(void) { return _mm256_setzero_si256(); }
+static inline LaneVec lv_or(LaneVec a, LaneVec b) { return _mm256_or_si256(a, b); }
+static inline LaneVec lv_and(LaneVec a, LaneVec b) { return _mm256_and_si256(a, b); }
+static inline LaneVec lv_andnot(LaneVec a, LaneVec b) { return _mm256_andnot_si256(a, b); }
+static inline bool lv_any(LaneVec a) { return !_mm256_testz_si256(a, a); }
+
+/** @brief All-ones in the lanes that are zero */
+static inline LaneVec lv_eq_zero(LaneVec a) {
+    return _mm256_cmpeq_epi16(a, _mm256_setzero_si256());
+}
+
+/** @brief Lanes holding exactly one digit keep it, the rest become 0 */
+static inline LaneVec lv_single(LaneVec a) {
+    LaneVec below = _mm256_and_si256(a, _mm256_sub_epi16(a, _mm256_set1_epi16(1)));
+    return _mm256_and_si256(a, lv_eq_zero(below));
+}
+
+static inline bool lv_differs(LaneVec a, LaneVec b) {
+    LaneVec diff = _mm256_xor_si256(a, b);
+    return !_mm256_testz_si256(diff, diff);
+}
+
+#elif defined(__GNUC__) || defined(__clang__)
+
+/* Compiler vector extension: two 128-bit halves (SSE2 / NEON width) */
+typedef uint16_t LaneHalf __attribute__((vector_size(SUDOKU_BATCH_LANES)));
+typedef struct {
+    LaneHalf lo;
+    LaneHalf hi;
+} LaneVec;
+
+static inline LaneVec lv_make(LaneHalf lo, LaneHalf hi) { LaneVec v = { lo, hi }; return v; }
+static inline LaneVec lv_load(const uint16_t *p) { LaneVec v; memcpy(&v, p, sizeof(v)); return v; }
+static inline void lv_store(uint16_t *p, LaneVec v) { memcpy(p, &v, sizeof(v)); }
+static inline LaneVec lv_zero(void) { LaneHalf z = { 0 }; return lv_make(z, z); }
+static inline LaneVec lv_or(LaneVec a, LaneVec b) { return lv_make(a.lo | b.lo, a.hi | b.hi); }
+static inline LaneVec lv_and(LaneVec a, LaneVec b) { return lv_make(a.lo & b.lo, a.hi & b.hi); }
+static inline LaneVec lv_andnot(LaneVec a, LaneVec b) { return lv_make(~a.lo & b.lo, ~a.hi & b.hi); }
+
+static inline LaneVec lv_eq_zero(LaneVec a) {
+    LaneHalf z = { 0 };
+    return lv_make((LaneHalf)(a.lo == z), (LaneHalf)(a.hi == z));
+}
+
+static inline LaneVec lv_single(LaneVec a) {
+    LaneVec below = lv_make(a.lo & (a.lo - 1), a.hi & (a.hi - 1));
+    return lv_and(a, lv_eq_zero(below));
+}
+
+static inline bool lv_any(LaneVec a) {
+    uint64_t words[SUDOKU_BATCH_LANES / 4];
+    memcpy(words, &a, sizeof(words));
+    uint64_t any = 0;
+    for (int i = 0; i < SUDOKU_BATCH_LANES / 4; i++) {
+        any |= words[i];
+    }
+    return any != 0;
+}
+
+static inline bool lv_differs(LaneVec a, LaneVec b) {
+    return lv_any(lv_make(a.lo ^ b.lo, a.hi ^ b.hi));
+}
+
+#else
+
+typedef struct {
+    uint16_t lane[SUDOKU_BATCH_LANES];
+} LaneVec;
+
+#define LV_EACH for (int l = 0; l < SUDOKU_BATCH_LANES; l++)
+
+static inline LaneVec lv_load(const uint16_t *p) { LaneVec v; memcpy(v.lane, p, sizeof(v.lane)); return v; }
+static inline void lv_store(uint16_t *p, LaneVec v) { memcpy(p, v.lane, sizeof(v.lane)); }
+static inline LaneVec lv_zero(void) { LaneVec v; memset(&v, 0, sizeof(v)); return v; }
+static inline LaneVec lv_or(LaneVec a, LaneVec b) { LV_EACH a.lane[l] |= b.lane[l]; return a; }
+static inline LaneVec lv_and(LaneVec a, LaneVec b) { LV_EACH a.lane[l] &= b.lane[l]; return a; }
+static inline LaneVec lv_andnot(LaneVec a, LaneVec b) {
+    LV_EACH b.lane[l] &= (uint16_t)~a.lane[l];
+    return b;
+}
+
+static inline bool lv_any(LaneVec a) {
+    uint16_t any = 0;
+    LV_EACH any |= a.lane[l];
+    return any != 0;
+}
+
+static inline LaneVec lv_eq_zero(LaneVec a) {
+    LV_EACH a.lane[l] = (a.lane[l] == 0) ? 0xFFFF : 0;
+    return a;
+}
+
+static inline LaneVec lv_single(LaneVec a) {
+    LV_EACH a.lane[l] = (a.lane[l] & (a.lane[l] - 1)) ? 0 : a.lane[l];
+    return a;
+}
+
+static inline bool lv_differs(LaneVec a, LaneVec b) {
+    uint16_t diff = 0;
+    LV_EACH diff |= a.lane[l] ^ b.lane[l];
+    return diff != 0;
+}
+
+#undef LV_EACH
+
+#endif
+
+// ═══════════════════════════════════════════════════════════════════
+//                    BATCH STATE
+// ═══════════════════════════════════════════════════════════════════
+
+typedef struct {
+    int n;
+    int k;
+    int cells;
+    uint16_t full;
+    uint16_t *cand;         ///< cells * SUDOKU_BATCH_LANES masks
+    uint16_t *solved;       ///< 3n units * LANES: digits solved in the unit
+    uint16_t *hidden;       ///< 3n units * LANES: digits with one place left
+    uint16_t *conflict;     ///< LANES: non-zero once a unit repeats a digit
+    int *units;             ///< 3n * n cell indices (rows, columns, boxes)
+    int *unit_of;           ///< cells * 3: row, column and box unit of each cell
+} BatchLanes;
+
+static bool batch_lanes_init(BatchLanes *b, int k, SudokuArena *arena) {
+    const int n = k * k;
+    const size_t lanes = SUDOKU_BATCH_LANES;
+    b->n = n;
+    b->k = k;
+    b->cells = n * n;
+    b->full = (uint16_t)((1u << n) - 1);
+
+    b->cand = sudoku_arena_alloc(arena, sizeof(uint16_t) * lanes * (b->cells + 6 * n + 1));
+    b->units = sudoku_arena_alloc(arena, sizeof(int) * (3 * n * n + 3 * b->cells));
+    if (b->cand == NULL || b->units == NULL) {
+        return false;
+    }
+    b->solved = b->cand + lanes * b->cells;
+    b->hidden = b->solved + lanes * 3 * n;
+    b->conflict = b->hidden + lanes * 3 * n;
+    b->unit_of = b->units + 3 * n * n;
+
+    for (int u = 0; u < n; u++) {
+        int box_row = (u / k) * k;
+        int box_col = (u % k) * k;
+        for (int i = 0; i < n; i++) {
+            b->units[u * n + i] = u * n + i;
+            b->units[(n + u) * n + i] = i * n + u;
+            b->units[(2 * n + u) * n + i] = (box_row + i / k) * n + box_col + i % k;
+        }
+    }
+    for (int cell = 0; cell < b->cells; cell++) {
+        int r = cell / n, c = cell % n;
+        b->unit_of[cell * 3] = r;
+        b->unit_of[cell * 3 + 1] = n + c;
+        b->unit_of[cell * 3 + 2] = 2 * n + (r / k) * k + c / k;
+    }
+    return true;
+}
+
+/**
+ * @brief Load a board into one lane
+ *
+ * @return false if a value is out of range (the lane then has no
+ *         solution)
+ */
+static bool batch_load_lane(BatchLanes *b, int lane, const SudokuBoard *board) {
+    bool in_range = true;
+    for (int cell = 0; cell < b->cells; cell++) {
+        int v = board->cells[0][cell];
+        uint16_t mask = b->full;
+        if (v != 0) {
+            in_range = in_range && v > 0 && v <= b->n;
+            mask = in_range ? (uint16_t)(1u << (v - 1)) : 0;
+        }
+        b->cand[cell * SUDOKU_BATCH_LANES + lane] = mask;
+    }
+    return in_range;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    PROPAGATION
+// ═══════════════════════════════════════════════════════════════════
+
+#define LANE_SLOT(array, index) ((array) + (size_t)(index) * SUDOKU_BATCH_LANES)
+
+/**
+ * @brief Sweep 1: solved / hidden digits of every unit
+ */
+static void batch_summarise_units(BatchLanes *b) {
+    const int n = b->n;
+    LaneVec conflict = lv_load(b->conflict);
+    for (int u = 0; u < 3 * n; u++) {
+        const int *unit = b->units + u * n;
+
+        LaneVec once = lv_zero();
+        LaneVec twice = lv_zero();
+        LaneVec solved = lv_zero();
+        for (int i = 0; i < n; i++) {
+            LaneVec m = lv_load(LANE_SLOT(b->cand, unit[i]));
+            LaneVec single = lv_single(m);
+            conflict = lv_or(conflict, lv_and(solved, single));
+            solved = lv_or(solved, single);
+            twice = lv_or(twice, lv_and(once, m));
+            once = lv_or(once, m);
+        }
+        lv_store(LANE_SLOT(b->solved, u), solved);
+        lv_store(LANE_SLOT(b->hidden, u), lv_andnot(twice, once));
+    }
+    lv_store(b->conflict, conflict);
+}
+
+/**
+ * @brief Sweep 2: naked and hidden singles on every cell
+ *
+ * @return true if any lane of any cell changed
+ */
+static bool batch_narrow_cells(BatchLanes *b) {
+    bool changed = false;
+    for (int cell = 0; cell < b->cells; cell++) {
+        const int *units = b->unit_of + cell * 3;
+        uint16_t *slot = LANE_SLOT(b->cand, cell);
+        LaneVec current = lv_load(slot);
+
+        // A solved cell keeps its digit: its own unit masks contain it
+        LaneVec used = lv_or(lv_load(LANE_SLOT(b->solved, units[0])),
+                       lv_or(lv_load(LANE_SLOT(b->solved, units[1])),
+                             lv_load(LANE_SLOT(b->solved, units[2]))));
+        LaneVec next = lv_or(lv_andnot(used, current), lv_single(current));
+
+        LaneVec hidden = lv_or(lv_load(LANE_SLOT(b->hidden, units[0])),
+                         lv_or(lv_load(LANE_SLOT(b->hidden, units[1])),
+                               lv_load(LANE_SLOT(b->hidden, units[2]))));
+        LaneVec h = lv_and(next, hidden);
+        next = lv_or(h, lv_and(next, lv_eq_zero(h)));
+
+        if (lv_differs(next, current)) {
+            lv_store(slot, next);
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+static void batch_propagate(BatchLanes *b) {
+    memset(b->conflict, 0, sizeof(uint16_t) * SUDOKU_BATCH_LANES);
+    do {
+        batch_summarise_units(b);
+    } while (batch_narrow_cells(b));
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    SCALAR FALLBACK
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Count (and optionally extract) solutions of one board
+ *
+ * @param solution n*n values receiving the first solution, or NULL
+ * @return Solutions (≤ limit), -1 if the search gave up
+ */
+static int scalar_count(const SudokuBoard *board, int limit, int *solution) {
+    LogicState st;
+    if (!logic_state_init(&st, board)) {
+        logic_state_free(&st);
+        if (board->board_size <= LOGIC_MAX_BOARD_SIZE) {
+            return -1;  // Allocation failure
+        }
+        // Beyond the mask solver: plain backtracking on a copy
+        SudokuBoard *copy = sudoku_board_clone(board);
+        if (copy == NULL) {
+            return -1;
+        }
+        int found = countSolutionsExact(copy, limit);
+        if (found == 1 && solution != NULL) {
+            sudoku_complete_backtracking(copy);
+            memcpy(solution, copy->cells[0], sizeof(int) * copy->total_cells);
+        }
+        sudoku_board_destroy(copy);
+        return found;
+    }
+
+    st.solution = solution;
+    int found = logic_count_solutions(&st, limit);
+    bool aborted = st.aborted;
+    logic_state_free(&st);
+    return aborted ? -1 : found;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    DRIVER
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Decide one batch of up to SUDOKU_BATCH_LANES same-size boards
+ *
+ * @param writable Same boards, non-NULL to fill unique solutions in
+ */
+static bool batch_run_lanes(const SudokuBoard *const *boards, SudokuBoard *const *writable,
+                            int count, int limit, int *solutions, SudokuBatchStats *stats) {
+    SudokuArena *arena = arena_scratch();
+    SudokuArenaMark mark = sudoku_arena_mark(arena);
+
+    BatchLanes b;
+    SudokuBoard *scratch = NULL;
+    if (!batch_lanes_init(&b, boards[0]->subgrid_size, arena) ||
+        (scratch = sudoku_board_create_in_arena(arena, b.k)) == NULL) {
+        sudoku_arena_release(arena, mark);
+        return false;
+    }
+
+    bool loaded[SUDOKU_BATCH_LANES] = { false };
+    memset(b.cand, 0, sizeof(uint16_t) * b.cells * SUDOKU_BATCH_LANES);
+    for (int lane = 0; lane < count; lane++) {
+        loaded[lane] = batch_load_lane(&b, lane, boards[lane]);
+    }
+
+    batch_propagate(&b);
+    stats->batches++;
+
+    for (int lane = 0; lane < count; lane++) {
+        bool empty_mask = !loaded[lane] || b.conflict[lane] != 0;
+        bool all_single = true;
+        for (int cell = 0; cell < b.cells && !empty_mask; cell++) {
+            uint16_t m = b.cand[cell * SUDOKU_BATCH_LANES + lane];
+            empty_mask = (m == 0);
+            all_single = all_single && (m & (m - 1)) == 0;
+        }
+
+        int *solution = (writable != NULL) ? scratch->cells[0] : NULL;
+        if (empty_mask || all_single) {
+            stats->by_propagation++;
+            solutions[lane] = empty_mask ? 0 : 1;
+            for (int cell = 0; cell < b.cells && solution != NULL && !empty_mask; cell++) {
+                solution[cell] = logic_lowest_bit(b.cand[cell * SUDOKU_BATCH_LANES + lane]) + 1;
+            }
+        } else {
+            // Diverged: search from the singles propagation proved
+            stats->by_search++;
+            for (int cell = 0; cell < b.cells; cell++) {
+                uint16_t m = b.cand[cell * SUDOKU_BATCH_LANES + lane];
+                scratch->cells[0][cell] = (m & (m - 1)) ? 0 : logic_lowest_bit(m) + 1;
+            }
+            solutions[lane] = scalar_count(scratch, limit, solution);
+        }
+
+        if (solution != NULL && solutions[lane] == 1) {
+            memcpy(writable[lane]->cells[0], solution, sizeof(int) * b.cells);
+            sudoku_board_update_stats(writable[lane]);
+        }
+    }
+
+    sudoku_arena_release(arena, mark);
+    return true;
+}
+
+static bool batch_run(const SudokuBoard *const *boards, SudokuBoard *const *writable,
+                      int count, int limit, int *solutions, SudokuBatchStats *stats) {
+    if (boards == NULL || solutions == NULL || count < 0 || limit < 1) {
+        return false;
+    }
+    SudokuBatchStats local;
+    if (stats == NULL) {
+        stats = &local;
+    }
+    memset(stats, 0, sizeof(*stats));
+
+    int i = 0;
+    while (i < count) {
+        if (boards[i] == NULL) {
+            return false;
+        }
+        int k = boards[i]->subgrid_size;
+
+        if (boards[i]->board_size > BATCH_MAX_SIZE) {
+            int *solution = NULL;
+            SudokuArena *arena = arena_scratch();
+            SudokuArenaMark mark = sudoku_arena_mark(arena);
+            if (writable != NULL) {
+                solution = sudoku_arena_alloc(arena, sizeof(int) * boards[i]->total_cells);
+            }
+            solutions[i] = scalar_count(boards[i], limit, solution);
+            if (solution != NULL && solutions[i] == 1) {
+                memcpy(writable[i]->cells[0], solution, sizeof(int) * boards[i]->total_cells);
+                sudoku_board_update_stats(writable[i]);
+            }
+            sudoku_arena_release(arena, mark);
+            stats->by_search++;
+            stats->boards++;
+            i++;
+            continue;
+        }
+
+        // Consecutive boards of the same geometry share the lanes
+        int lanes = 1;
+        while (i + lanes < count && lanes < SUDOKU_BATCH_LANES &&
+               boards[i + lanes] != NULL && boards[i + lanes]->subgrid_size == k) {
+            lanes++;
+        }
+        if (!batch_run_lanes(boards + i, writable != NULL ? writable + i : NULL,
+                             lanes, limit, solutions + i, stats)) {
+            return false;
+        }
+        stats->boards += lanes;
+        i += lanes;
+    }
+    return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    PUBLIC API
+// ═══════════════════════════════════════════════════════════════════
+
+bool sudoku_batch_count_solutions(const SudokuBoard *const *boards, int count, int limit,
+                                  int *solutions, SudokuBatchStats *stats) {
+    return batch_run(boards, NULL, count, limit, solutions, stats);
+}
+
+bool sudoku_batch_solve(SudokuBoard *const *boards, int count,
+                        int *solutions, SudokuBatchStats *stats) {
+    return batch_run((const SudokuBoard *const *)boards, boards, count, 2, solutions, stats);
+}
@@ -23,125 +23,93 @@
  */
 
 #include "sudoku/core/board.h"
+#include "sudoku/core/arena.h"
 #include "internal/board_internal.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <assert.h>
+#include <string.h>
 
 // ═══════════════════════════════════════════════════════════════════
 //                    MEMORY MANAGEMENT
 // ═══════════════════════════════════════════════════════════════════
 
 /**
- * @brief Allocate the 2D dynamic array for cells
+ * @brief Bytes needed for a board of the given size, in one block
  * 
- * This helper function encapsulates the two-step allocation process
- * required for dynamic 2D arrays in C:
- * 
- * Step 1: Allocate array of row pointers
- * Step 2: For each row, allocate array of column values
+ * The structure, the row pointers and the cell values are laid out
+ * back to back in a SINGLE allocation:
  * 
  * MEMORY LAYOUT CREATED:
  * 
- * board->cells → [ptr_row0] → [cell][cell][cell]...[cell]
- *                [ptr_row1] → [cell][cell][cell]...[cell]
- *                [ptr_row2] → [cell][cell][cell]...[cell]
- *                ...
- *                [ptr_rowN] → [cell][cell][cell]...[cell]
+ * [SudokuBoard][ptr_row0][ptr_row1]...[ptr_rowN][row0 cells][row1 cells]...
+ *                  │         │                      ▲           ▲
+ *                  └─────────┼──────────────────────┘           │
+ *                            └──────────────────────────────────┘
+ * 
+ * WHY ONE BLOCK?
+ * The classic layout (one malloc per row) cost n+2 allocator calls per
+ * board and scattered the rows across the heap. With one block, a board
+ * costs one malloc (or zero, inside a SudokuArena), every row is
+ * adjacent to the next, and cells[0] addresses all n² values in
+ * row-major order - so copies and snapshots are a single memcpy.
  * 
- * WHY TWO STEPS?
- * Because C doesn't support variable-length 2D arrays natively. The
- * pointer-to-pointer approach gives us the same [][] syntax while
- * allowing runtime size determination.
+ * The cells[row][col] syntax is unchanged for client code.
  * 
- * @param board Board structure to allocate cells for
- * @param size Dimension of the board (both rows and columns)
- * @return true if allocation succeeded, false if malloc failed
+ * @param board_size Dimension of the board (both rows and columns)
+ * @return Bytes for struct + row pointers + values
  * 
- * @note On failure, no partial allocations remain (cleanup is performed)
- * @note Time complexity: O(n) where n = size
- * @note Memory allocated: size * sizeof(int*) + size * size * sizeof(int)
+ * @note sizeof(SudokuBoard) is a multiple of pointer alignment and
+ *       pointers are at least int-aligned, so no padding is needed
  */
-static bool allocate_cells(SudokuBoard *board, int size) {
-    // STEP 1: Allocate array of row pointers
-    // This creates space for 'size' pointers, each will point to a row
-    board->cells = (int**)malloc(size * sizeof(int*));
-    if (board->cells == NULL) {
-        // Allocation failed - probably out of memory
-        return false;
-    }
-    
-    // STEP 2: Allocate each individual row
-    // Each row is an array of 'size' integers
-    for (int i = 0; i < size; i++) {
-        board->cells[i] = (int*)malloc(size * sizeof(int));
-        if (board->cells[i] == NULL) {
-            // Allocation failed for this row
-            // CRITICAL: We must clean up the rows we already allocated
-            // to avoid memory leaks
-            
-            // Free all previously allocated rows
-            for (int j = 0; j < i; j++) {
-                free(board->cells[j]);
-            }
-            
-            // Free the row pointer array
-            free(board->cells);
-            board->cells = NULL;
-            
-            return false;
-        }
-    }
-    
-    // Success! All rows allocated successfully
-    return true;
+static size_t board_footprint(int board_size) {
+    return sizeof(SudokuBoard)
+         + (size_t)board_size * sizeof(int*)
+         + (size_t)board_size * board_size * sizeof(int);
 }
 
 /**
- * @brief Free the 2D dynamic array of cells
- * 
- * This function performs the inverse operation of allocate_cells().
- * It's CRITICAL that we free in the reverse order of allocation:
- * 
- * 1. Free each row (the arrays pointed to by row pointers)
- * 2. Free the array of row pointers itself
- * 
- * WHY THIS ORDER?
- * If we freed board->cells first, we'd lose the pointers to the
- * individual rows, making them unreachable and causing memory leaks.
- * 
- * MEMORY LEAK SCENARIO (WRONG ORDER):
- * 
- * free(board->cells);     // ← Lose row pointers!
- * // Now cells[0], cells[1], ... are orphaned in memory
- * // We have no way to free them → MEMORY LEAK
+ * @brief Carve a board out of a raw block of board_footprint() bytes
  * 
- * CORRECT ORDER (THIS FUNCTION):
+ * Sets the dimensions, points every row into the contiguous value
+ * area and clears the board.
  * 
- * for each row: free(cells[i]);  // ← Free each row
- * free(board->cells);             // ← Then free pointer array
- * 
- * @param board Board whose cells should be freed
- * 
- * @note Safe to call even if cells is NULL (does nothing)
- * @note After this call, board->cells is set to NULL for safety
+ * @param memory Block of at least board_footprint(subgrid_size²) bytes
+ * @param subgrid_size Size of subgrids (already validated)
+ * @param arena_owned Whether the block belongs to an arena
+ * @return The initialised board (same address as memory)
  */
-static void free_cells(SudokuBoard *board) {
-    if (board->cells == NULL) {
-        return;  // Nothing to free
-    }
+static SudokuBoard* board_layout(void *memory, int subgrid_size, bool arena_owned) {
+    SudokuBoard *board = (SudokuBoard*)memory;
+    
+    board->subgrid_size = subgrid_size;
+    board->board_size = subgrid_size * subgrid_size;
+    board->total_cells = board->board_size * board->board_size;
+    board->arena_owned = arena_owned;
+    board->zobrist = zobrist_table(subgrid_size);
     
-    // Free each row individually
-    // IMPORTANT: We use board->board_size, not a hardcoded value
+    board->cells = (int**)(board + 1);
+    int *values = (int*)(board->cells + board->board_size);
     for (int i = 0; i < board->board_size; i++) {
-        free(board->cells[i]);
+        board->cells[i] = values + (size_t)i * board->board_size;
     }
     
-    // Free the array of row pointers
-    free(board->cells);
-    
-    // Set to NULL to avoid double-free or use-after-free bugs
-    board->cells = NULL;
+    sudoku_board_init(board);
+    return board;
+}
+
+/**
+ * @brief Validate a requested subgrid size
+ */
+static bool valid_subgrid_size(int subgrid_size) {
+    // Valid Sudoku sizes: 2 (4×4), 3 (9×9), 4 (16×16), 5 (25×25)
+    // Larger sizes are theoretically valid but computationally expensive
+    if (subgrid_size < 2 || subgrid_size > 10) {
+        fprintf(stderr, "Error: Invalid subgrid size %d (valid: 2-5)\n", 
+                subgrid_size);
+        return false;
+    }
+    return true;
 }
 
 /**
@@ -151,10 +119,10 @@ static void free_cells(SudokuBoard *board) {
  * necessary memory and initializes the structure to represent an empty
  * board of the requested size.
  * 
- * ALLOCATION PERFORMED:
+ * ALLOCATION PERFORMED (one malloc, see board_footprint()):
  * 1. SudokuBoard structure itself: sizeof(SudokuBoard)
  * 2. Array of row pointers: board_size * sizeof(int*)
- * 3. Each row array: board_size * sizeof(int), repeated board_size times
+ * 3. Contiguous cell values: board_size² * sizeof(int)
  * 
  * TOTAL MEMORY: sizeof(SudokuBoard) + board_size * sizeof(int*) + 
  *               board_size² * sizeof(int)
@@ -175,42 +143,47 @@ static void free_cells(SudokuBoard *board) {
  */
 SudokuBoard* sudoku_board_create_size(int subgrid_size) {
     // VALIDATION: Check for valid subgrid size
-    // Valid Sudoku sizes: 2 (4×4), 3 (9×9), 4 (16×16), 5 (25×25)
-    // Larger sizes are theoretically valid but computationally expensive
-    if (subgrid_size < 2 || subgrid_size > 10) {
-        fprintf(stderr, "Error: Invalid subgrid size %d (valid: 2-5)\n", 
-                subgrid_size);
+    if (!valid_subgrid_size(subgrid_size)) {
         return NULL;
     }
     
-    // STEP 1: Allocate the board structure itself
-    SudokuBoard *board = (SudokuBoard*)malloc(sizeof(SudokuBoard));
-    if (board == NULL) {
-        fprintf(stderr, "Error: Failed to allocate SudokuBoard structure\n");
+    // Single allocation: struct + row pointers + values
+    int board_size = subgrid_size * subgrid_size;
+    void *memory = malloc(board_footprint(board_size));
+    if (memory == NULL) {
+        fprintf(stderr, "Error: Failed to allocate %dx%d board\n",
+                board_size, board_size);
         return NULL;
     }
     
-    // STEP 2: Calculate and store dimensions
-    // These calculations define the board geometry
-    board->subgrid_size = subgrid_size;
-    board->board_size = subgrid_size * subgrid_size;
-    board->total_cells = board->board_size * board->board_size;
-    
-    // STEP 3: Allocate the dynamic 2D array for cells
-    if (!allocate_cells(board, board->board_size)) {
-        // Allocation failed - free the board structure and return NULL
-        fprintf(stderr, "Error: Failed to allocate cells array for %dx%d board\n",
-                board->board_size, board->board_size);
-        free(board);
+    // Lay out rows and initialize the board to empty state
+    return board_layout(memory, subgrid_size, false);
+}
+
+/**
+ * @brief Create a board inside an arena
+ * 
+ * Same layout as sudoku_board_create_size(), but the block is bumped
+ * out of the arena instead of requested from malloc(). The board is
+ * reclaimed by sudoku_arena_reset()/sudoku_arena_destroy();
+ * sudoku_board_destroy() on it is a harmless no-op.
+ * 
+ * @param arena Arena to allocate from
+ * @param subgrid_size Size of subgrids (2-10)
+ * @return Pointer to the new empty board, or NULL on error
+ */
+SudokuBoard* sudoku_board_create_in_arena(SudokuArena *arena, int subgrid_size) {
+    if (arena == NULL || !valid_subgrid_size(subgrid_size)) {
         return NULL;
     }
     
-    // STEP 4: Initialize the board to empty state
-    // This sets all cells to 0 and updates statistics
-    sudoku_board_init(board);
+    int board_size = subgrid_size * subgrid_size;
+    void *memory = sudoku_arena_alloc(arena, board_footprint(board_size));
+    if (memory == NULL) {
+        return NULL;
+    }
     
-    // Success! Return the fully initialized board
-    return board;
+    return board_layout(memory, subgrid_size, true);
 }
 
 /**
@@ -234,13 +207,10 @@ SudokuBoard* sudoku_board_create(void) {
  * associated with the board, including the 2D cells array and the
  * board structure itself.
  * 
- * DEALLOCATION ORDER:
- * 1. Free each row of cells: free(cells[i])
- * 2. Free array of row pointers: free(cells)
- * 3. Free board structure: free(board)
- * 
- * This order is CRITICAL - we must free inner structures before
- * outer structures to avoid memory leaks.
+ * Because struct, row pointers and values share one block
+ * (see board_footprint()), a single free() releases everything.
+ * Boards created with sudoku_board_create_in_arena() are left alone:
+ * their memory belongs to the arena.
  * 
  * @param board Pointer to board to destroy (can be NULL)
  * 
@@ -256,10 +226,11 @@ void sudoku_board_destroy(SudokuBoard *board) {
         return;  // Nothing to destroy
     }
     
-    // Free the 2D cells array (handles NULL gracefully)
-    free_cells(board);
+    if (board->arena_owned) {
+        return;  // Reclaimed by sudoku_arena_reset()/destroy()
+    }
     
-    // Free the board structure itself
+    // Struct, row pointers and values are one block
     free(board);
     
     // Note: We don't set board to NULL here because we can't modify
@@ -267,6 +238,94 @@ void sudoku_board_destroy(SudokuBoard *board) {
     // sudoku_board_destroy(board); board = NULL;
 }
 
+// ═══════════════════════════════════════════════════════════════════
+//                    COPY, CLONE AND SNAPSHOT
+// ═══════════════════════════════════════════════════════════════════
+
+/*
+ * All four operations rely on the single-block layout: cells[0] is the
+ * start of n² consecutive values, so copying a whole board is ONE
+ * memcpy regardless of its size - no per-row loop.
+ */
+
+/**
+ * @brief Create an independent heap copy of a board
+ * 
+ * @param board Board to copy
+ * @return New heap board, or NULL on NULL input or allocation failure
+ */
+SudokuBoard* sudoku_board_clone(const SudokuBoard *board) {
+    if (board == NULL) {
+        return NULL;
+    }
+    
+    void *memory = malloc(board_footprint(board->board_size));
+    if (memory == NULL) {
+        fprintf(stderr, "Error: Failed to allocate board clone\n");
+        return NULL;
+    }
+    
+    // Lay out the rows of the new block (this also clears it), then copy
+    SudokuBoard *clone = board_layout(memory, board->subgrid_size, false);
+    sudoku_board_copy_into(clone, board);
+    return clone;
+}
+
+/**
+ * @brief Copy cells and statistics into a same-geometry board
+ * 
+ * @param dst Target board
+ * @param src Source board
+ * @return false on NULL input or mismatched geometry
+ */
+bool sudoku_board_copy_into(SudokuBoard *dst, const SudokuBoard *src) {
+    if (dst == NULL || src == NULL || dst->subgrid_size != src->subgrid_size) {
+        return false;
+    }
+    if (dst == src) {
+        return true;
+    }
+    
+    memcpy(dst->cells[0], src->cells[0], (size_t)src->total_cells * sizeof(int));
+    dst->clues = src->clues;
+    dst->empty = src->empty;
+    dst->hash = src->hash;
+    return true;
+}
+
+/**
+ * @brief Bytes needed by a snapshot: values + clues + empty
+ */
+size_t sudoku_board_snapshot_size(const SudokuBoard *board) {
+    assert(board != NULL);
+    return ((size_t)board->total_cells + 2) * sizeof(int);
+}
+
+/**
+ * @brief Save values and statistics into a caller buffer
+ */
+void sudoku_board_snapshot(const SudokuBoard *board, int *buffer) {
+    assert(board != NULL && buffer != NULL);
+    
+    memcpy(buffer, board->cells[0], (size_t)board->total_cells * sizeof(int));
+    buffer[board->total_cells] = board->clues;
+    buffer[board->total_cells + 1] = board->empty;
+}
+
+/**
+ * @brief Restore values and statistics from a snapshot
+ * 
+ * The snapshot format predates the hash, so it is recomputed here.
+ */
+void sudoku_board_restore(SudokuBoard *board, const int *buffer) {
+    assert(board != NULL && buffer != NULL);
+    
+    memcpy(board->cells[0], buffer, (size_t)board->total_cells * sizeof(int));
+    board->clues = buffer[board->total_cells];
+    board->empty = buffer[board->total_cells + 1];
+    board->hash = board_hash_from_cells(board);
+}
+
 // ═══════════════════════════════════════════════════════════════════
 //                    BOARD INITIALIZATION
 // ═══════════════════════════════════════════════════════════════════
@@ -282,6 +341,7 @@ void sudoku_board_destroy(SudokuBoard *board) {
  * 1. Set all cells to 0 (empty)
  * 2. Set clues = 0 (no filled cells)
  * 3. Set empty = total_cells (all cells empty)
+ * 4. Set hash to the empty-board hash of this geometry
  * 
  * @param board Pointer to board to initialize
  * 
@@ -308,6 +368,7 @@ void sudoku_board_init(SudokuBoard *board) {
     // Update statistics to reflect empty board
     board->clues = 0;
     board->empty = board->total_cells;
+    board->hash = zobrist_salt(board->subgrid_size);
 }
 
 /**
@@ -323,6 +384,7 @@ void sudoku_board_init(SudokuBoard *board) {
  * 3. Increment counter for each non-zero cell
  * 4. Set clues = counter
  * 5. Set empty = total_cells - counter
+ * 6. Recompute the Zobrist hash (cells may have been written directly)
  * 
  * @param board Pointer to board to update
  * 
@@ -351,6 +413,7 @@ void sudoku_board_update_stats(SudokuBoard *board) {
     // Update statistics
     board->clues = count;
     board->empty = board->total_cells - count;
+    board->hash = board_hash_from_cells(board);
 }
 
 // ═══════════════════════════════════════════════════════════════════
@@ -380,6 +443,7 @@ int sudoku_board_get_cell(const SudokuBoard *board, int row, int col) {
  * 
  * Updates the cell with bounds checking. Does NOT validate Sudoku rules
  * or automatically update statistics - those are separate operations.
+ * The Zobrist hash IS updated, in O(1) (see board_set_cell_fast()).
  * 
  * @param board Pointer to board to modify
  * @param row Row index (0 to board_size-1)
@@ -394,11 +458,37 @@ bool sudoku_board_set_cell(SudokuBoard *board, int row, int col, int value) {
     if (col < 0 || col >= board->board_size) return false;
     if (value < 0 || value > board->board_size) return false;
     
-    // Set the value
-    board->cells[row][col] = value;
+    // Set the value (and XOR it into the hash)
+    board_set_cell_fast(board, row, col, value);
     return true;
 }
 
+// ═══════════════════════════════════════════════════════════════════
+//                    STATE HASH
+// ═══════════════════════════════════════════════════════════════════
+
+uint64_t sudoku_board_get_hash(const SudokuBoard *board) {
+    assert(board != NULL);
+    return board->hash;
+}
+
+/**
+ * @brief Compare two boards cell by cell, hash first
+ * 
+ * Different hashes prove the boards differ, so most unequal pairs are
+ * rejected without touching the cells; equal hashes are confirmed with
+ * one memcmp (a 64-bit collision is possible, just very unlikely).
+ */
+bool sudoku_board_equals(const SudokuBoard *a, const SudokuBoard *b) {
+    if (a == NULL || b == NULL) {
+        return a == b;
+    }
+    if (a->subgrid_size != b->subgrid_size || a->hash != b->hash) {
+        return false;
+    }
+    return memcmp(a->cells[0], b->cells[0], (size_t)a->total_cells * sizeof(int)) == 0;
+}
+
 // ═══════════════════════════════════════════════════════════════════
 //                    STATISTICS ACCESS
 // ═══════════════════════════════════════════════════════════════════
@@ -0,0 +1,103 @@
+/**
+ * @file cancel.c
+ * @brief Cancellation tokens and deadline checks
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * A token is a single atomic flag: the cancelling thread stores it with
+ * release semantics and the searching thread polls it with a relaxed
+ * load every SUDOKU_INTERRUPT_INTERVAL nodes (nothing else is published
+ * through it, so no stronger ordering is needed on the hot side).
+ */
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L     // clock_gettime(), CLOCK_MONOTONIC
+#endif
+
+#include "sudoku/core/cancel.h"
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+
+struct SudokuCancelToken {
+    atomic_bool cancelled;
+};
+
+// ═══════════════════════════════════════════════════════════════════
+//                    CANCELLATION TOKENS
+// ═══════════════════════════════════════════════════════════════════
+
+SudokuCancelToken* sudoku_cancel_token_create(void) {
+    SudokuCancelToken *token = (SudokuCancelToken*)malloc(sizeof(SudokuCancelToken));
+    if (token == NULL) {
+        fprintf(stderr, "Error: Failed to allocate SudokuCancelToken\n");
+        return NULL;
+    }
+    atomic_init(&token->cancelled, false);
+    return token;
+}
+
+void sudoku_cancel_token_destroy(SudokuCancelToken *token) {
+    free(token);
+}
+
+void sudoku_cancel_token_cancel(SudokuCancelToken *token) {
+    if (token != NULL) {
+        atomic_store_explicit(&token->cancelled, true, memory_order_release);
+    }
+}
+
+bool sudoku_cancel_token_is_cancelled(const SudokuCancelToken *token) {
+    if (token == NULL) {
+        return false;
+    }
+    // C11 atomic loads take non-const pointers
+    SudokuCancelToken *t = (SudokuCancelToken*)token;
+    return atomic_load_explicit(&t->cancelled, memory_order_relaxed);
+}
+
+void sudoku_cancel_token_reset(SudokuCancelToken *token) {
+    if (token != NULL) {
+        atomic_store_explicit(&token->cancelled, false, memory_order_release);
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    DEADLINES
+// ═══════════════════════════════════════════════════════════════════
+
+uint64_t sudoku_clock_ns(void) {
+    struct timespec ts;
+#if defined(TIME_MONOTONIC)
+    if (timespec_get(&ts, TIME_MONOTONIC) != TIME_MONOTONIC) {
+        return 0;
+    }
+#elif defined(CLOCK_MONOTONIC)
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0) {
+        return 0;
+    }
+#else
+    if (timespec_get(&ts, TIME_UTC) != TIME_UTC) {
+        return 0;
+    }
+#endif
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+uint64_t sudoku_deadline_in_ms(uint64_t ms) {
+    return sudoku_clock_ns() + ms * 1000000ull;
+}
+
+SudokuStatus sudoku_interrupt_check(const SudokuInterrupt *interrupt) {
+    if (interrupt == NULL) {
+        return SUDOKU_STATUS_OK;
+    }
+    if (sudoku_cancel_token_is_cancelled(interrupt->cancel)) {
+        return SUDOKU_STATUS_CANCELLED;
+    }
+    if (interrupt->deadline_ns != 0 && sudoku_clock_ns() >= interrupt->deadline_ns) {
+        return SUDOKU_STATUS_DEADLINE_EXCEEDED;
+    }
+    return SUDOKU_STATUS_OK;
+}
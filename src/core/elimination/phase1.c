@@ -24,8 +24,9 @@
 #include <stdlib.h>
 #include "algorithms_internal.h"
 #include "elimination_internal.h"
-//#include "board_internal.h"
+#include "board_internal.h"
 #include "events_internal.h"
+#include "arena_internal.h"
 #include "sudoku/core/board.h"
 
 /**
@@ -60,6 +61,18 @@
  * Space Complexity: O(N) for the permutation array
  */
 int phase1Elimination(SudokuBoard *board, const int *index, int count) {
+    return phase1EliminationEx(board, index, count, SUDOKU_SYMMETRY_NONE);
+}
+
+/**
+ * @brief Phase 1 with an optional symmetric clue pattern
+ * 
+ * Without symmetry this is the classic Phase 1. With symmetry, the
+ * selected cell drags its orbit along: all of it is removed if every
+ * clue is forced, none of it otherwise (see symmetry.c).
+ */
+int phase1EliminationEx(SudokuBoard *board, const int *index, int count,
+                        SudokuSymmetry symmetry) {
     // Emit phase start event
     emit_event(SUDOKU_EVENT_PHASE1_START, board, 1, 0);
     
@@ -74,7 +87,10 @@ int phase1Elimination(SudokuBoard *board, const int *index, int count) {
     // 
     // RAZONAMIENTO: En un tablero N×N, los números válidos van de 1 a N.
     // Necesitamos espacio para N números en la permutación.
-    int *numbers = (int *)malloc(board_size * sizeof(int));
+    // El buffer sale del arena de trabajo del hilo (sin malloc)
+    SudokuArena *arena = arena_scratch();
+    SudokuArenaMark mark = sudoku_arena_mark(arena);
+    int *numbers = (int *)sudoku_arena_alloc(arena, board_size * sizeof(int));
     
     // Handle memory allocation failure gracefully
     if (numbers == NULL) {
@@ -111,12 +127,30 @@ int phase1Elimination(SudokuBoard *board, const int *index, int count) {
             // ✅ NOTA: Aquí mantenemos acceso directo a board->cells
             // porque estamos en código interno (elimination_internal).
             // Si fuera API pública, usaríamos sudoku_board_get_cell().
+            if (board->cells[pos.row][pos.col] == target_value
+                && symmetry != SUDOKU_SYMMETRY_NONE) {
+                // Symmetric pattern: the whole orbit goes, or nothing
+                SudokuPosition orbit[SYMMETRY_ORBIT_MAX];
+                int values[SYMMETRY_ORBIT_MAX];
+                int size = symmetry_orbit(board_size, symmetry, pos.row, pos.col, orbit);
+                if (symmetry_remove_orbit_if_forced(board, orbit, size, values) > 0) {
+                    for (int k = 0; k < size; k++) {
+                        if (values[k] != 0) {
+                            removed++;
+                            emit_event_cell(SUDOKU_EVENT_PHASE1_CELL_SELECTED, board, 1,
+                                            removed, orbit[k].row, orbit[k].col, values[k]);
+                        }
+                    }
+                }
+                break;
+            }
+            
             if (board->cells[pos.row][pos.col] == target_value) {
                 // Save value before removing (needed for event emission)
                 int removed_value = board->cells[pos.row][pos.col];
                 
                 // Remove the cell
-                board->cells[pos.row][pos.col] = 0;
+                board_set_cell_fast(board, pos.row, pos.col, 0);
                 removed++;
                 
                 // Emit cell selected event
@@ -128,9 +162,8 @@ int phase1Elimination(SudokuBoard *board, const int *index, int count) {
         }
     }
     
-    // ✅ CRÍTICO: Liberar memoria dinámica
-    // Olvidar este free() causa memory leak
-    free(numbers);
+    // ✅ CRÍTICO: Devolver el buffer al arena (orden LIFO)
+    sudoku_arena_release(arena, mark);
     
     // Emit phase complete event
     emit_event(SUDOKU_EVENT_PHASE1_COMPLETE, board, 1, removed);
@@ -33,9 +33,15 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <math.h>
+#include <stdint.h>
+#include <string.h>
 #include "algorithms_internal.h"
 #include "elimination_internal.h"
+#include "board_internal.h"
 #include "events_internal.h"
+#include "arena_internal.h"
+#include "logic_internal.h"
+#include "kernels_internal.h"
 #include "sudoku/core/validation.h"
 #include "sudoku/core/board.h"
 
@@ -69,6 +75,11 @@
  * @pre board->cells[pos->row][pos->col] == num (or temporarily 0)
  */
 bool hasAlternative(SudokuBoard *board, const SudokuPosition *pos, int num) {
+    const SudokuKernels *kernels = sudoku_kernels_for(board->subgrid_size);
+    if (kernels != NULL) {
+        return kernels->has_alternative(board->cells[0], pos->row, pos->col, num);
+    }
+    
     // ✅ ADAPTACIÓN 1: Obtener dimensiones dinámicas del tablero
     // ANTES: Usaba constantes SUDOKU_SIZE (9) y SUBGRID_SIZE (3)
     // AHORA: Consulta las dimensiones reales del tablero
@@ -152,6 +163,178 @@ bool hasAlternative(SudokuBoard *board, const SudokuPosition *pos, int num) {
     return alternatives > 0;
 }
 
+// ═══════════════════════════════════════════════════════════════════
+//                    INCREMENTAL MASK STATE
+// ═══════════════════════════════════════════════════════════════════
+
+/** @brief Largest board_size handled with 64-bit position masks */
+#define PHASE2_MASK_MAX_SIZE 64
+
+/**
+ * @brief Position bitsets that answer hasAlternative() in O(1)
+ * 
+ * hasAlternative() probes every empty peer with sudoku_is_safe_position(),
+ * i.e. O(n) probes of O(n) each per cell and O(n⁴) per round. Phase 2
+ * instead keeps "where is it / where is it free" bitsets, built once per
+ * round and updated in O(1) whenever a cell is cleared:
+ * 
+ *   row_empty[r]    bit c      → cell (r, c) is empty
+ *   col_empty[c]    bit r      → cell (r, c) is empty
+ *   box_empty[b]    bit i*k+j  → cell i,j of box b is empty
+ *   digit_rows[d]   bit r      → digit d is in row r
+ *   digit_cols[d]   bit c      → digit d is in column c
+ *   digit_boxes[d]  bit b      → digit d is in box b (row-major boxes)
+ *   digit_boxes_t[d] bit s*k+t → digit d is in box (band t, stack s)
+ * 
+ * Two lookup tables expand a k-bit mask into an n-bit mask:
+ * 
+ *   span[m]    bit i of m → bits i*k .. i*k+k-1   (a band, stack or box row)
+ *   stride[m]  bit j of m → bits j, j+k, j+2k...  (a box column)
+ * 
+ * so "every column covered by a box of this band that holds d" is one
+ * table lookup instead of a loop.
+ * 
+ * LIMITATION: boards up to 64×64; larger boards keep using
+ * hasAlternative().
+ */
+typedef struct {
+    int n;
+    int k;
+    uint64_t *row_empty;
+    uint64_t *col_empty;
+    uint64_t *box_empty;
+    uint64_t *digit_rows;       ///< n+1 entries, indexed by digit
+    uint64_t *digit_cols;
+    uint64_t *digit_boxes;
+    uint64_t *digit_boxes_t;
+    uint64_t *span;             ///< 1 << k entries
+    uint64_t *stride;           ///< 1 << k entries
+} Phase2Masks;
+
+/**
+ * @brief Build the masks from the current board (O(n²))
+ * 
+ * @return false if the arena could not provide the memory
+ */
+static bool phase2_masks_init(Phase2Masks *m, const SudokuBoard *board, SudokuArena *arena) {
+    const int n = board->board_size;
+    const int k = board->subgrid_size;
+    const size_t table = (size_t)1 << k;
+    
+    uint64_t *block = sudoku_arena_alloc(arena,
+        sizeof(uint64_t) * (3 * (size_t)n + 4 * ((size_t)n + 1) + 2 * table));
+    if (block == NULL) {
+        return false;
+    }
+    
+    m->n = n;
+    m->k = k;
+    m->row_empty = block;
+    m->col_empty = m->row_empty + n;
+    m->box_empty = m->col_empty + n;
+    m->digit_rows = m->box_empty + n;
+    m->digit_cols = m->digit_rows + (n + 1);
+    m->digit_boxes = m->digit_cols + (n + 1);
+    m->digit_boxes_t = m->digit_boxes + (n + 1);
+    m->span = m->digit_boxes_t + (n + 1);
+    m->stride = m->span + table;
+    memset(block, 0, sizeof(uint64_t) * (3 * (size_t)n + 4 * ((size_t)n + 1)));
+    
+    // Expansion tables: built incrementally from the lowest set bit
+    const uint64_t run = (1ULL << k) - 1;        // k consecutive bits
+    uint64_t comb = 0;                            // bits 0, k, 2k...
+    for (int i = 0; i < k; i++) {
+        comb |= 1ULL << (i * k);
+    }
+    m->span[0] = 0;
+    m->stride[0] = 0;
+    for (size_t mask = 1; mask < table; mask++) {
+        int low = logic_lowest_bit(mask);
+        m->span[mask] = m->span[mask & (mask - 1)] | (run << (low * k));
+        m->stride[mask] = m->stride[mask & (mask - 1)] | (comb << low);
+    }
+    
+    for (int r = 0; r < n; r++) {
+        for (int c = 0; c < n; c++) {
+            int d = board->cells[r][c];
+            int band = r / k, stack = c / k;
+            if (d == 0) {
+                m->row_empty[r] |= 1ULL << c;
+                m->col_empty[c] |= 1ULL << r;
+                m->box_empty[band * k + stack] |= 1ULL << ((r % k) * k + c % k);
+            } else {
+                m->digit_rows[d] |= 1ULL << r;
+                m->digit_cols[d] |= 1ULL << c;
+                m->digit_boxes[d] |= 1ULL << (band * k + stack);
+                m->digit_boxes_t[d] |= 1ULL << (stack * k + band);
+            }
+        }
+    }
+    
+    return true;
+}
+
+/**
+ * @brief Record that (row, col), which held digit d, is now empty (O(1))
+ */
+static void phase2_masks_clear(Phase2Masks *m, int row, int col, int d) {
+    const int k = m->k;
+    int band = row / k, stack = col / k;
+    
+    m->row_empty[row] |= 1ULL << col;
+    m->col_empty[col] |= 1ULL << row;
+    m->box_empty[band * k + stack] |= 1ULL << ((row % k) * k + col % k);
+    m->digit_rows[d] &= ~(1ULL << row);
+    m->digit_cols[d] &= ~(1ULL << col);
+    m->digit_boxes[d] &= ~(1ULL << (band * k + stack));
+    m->digit_boxes_t[d] &= ~(1ULL << (stack * k + band));
+}
+
+/**
+ * @brief Mask equivalent of hasAlternative()
+ * 
+ * Answers "if (row, col) were emptied, could d go in another empty cell
+ * of its row, column or box?". Emptying the cell removes d from all
+ * three of its units, so for each search the unit being searched AND
+ * the cell's own box/row/column are ignored as blockers:
+ * 
+ * ROW:  empty cells of the row, minus columns holding d, minus the
+ *       columns of OTHER boxes of this band holding d
+ * COL:  symmetric, with rows and the boxes of this stack
+ * BOX:  empty cells of the box, minus box rows whose board row holds d
+ *       (other than this row) and box columns likewise
+ * 
+ * @return true if at least one alternative position exists
+ */
+static bool phase2_masks_has_alternative(const Phase2Masks *m, int row, int col, int d) {
+    const int k = m->k;
+    const uint64_t low = (1ULL << k) - 1;
+    int band = row / k, stack = col / k;
+    int i = row % k, j = col % k;
+    
+    uint64_t band_boxes = (m->digit_boxes[d] >> (band * k)) & low & ~(1ULL << stack);
+    uint64_t row_free = m->row_empty[row] & ~m->digit_cols[d] & ~m->span[band_boxes];
+    if (row_free & ~(1ULL << col)) {
+        return true;
+    }
+    
+    uint64_t stack_boxes = (m->digit_boxes_t[d] >> (stack * k)) & low & ~(1ULL << band);
+    uint64_t col_free = m->col_empty[col] & ~m->digit_rows[d] & ~m->span[stack_boxes];
+    if (col_free & ~(1ULL << row)) {
+        return true;
+    }
+    
+    uint64_t box_rows = (m->digit_rows[d] >> (band * k)) & low & ~(1ULL << i);
+    uint64_t box_cols = (m->digit_cols[d] >> (stack * k)) & low & ~(1ULL << j);
+    uint64_t box_free = m->box_empty[band * k + stack]
+                      & ~m->span[box_rows] & ~m->stride[box_cols];
+    return (box_free & ~(1ULL << (i * k + j))) != 0;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    PHASE 2 DRIVER
+// ═══════════════════════════════════════════════════════════════════
+
 /**
  * @brief Phase 2: Remove numbers that have no alternative positions
  * 
@@ -170,14 +353,17 @@ bool hasAlternative(SudokuBoard *board, const SudokuPosition *pos, int num) {
  * 
  * TIME COMPLEXITY ANALYSIS:
  * 
- * For an N×N board with √N×√N subgrids:
- * - Outer loop: N subgrids (technically (N/√N)² = N subgrids)
- * - Inner loop: N cells per subgrid
- * - hasAlternative: O(3N) worst case = O(N)
- * - Total per round: O(N × N × N) = O(N³)
+ * For an N×N board with √N×√N subgrids (N ≤ 64, mask path):
+ * - Build Phase2Masks: O(N²) once per round
+ * - Outer loop: N subgrids × N cells per subgrid
+ * - Alternative test: a handful of 64-bit mask operations, O(1)
+ * - Clearing a cell: O(1) mask update
+ * - Total per round: O(N²)
  * 
- * Typical rounds: 3-5 before convergence
- * Total Phase 2: O(5 × N³) = O(N³)
+ * Boards larger than 64×64 fall back to hasAlternative(), O(N⁴) per round.
+ * 
+ * The visiting order and the "one removal per subgrid per round" rule
+ * are unchanged, so both paths remove exactly the same cells.
  * 
  * @param board Board with partially filled solution
  * @param index Array of subgrid indices to process
@@ -187,12 +373,34 @@ bool hasAlternative(SudokuBoard *board, const SudokuPosition *pos, int num) {
  * @note This function should be called in a loop until it returns 0
  */
 int phase2Elimination(SudokuBoard *board, const int *index, int count) {
+    return phase2EliminationEx(board, index, count, SUDOKU_SYMMETRY_NONE);
+}
+
+/**
+ * @brief Phase 2 with an optional symmetric clue pattern
+ * 
+ * With symmetry, a cell without alternative is removed with its whole
+ * orbit through symmetry_remove_orbit_if_forced(). An orbit that cannot
+ * go entirely is restored and the scan of the subgrid continues. This
+ * path tests alternatives on the board directly: restoring an orbit
+ * would otherwise need the position masks to be rolled back too.
+ */
+int phase2EliminationEx(SudokuBoard *board, const int *index, int count,
+                        SudokuSymmetry symmetry) {
     // Emit phase 2 start event
     emit_event(SUDOKU_EVENT_PHASE2_START, board, 2, 0);
     
     // ✅ ADAPTACIÓN: Obtener tamaño dinámico del tablero
     int board_size = sudoku_board_get_board_size(board);
     
+    // Estado incremental de máscaras (tableros ≤ 64×64)
+    SudokuArena *arena = arena_scratch();
+    SudokuArenaMark mark = sudoku_arena_mark(arena);
+    Phase2Masks masks = {0};
+    bool use_masks = symmetry == SUDOKU_SYMMETRY_NONE &&
+                     board_size <= PHASE2_MASK_MAX_SIZE &&
+                     phase2_masks_init(&masks, board, arena);
+    
     int removed = 0;
     
     // Process each subgrid in the order specified
@@ -211,10 +419,35 @@ int phase2Elimination(SudokuBoard *board, const int *index, int count) {
                 int num = board->cells[pos.row][pos.col];
                 
                 // Check if this number has NO alternatives
-                if (!hasAlternative(board, &pos, num)) {
+                bool alternative = use_masks
+                    ? phase2_masks_has_alternative(&masks, pos.row, pos.col, num)
+                    : hasAlternative(board, &pos, num);
+                
+                if (!alternative && symmetry != SUDOKU_SYMMETRY_NONE) {
+                    // Symmetric pattern: remove the orbit atomically
+                    SudokuPosition orbit[SYMMETRY_ORBIT_MAX];
+                    int values[SYMMETRY_ORBIT_MAX];
+                    int size = symmetry_orbit(board_size, symmetry, pos.row, pos.col, orbit);
+                    if (symmetry_remove_orbit_if_forced(board, orbit, size, values) == 0) {
+                        continue;   // Orbit restored: try the next cell
+                    }
+                    for (int k = 0; k < size; k++) {
+                        if (values[k] != 0) {
+                            removed++;
+                            emit_event_cell(SUDOKU_EVENT_PHASE2_CELL_SELECTED, board, 2,
+                                            removed, orbit[k].row, orbit[k].col, values[k]);
+                        }
+                    }
+                    break;
+                }
+                
+                if (!alternative) {
                     // Safe to remove: number can only go here
                     int removed_value = board->cells[pos.row][pos.col];
-                    board->cells[pos.row][pos.col] = 0;
+                    board_set_cell_fast(board, pos.row, pos.col, 0);
+                    if (use_masks) {
+                        phase2_masks_clear(&masks, pos.row, pos.col, removed_value);
+                    }
                     removed++;
                     
                     // Emit cell selected event
@@ -229,6 +462,8 @@ int phase2Elimination(SudokuBoard *board, const int *index, int count) {
         }
     }
     
+    sudoku_arena_release(arena, mark);
+    
     // Emit phase 2 complete event
     emit_event(SUDOKU_EVENT_PHASE2_COMPLETE, board, 2, removed);
     
@@ -263,8 +498,9 @@ int phase2Elimination(SudokuBoard *board, const int *index, int count) {
  *    - Total: 16 × 16 × 48 = 12,288 cell checks
  *    
  *    Scaling factor: approximately N³ where N = board_size
- *    This is acceptable because early exit optimizations reduce
- *    actual work significantly below worst-case bounds.
+ *    (each "cell check" is itself an O(N) safety test, so O(N⁴)).
+ *    That is why boards up to 64×64 now use Phase2Masks: one O(N²)
+ *    build per round and O(1) per cell afterwards.
  * 
  * 3. WHY IS THE MODULO OPERATION CORRECT?
  *    
@@ -38,9 +38,15 @@
 #include <stdlib.h>
 #include "algorithms_internal.h"
 #include "elimination_internal.h"
+#include "board_internal.h"
 #include "events_internal.h"
+#include "arena_internal.h"
+#include "random_internal.h"
+#include "logic_internal.h"
 #include "sudoku/core/validation.h"  // Provides countSolutionsExact() declaration
 #include "sudoku/core/board.h"
+#include "sudoku/core/generator.h"  // sudoku_evaluate_difficulty()
+#include "sudoku/core/grader.h"
 
 /*
  * ═══════════════════════════════════════════════════════════════════
@@ -100,7 +106,7 @@
  * @note The returned value is an upper bound; actual removals may be fewer
  *       if unique solution cannot be maintained.
  */
-static int calculate_phase3_target(const SudokuBoard *board) {
+int calculate_phase3_target(const SudokuBoard *board) {
     int board_size = sudoku_board_get_board_size(board);
     int total_cells = board_size * board_size;
     
@@ -141,11 +147,11 @@ static int calculate_phase3_target(const SudokuBoard *board) {
  *    phase3EliminationAuto() for automatic calculation
  * 
  * MEMORY MANAGEMENT:
- * - Allocates: board_size² × sizeof(SudokuPosition) bytes
+ * - Takes board_size² × sizeof(SudokuPosition) bytes from the scratch arena
  * - For 9×9: 81 × 8 = 648 bytes
  * - For 16×16: 256 × 8 = 2,048 bytes
  * - For 25×25: 625 × 8 = 5,000 bytes
- * - Must free() before returning to prevent memory leak
+ * - Released (arena rewind) before returning
  * 
  * SOLUTION VERIFICATION:
  * Uses countSolutionsExact() from validation.c to verify that removing
@@ -162,6 +168,405 @@ static int calculate_phase3_target(const SudokuBoard *board) {
  * @post Board has unique solution guaranteed
  */
 int phase3Elimination(SudokuBoard *board, int target) {
+    Phase3Config config = {
+        .max_removals = target,
+        .use_target_difficulty = false,
+        .target_difficulty = SUDOKU_EASY
+    };
+    return phase3EliminationEx(board, &config, NULL);
+}
+
+// ═══════════════════════════════════════════════════════════════
+//                    DIFFICULTY TARGETING
+// ═══════════════════════════════════════════════════════════════
+
+/**
+ * @brief Clue count at which a difficulty bucket is considered reached
+ * 
+ * Reuses the clue-percentage bands documented on SudokuDifficulty:
+ * EASY stops at 55% clues, MEDIUM at 43%, HARD and EXPERT at 31%.
+ * Technique level decides the bucket; this only tells Phase 3 when it
+ * has removed "enough" for that bucket.
+ */
+static int difficulty_clue_ceiling(int total_cells, SudokuDifficulty difficulty) {
+    double percentage;
+    switch (difficulty) {
+        case SUDOKU_EASY:   percentage = 0.55; break;
+        case SUDOKU_MEDIUM: percentage = 0.43; break;
+        default:            percentage = 0.31; break;
+    }
+    return (int)(total_cells * percentage + 0.5);
+}
+
+/**
+ * @brief Uniqueness check and grade in a single solver pass
+ * 
+ * The grader already counts solutions (exactly, by logic or by its
+ * bitmask search), so when targeting we ask it once instead of running
+ * countSolutionsExact() and then grading. Boards too large to grade
+ * fall back to the exact counter and the clue-count estimate.
+ * 
+ * @return true if the puzzle has exactly one solution
+ */
+static bool probe_graded(SudokuBoard *board, SudokuDifficulty *grade) {
+    SudokuGradeResult result;
+    if (sudoku_grade_puzzle(board, &result)) {
+        *grade = result.difficulty;
+        return result.solutions == 1;
+    }
+    if (countSolutionsExact(board, 2) != 1) {
+        return false;
+    }
+    *grade = sudoku_evaluate_difficulty(board);
+    return true;
+}
+
+// ═══════════════════════════════════════════════════════════════
+//                    CHEAP REMOVAL CERTIFICATES
+// ═══════════════════════════════════════════════════════════════
+
+/**
+ * @brief Count where @p value could go in each unit of an EMPTIED cell
+ * 
+ * @param[out] alternatives Other empty cells accepting @p value in the
+ *                          row [0], column [1] and subgrid [2]
+ * 
+ * @pre board->cells[pos->row][pos->col] == 0
+ */
+static void unit_alternatives(const SudokuBoard *board, const SudokuPosition *pos,
+                              int value, int alternatives[3]) {
+    int n = board->board_size;
+    int k = board->subgrid_size;
+    int box_row = (pos->row / k) * k;
+    int box_col = (pos->col / k) * k;
+    
+    alternatives[0] = alternatives[1] = alternatives[2] = 0;
+    for (int i = 0; i < n; i++) {
+        SudokuPosition in_row = { pos->row, i };
+        SudokuPosition in_col = { i, pos->col };
+        SudokuPosition in_box = { box_row + i / k, box_col + i % k };
+        
+        if (i != pos->col && board->cells[in_row.row][in_row.col] == 0 &&
+            sudoku_is_safe_position(board, &in_row, value)) {
+            alternatives[0]++;
+        }
+        if (i != pos->row && board->cells[in_col.row][in_col.col] == 0 &&
+            sudoku_is_safe_position(board, &in_col, value)) {
+            alternatives[1]++;
+        }
+        if ((in_box.row != pos->row || in_box.col != pos->col) &&
+            board->cells[in_box.row][in_box.col] == 0 &&
+            sudoku_is_safe_position(board, &in_box, value)) {
+            alternatives[2]++;
+        }
+    }
+}
+
+/**
+ * @brief Is @p value forced back into the emptied cell by a single?
+ * 
+ * If the removed value is a hidden single in one of its units, or a
+ * naked single in its cell, every solution of the reduced puzzle puts
+ * it back, so the reduced puzzle has exactly the solutions of the
+ * original one: still unique, no solver probe needed. This is the
+ * Phase 2 argument, applied per unit instead of to all three at once.
+ * 
+ * @pre board->cells[pos->row][pos->col] == 0 and the board was unique
+ *      with @p value in place
+ */
+static bool removal_is_forced(const SudokuBoard *board, const SudokuPosition *pos,
+                              int value) {
+    int alternatives[3];
+    unit_alternatives(board, pos, value, alternatives);
+    if (alternatives[0] == 0 || alternatives[1] == 0 || alternatives[2] == 0) {
+        return true;    // Hidden single
+    }
+    
+    for (int d = 1; d <= board->board_size; d++) {
+        if (d != value && sudoku_is_safe_position(board, pos, d)) {
+            return false;
+        }
+    }
+    return true;        // Naked single
+}
+
+/**
+ * @brief Does the reduced puzzle fall to naked and hidden singles?
+ * 
+ * Singles are sound deductions: if applying them alone completes the
+ * grid, every solution must be that grid, so the puzzle is unique and
+ * the removal can be kept without a search. This catches far more than
+ * removal_is_forced(), which only looks at the removed cell, and costs
+ * one propagation on the mask solver's scratch state (the board itself
+ * is not touched). When propagation stalls, the caller searches.
+ * 
+ * 4×4 boards skip it: their counter is a table lookup (grid4_internal.h).
+ * 
+ * @return true if singles solve the puzzle (certified unique)
+ */
+static bool solved_by_singles(const SudokuBoard *board) {
+    if (board->subgrid_size == 2) {
+        return false;
+    }
+    LogicState st;
+    bool solved = logic_state_init(&st, board) &&
+                  logic_propagate_singles(&st, NULL, NULL) && st.empty == 0;
+    logic_state_free(&st);
+    return solved;
+}
+
+// ═══════════════════════════════════════════════════════════════
+//                    COUNTEREXAMPLE CACHE
+// ═══════════════════════════════════════════════════════════════
+
+bool phase3_counterexamples_init(Phase3Counterexamples *cx, const SudokuBoard *grid,
+                                 SudokuArena *arena) {
+    int cells = grid->board_size * grid->board_size;
+    cx->solution = grid->cells[0];
+    cx->cells = cells;
+    cx->words = (cells + 63) / 64;
+    cx->count = 0;
+    cx->next = 0;
+    cx->masks = (uint64_t *)sudoku_arena_alloc(
+        arena, (size_t)PHASE3_COUNTEREXAMPLES_MAX * cx->words * sizeof(uint64_t));
+    cx->scratch = (int *)sudoku_arena_alloc(arena, (size_t)cells * sizeof(int));
+    return cx->masks != NULL && cx->scratch != NULL;
+}
+
+/**
+ * @brief Does a cached alternate still solve the puzzle on @p board?
+ * 
+ * It does when none of the cells where it differs from the grid holds
+ * a clue (the clues all agree with the grid). Each mask usually meets
+ * a clue within its first few bits.
+ */
+static bool counterexample_refutes(const Phase3Counterexamples *cx,
+                                   const SudokuBoard *board) {
+    const int *cells = board->cells[0];
+    for (int e = 0; e < cx->count; e++) {
+        const uint64_t *mask = cx->masks + (size_t)e * cx->words;
+        bool clue_inside = false;
+        for (int w = 0; w < cx->words && !clue_inside; w++) {
+            for (uint64_t m = mask[w]; m != 0; m &= m - 1) {
+                if (cells[w * 64 + logic_lowest_bit(m)] != 0) {
+                    clue_inside = true;
+                    break;
+                }
+            }
+        }
+        if (!clue_inside) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Look for a solution that does NOT put @p value at @p pos
+ * 
+ * The grid value is struck from the cell's candidates and the mask
+ * solver looks for one solution, written to cx->scratch. If the puzzle
+ * was unique with @p value in place, finding none proves the removal
+ * keeps it unique: this answers a single-clue probe and yields the
+ * counterexample in the same search.
+ * 
+ * @return 1 if found, 0 if none exists, -1 if unknown (4×4 table
+ *         lookups ignore candidates, boards above 64×64, node budget)
+ */
+static int find_alternate(Phase3Counterexamples *cx, const SudokuBoard *board,
+                          const SudokuPosition *pos, int value) {
+    if (board->subgrid_size == 2) {
+        return -1;
+    }
+    LogicState st;
+    if (!logic_state_init(&st, board)) {
+        return -1;
+    }
+    st.cand[pos->row * board->board_size + pos->col] &= ~((uint64_t)1 << (value - 1));
+    st.solution = cx->scratch;
+    int found = logic_count_solutions(&st, 1);
+    bool aborted = st.aborted;
+    logic_state_free(&st);
+    return aborted ? -1 : found;
+}
+
+/**
+ * @brief Add the alternate in cx->scratch as a difference mask
+ */
+static void store_alternate(Phase3Counterexamples *cx) {
+    uint64_t *mask = cx->masks + (size_t)cx->next * cx->words;
+    for (int w = 0; w < cx->words; w++) {
+        mask[w] = 0;
+    }
+    for (int i = 0; i < cx->cells; i++) {
+        if (cx->scratch[i] != cx->solution[i]) {
+            mask[i / 64] |= (uint64_t)1 << (i % 64);
+        }
+    }
+    cx->next = (cx->next + 1) % PHASE3_COUNTEREXAMPLES_MAX;
+    if (cx->count < PHASE3_COUNTEREXAMPLES_MAX) {
+        cx->count++;
+    }
+}
+
+/**
+ * @brief Uniqueness probe on the candidate-mask solver
+ * 
+ * Minimal mode probes boards far sparser than the classic target ever
+ * reaches, where countSolutionsExact()'s first-empty-cell search can
+ * take minutes. The grader's MRV search answers the same question in
+ * milliseconds.
+ * 
+ * With @p cx the same search also yields the counterexample: of the
+ * two solutions a non-unique count stops at, at least one is not the
+ * grid, and the search copies that one (LogicState::exclude).
+ * 
+ * @param cx Counterexample cache to record into (may be NULL)
+ * @return Solutions found, capped at 2; -1 for boards above 64×64 or
+ *         searches that exceed the node budget (the caller falls back
+ *         to countSolutionsExact())
+ */
+static int count_solutions_masked(SudokuBoard *board, Phase3Counterexamples *cx) {
+    LogicState st;
+    if (!logic_state_init(&st, board)) {
+        logic_state_free(&st);
+        return -1;
+    }
+    if (cx != NULL) {
+        st.solution = cx->scratch;
+        st.exclude = cx->solution;
+    }
+    int solutions = logic_count_solutions(&st, 2);
+    bool aborted = st.aborted;
+    bool copied = (cx != NULL && st.solution == NULL);
+    logic_state_free(&st);
+    if (aborted) {
+        return -1;
+    }
+    if (solutions > 1 && copied) {
+        store_alternate(cx);
+    }
+    return solutions;
+}
+
+/**
+ * @brief Minimal-mode probe order entry
+ */
+typedef struct {
+    SudokuPosition pos;
+    int score;          ///< Alternatives of the value in its three units
+    int order;          ///< Shuffled rank (random tie-break)
+} Phase3Candidate;
+
+/** @brief qsort(): most alternatives first, then shuffled order */
+static int compare_candidates(const void *a, const void *b) {
+    const Phase3Candidate *x = (const Phase3Candidate *)a;
+    const Phase3Candidate *y = (const Phase3Candidate *)b;
+    if (x->score != y->score) {
+        return y->score - x->score;
+    }
+    return x->order - y->order;
+}
+
+/**
+ * @brief Order the shuffled clues for minimal mode
+ * 
+ * Clues whose value has the most alternative places are probed first,
+ * while the board is still dense and a solver probe is cheap. Clues
+ * with few alternatives come last: by then many of them have become
+ * singles and are removed by removal_is_forced() without any probe.
+ */
+static void order_for_minimal(SudokuBoard *board, SudokuPosition *positions,
+                              int count, SudokuArena *arena) {
+    Phase3Candidate *candidates = (Phase3Candidate *)sudoku_arena_alloc(
+        arena, count * sizeof(Phase3Candidate));
+    if (candidates == NULL) {
+        return;     // Keep the shuffled order
+    }
+    
+    for (int i = 0; i < count; i++) {
+        SudokuPosition *pos = &positions[i];
+        int value = board->cells[pos->row][pos->col];
+        int alternatives[3];
+        
+        board->cells[pos->row][pos->col] = 0;
+        unit_alternatives(board, pos, value, alternatives);
+        board->cells[pos->row][pos->col] = value;
+        
+        candidates[i].pos = *pos;
+        candidates[i].score = alternatives[0] + alternatives[1] + alternatives[2];
+        candidates[i].order = i;
+    }
+    
+    qsort(candidates, count, sizeof(Phase3Candidate), compare_candidates);
+    for (int i = 0; i < count; i++) {
+        positions[i] = candidates[i].pos;
+    }
+}
+
+/**
+ * @brief Put back the clues of an orbit taken out for a probe
+ */
+static void restore_orbit(SudokuBoard *board, const SudokuPosition *orbit,
+                          int size, const int *values) {
+    for (int k = 0; k < size; k++) {
+        if (values[k] != 0) {
+            board_set_cell_fast(board, orbit[k].row, orbit[k].col, values[k]);
+        }
+    }
+}
+
+/**
+ * @brief Phase 3 with optional difficulty targeting and early abort
+ * 
+ * Without targeting this is exactly the classic Phase 3. With targeting
+ * every uniqueness-preserving removal is also graded (a few µs,
+ * computed by the same pass that checks uniqueness, see probe_graded()):
+ * 
+ * - Removals that make the puzzle HARDER than the target are undone
+ * - Once the grade equals the target AND the clue count is inside the
+ *   target's band, Phase 3 stops (no point removing more)
+ * - If the puzzle is already too hard before Phase 3 starts, or the
+ *   remaining candidates cannot bring the clue count down to the band
+ *   while the grade is still below target, the attempt is abandoned
+ *   immediately instead of probing every remaining cell
+ * 
+ * Grading is assumed monotone: removing clues never makes a puzzle
+ * easier. This holds for every technique the grader knows.
+ * 
+ * MINIMAL MODE (config->minimal, no targeting): max_removals is
+ * ignored and every clue is decided exactly once, in the order chosen
+ * by order_for_minimal(). Since a kept clue can never become removable
+ * later, a single pass yields a minimal puzzle. Probes use the mask
+ * solver (count_solutions_masked()).
+ * 
+ * PROBE SAVING (no targeting): removals certified by
+ * removal_is_forced(), or whose puzzle singles alone still solve
+ * (solved_by_singles()), skip the solver. They would have passed the
+ * probe anyway, so the removed cells are the same.
+ * 
+ * COUNTEREXAMPLES (config->counterexamples, any mode): a removal that a
+ * second solution found earlier on the same grid still satisfies is
+ * rejected without a probe. Probes run on the mask solver, which keeps
+ * the alternate it meets when the puzzle is not unique
+ * (count_solutions_masked()); in minimal mode a single-clue probe is
+ * find_alternate(). No rejection pays for a second search, so targeted
+ * probes, which go through the grader, only read the cache. Rejections
+ * are exact, so the removed cells are again the same.
+ * 
+ * SYMMETRY (config->symmetry): positions are orbit representatives and
+ * each decision removes or keeps the whole orbit with ONE probe (or one
+ * certificate, when every clue of the orbit is a single as it goes).
+ * The last orbit may overshoot max_removals by up to its size - 1.
+ * 
+ * INTERRUPTION (config->interrupt): checked before every probe and
+ * inside the exact solver. The probed cell is restored and the phase
+ * stops with PHASE3_INTERRUPTED; the board still has a unique solution.
+ */
+int phase3EliminationEx(SudokuBoard *board, const Phase3Config *config,
+                        Phase3Outcome *outcome) {
+    Phase3Outcome result = PHASE3_COMPLETED;
+    
     // Emit phase start event
     emit_event(SUDOKU_EVENT_PHASE3_START, board, 3, 0);
     
@@ -170,25 +575,34 @@ int phase3Elimination(SudokuBoard *board, int target) {
     int total_cells = board_size * board_size;
     
     // ✅ ADAPTACIÓN 2: Asignación dinámica basada en tamaño real
-    // ANTES: Position *positions = malloc(81 * sizeof(Position));
-    // AHORA: SudokuPosition *positions = malloc(total_cells * sizeof(SudokuPosition));
-    SudokuPosition *positions = (SudokuPosition *)malloc(total_cells * sizeof(SudokuPosition));
+    //    (desde el arena de trabajo: sin malloc por puzzle)
+    SudokuArena *arena = arena_scratch();
+    SudokuArenaMark mark = sudoku_arena_mark(arena);
+    SudokuPosition *positions = (SudokuPosition *)sudoku_arena_alloc(arena, total_cells * sizeof(SudokuPosition));
     
     if (positions == NULL) {
         fprintf(stderr, "Error: Failed to allocate memory for Phase 3\n");
+        if (outcome) *outcome = PHASE3_COMPLETED;
         return 0;
     }
     
     // Collect all positions that currently have numbers
+    // (with a symmetry, one representative per orbit)
+    const SudokuSymmetry symmetry = config->symmetry;
     int count = 0;
+    int clues = 0;
     
     // ✅ ADAPTACIÓN 3: Usar board_size para iterar
     for (int row = 0; row < board_size; row++) {
         for (int col = 0; col < board_size; col++) {
             if (board->cells[row][col] != 0) {
-                positions[count].row = row;
-                positions[count].col = col;
-                count++;
+                clues++;
+                if (symmetry == SUDOKU_SYMMETRY_NONE ||
+                    symmetry_is_representative(board_size, symmetry, row, col)) {
+                    positions[count].row = row;
+                    positions[count].col = col;
+                    count++;
+                }
             }
         }
     }
@@ -196,49 +610,183 @@ int phase3Elimination(SudokuBoard *board, int target) {
     // Shuffle positions for random removal order
     // This ensures different puzzles even from the same complete board
     for (int i = count - 1; i > 0; i--) {
-        int j = rand() % (i + 1);
+        int j = random_below(i + 1);
         SudokuPosition temp = positions[i];
         positions[i] = positions[j];
         positions[j] = temp;
     }
     
+    // Minimal mode: every clue gets exactly one decision. A clue that is
+    // kept stays necessary however many other clues are removed later
+    // (fewer clues can only add solutions), so one pass is minimal.
+    const bool minimal = config->minimal && !config->use_target_difficulty;
+    const int max_removals = minimal ? clues : config->max_removals;
+    if (minimal) {
+        order_for_minimal(board, positions, count, arena);
+    }
+    
     int removed = 0;
+    int unprobed = clues;       // Clues in orbits not decided yet
+    int probes = 0;
+    int probes_saved = 0;
+    int probes_refuted = 0;
+    Phase3Counterexamples *const cx = config->counterexamples;
+    
+    // Difficulty targeting state
+    const bool targeting = config->use_target_difficulty;
+    const SudokuDifficulty target = config->target_difficulty;
+    const int ceiling = difficulty_clue_ceiling(total_cells, target);
+    SudokuDifficulty grade = SUDOKU_EASY;
+    
+    if (targeting) {
+        if (!probe_graded(board, &grade) || grade > target) {
+            result = PHASE3_TARGET_UNREACHABLE;    // Too hard already
+        } else if (grade == target && clues <= ceiling) {
+            result = PHASE3_TARGET_REACHED;        // Nothing left to do
+        }
+    }
     
     // Try removing cells in random order until target reached
-    for (int i = 0; i < count && removed < target; i++) {
+    for (int i = 0; i < count && removed < max_removals
+                    && result == PHASE3_COMPLETED; i++) {
+        
+        if (sudoku_interrupt_check(config->interrupt) != SUDOKU_STATUS_OK) {
+            result = PHASE3_INTERRUPTED;
+            break;
+        }
+        
+        // Early abort: even removing every remaining candidate would not
+        // reach the clue band, and the grade is still below target
+        if (targeting && grade < target && clues - unprobed > ceiling) {
+            result = PHASE3_TARGET_UNREACHABLE;
+            break;
+        }
+        
         SudokuPosition *pos = &positions[i];
-        int temp = board->cells[pos->row][pos->col];
+        SudokuPosition orbit[SYMMETRY_ORBIT_MAX];
+        int values[SYMMETRY_ORBIT_MAX];
+        int size = symmetry_orbit(board_size, symmetry, pos->row, pos->col, orbit);
         
-        // Temporarily remove the cell
-        board->cells[pos->row][pos->col] = 0;
+        // Temporarily remove the cell (with symmetry, its whole orbit).
+        // The removal is certified while every clue, taken out in turn,
+        // leaves a single behind.
+        bool forced = !targeting;
+        int taken = 0;
+        int last = 0;
+        for (int k = 0; k < size; k++) {
+            values[k] = board->cells[orbit[k].row][orbit[k].col];
+            if (values[k] == 0) {
+                continue;
+            }
+            board_set_cell_fast(board, orbit[k].row, orbit[k].col, 0);
+            taken++;
+            last = k;
+            forced = forced && removal_is_forced(board, &orbit[k], values[k]);
+        }
+        unprobed -= taken;
+        if (taken == 0) {
+            continue;
+        }
         
         // CRITICAL CHECK: Does the puzzle still have exactly one solution?
         // countSolutionsExact (from validation.c) with limit=2 stops as soon
         // as it finds 2 solutions, providing an enormous performance boost.
-        if (countSolutionsExact(board, 2) == 1) {
+        // A removed single is certified without the solver (the grade
+        // may change though, so targeting always probes). One probe
+        // decides the whole orbit.
+        // A cached alternate that still fits refutes it outright.
+        SudokuDifficulty new_grade = grade;
+        bool keep;
+        int alternate;
+        int solutions;
+        if (cx != NULL && !forced && counterexample_refutes(cx, board)) {
+            probes_refuted++;
+            keep = false;
+        } else if (targeting) {
+            probes++;
+            keep = probe_graded(board, &new_grade) && new_grade <= target;
+        } else if (forced || solved_by_singles(board)) {
+            probes_saved++;
+            keep = true;
+        } else if (minimal && cx != NULL && taken == 1 &&
+                   (alternate = find_alternate(cx, board, &orbit[last], values[last])) >= 0) {
+            // The probe itself finds the counterexample
+            probes++;
+            keep = (alternate == 0);
+            if (alternate == 1) {
+                store_alternate(cx);
+            }
+        } else if ((minimal || cx != NULL) &&
+                   (solutions = count_solutions_masked(board, cx)) >= 0) {
+            // Records the counterexample it comes across
+            probes++;
+            keep = (solutions == 1);
+        } else if (minimal) {
+            probes++;
+            keep = countSolutionsExact(board, 2) == 1;
+        } else {
+            SudokuStatus status;
+            probes++;
+            keep = countSolutionsExactEx(board, 2, config->interrupt, &status) == 1;
+            if (status != SUDOKU_STATUS_OK) {
+                // Uniqueness unknown: put the clues back and stop
+                restore_orbit(board, orbit, size, values);
+                result = PHASE3_INTERRUPTED;
+                break;
+            }
+        }
+        
+        if (keep) {
             // Safe to remove: unique solution maintained
-            removed++;
+            grade = new_grade;
+            for (int k = 0; k < size; k++) {
+                if (values[k] == 0) {
+                    continue;
+                }
+                removed++;
+                clues--;
+                
+                // Emit cell removed event
+                emit_event_cell(SUDOKU_EVENT_PHASE3_CELL_REMOVED, board, 3,
+                                removed, orbit[k].row, orbit[k].col, values[k]);
+            }
             
-            // Emit cell removed event
-            emit_event_cell(SUDOKU_EVENT_PHASE3_CELL_REMOVED, board, 3,
-                            removed, pos->row, pos->col, temp);
+            if (targeting && grade == target && clues <= ceiling) {
+                result = PHASE3_TARGET_REACHED;
+            }
         } else {
-            // Multiple solutions detected: restore the cell
-            board->cells[pos->row][pos->col] = temp;
+            // Multiple solutions (or too hard): restore the cell(s)
+            restore_orbit(board, orbit, size, values);
             
             // Optionally emit cell kept event
-            emit_event_cell(SUDOKU_EVENT_PHASE3_CELL_KEPT, board, 3,
-                            removed, pos->row, pos->col, temp);
+            for (int k = 0; k < size; k++) {
+                if (values[k] != 0) {
+                    emit_event_cell(SUDOKU_EVENT_PHASE3_CELL_KEPT, board, 3,
+                                    removed, orbit[k].row, orbit[k].col, values[k]);
+                }
+            }
         }
     }
     
-    // ✅ CRÍTICO: Liberar memoria dinámica
-    // Olvidar este free() causa memory leak
-    free(positions);
+    // Ran out of candidates: technique level decides
+    if (targeting && result == PHASE3_COMPLETED) {
+        result = (grade == target) ? PHASE3_TARGET_REACHED
+                                   : PHASE3_TARGET_UNREACHABLE;
+    }
+    
+    // ✅ CRÍTICO: Devolver el buffer al arena (orden LIFO)
+    sudoku_arena_release(arena, mark);
+    
+    if (config->probes != NULL) {
+        config->probes->probes = probes;
+        config->probes->probes_saved = probes_saved;
+        config->probes->probes_refuted = probes_refuted;
+    }
     
     // Emit phase complete event
     emit_event(SUDOKU_EVENT_PHASE3_COMPLETE, board, 3, removed);
     
+    if (outcome) *outcome = result;
     return removed;
 }
 
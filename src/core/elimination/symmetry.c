@@ -0,0 +1,115 @@
+/**
+ * @file symmetry.c
+ * @brief Cell orbits for symmetric clue patterns
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * A symmetric puzzle is one whose set of clue positions is invariant
+ * under a geometric map (half turn, quarter turn, reflection). The
+ * elimination phases keep that invariant by treating each ORBIT - a
+ * cell together with all its images - as the unit of removal: either
+ * every clue of the orbit goes, or none does.
+ *
+ * Because a completed board is full, and every phase removes whole
+ * orbits, every orbit is always entirely filled or entirely empty.
+ *
+ * SAFETY OF AN ORBIT REMOVAL WITHOUT THE SOLVER:
+ * Clues are removed one at a time. If each clue, at the moment it is
+ * removed, has no alternative position in its row, column and subgrid,
+ * the board after that step still has a unique solution (the clue is
+ * forced back by a hidden single). By induction the whole orbit can go.
+ */
+
+#include <stdbool.h>
+#include "elimination_internal.h"
+#include "board_internal.h"
+#include "sudoku/core/board.h"
+
+// ═══════════════════════════════════════════════════════════════
+//                    ORBITS
+// ═══════════════════════════════════════════════════════════════
+
+/**
+ * @brief Image of (row, col) under one application of the symmetry
+ */
+static SudokuPosition symmetry_image(int n, SudokuSymmetry symmetry, int row, int col) {
+    SudokuPosition image = { row, col };
+    switch (symmetry) {
+        case SUDOKU_SYMMETRY_ROTATE_180:
+            image.row = n - 1 - row;
+            image.col = n - 1 - col;
+            break;
+        case SUDOKU_SYMMETRY_ROTATE_90:
+            image.row = col;
+            image.col = n - 1 - row;
+            break;
+        case SUDOKU_SYMMETRY_DIAGONAL:
+            image.row = col;
+            image.col = row;
+            break;
+        case SUDOKU_SYMMETRY_MIRROR_HORIZONTAL:
+            image.row = n - 1 - row;
+            break;
+        case SUDOKU_SYMMETRY_MIRROR_VERTICAL:
+            image.col = n - 1 - col;
+            break;
+        case SUDOKU_SYMMETRY_NONE:
+        default:
+            break;
+    }
+    return image;
+}
+
+int symmetry_orbit(int board_size, SudokuSymmetry symmetry, int row, int col,
+                   SudokuPosition orbit[SYMMETRY_ORBIT_MAX]) {
+    orbit[0].row = row;
+    orbit[0].col = col;
+    int size = 1;
+
+    // Every supported map generates a cyclic group of order ≤ 4: apply
+    // it until we are back at the start
+    SudokuPosition next = symmetry_image(board_size, symmetry, row, col);
+    while ((next.row != row || next.col != col) && size < SYMMETRY_ORBIT_MAX) {
+        orbit[size++] = next;
+        next = symmetry_image(board_size, symmetry, next.row, next.col);
+    }
+    return size;
+}
+
+bool symmetry_is_representative(int board_size, SudokuSymmetry symmetry, int row, int col) {
+    SudokuPosition orbit[SYMMETRY_ORBIT_MAX];
+    int size = symmetry_orbit(board_size, symmetry, row, col, orbit);
+    int index = row * board_size + col;
+    for (int i = 1; i < size; i++) {
+        if (orbit[i].row * board_size + orbit[i].col < index) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ═══════════════════════════════════════════════════════════════
+//                    ORBIT REMOVAL
+// ═══════════════════════════════════════════════════════════════
+
+int symmetry_remove_orbit_if_forced(SudokuBoard *board, const SudokuPosition *orbit,
+                                    int size, int *values) {
+    int removed = 0;
+    for (int i = 0; i < size; i++) {
+        const SudokuPosition *pos = &orbit[i];
+        values[i] = board->cells[pos->row][pos->col];
+        if (values[i] == 0) {
+            continue;
+        }
+        if (hasAlternative(board, pos, values[i])) {
+            // Not forced: put back what this orbit already lost
+            for (int j = 0; j < i; j++) {
+                board_set_cell_fast(board, orbit[j].row, orbit[j].col, values[j]);
+            }
+            return 0;
+        }
+        board_set_cell_fast(board, pos->row, pos->col, 0);
+        removed++;
+    }
+    return removed;
+}
@@ -6,19 +6,30 @@
 #include "internal/events_internal.h"
 #include <stddef.h>
 
-// Global state for event system (private to this module)
-static SudokuEventCallback g_callback = NULL;
-static void *g_user_data = NULL;
+// Event system state (private to this module). Thread-local like the
+// arena and the RNG: each generation installs its own callback, so
+// generations running on different threads never see each other's.
+static _Thread_local SudokuEventCallback g_callback = NULL;
+static _Thread_local void *g_user_data = NULL;
 
-void events_init(SudokuEventCallback callback, void *user_data) {
+_Thread_local uint64_t events_subscribed = 0;
+
+void events_init(SudokuEventCallback callback, void *user_data, uint64_t mask) {
     g_callback = callback;
     g_user_data = user_data;
+    
+    // No callback means nobody is subscribed, whatever the mask says
+    if (callback == NULL) {
+        events_subscribed = 0;
+    } else {
+        events_subscribed = (mask != 0) ? mask : SUDOKU_EVENT_MASK_ALL;
+    }
 }
 
-void emit_event(SudokuEventType type,
-                const SudokuBoard *board,
-                int phase,
-                int cells_removed) {
+void events_emit(SudokuEventType type,
+                 const SudokuBoard *board,
+                 int phase,
+                 int cells_removed) {
     // If no callback registered, do nothing (zero overhead)
     if (g_callback == NULL) {
         return;
@@ -40,13 +51,13 @@ void emit_event(SudokuEventType type,
     g_callback(&event, g_user_data);
 }
 
-void emit_event_cell(SudokuEventType type,
-                     const SudokuBoard *board,
-                     int phase,
-                     int cells_removed,
-                     int row,
-                     int col,
-                     int value) {
+void events_emit_cell(SudokuEventType type,
+                      const SudokuBoard *board,
+                      int phase,
+                      int cells_removed,
+                      int row,
+                      int col,
+                      int value) {
     // If no callback registered, do nothing
     if (g_callback == NULL) {
         return;
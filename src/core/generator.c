@@ -34,12 +34,16 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include "sudoku/core/generator.h"
+#include "sudoku/core/grader.h"
 #include "sudoku/core/board.h"
 #include "sudoku/core/types.h"
 #include "internal/board_internal.h"
 #include "internal/algorithms_internal.h"
 #include "internal/elimination_internal.h"
 #include "internal/events_internal.h"
+#include "internal/arena_internal.h"
+#include "internal/interrupt_internal.h"
+#include "internal/random_internal.h"
 
 // ═══════════════════════════════════════════════════════════════════
 //                    FORWARD DECLARATIONS (PRIVATE)
@@ -51,9 +55,9 @@
  * This is the EXISTING v2.2.1 algorithm extracted into a separate function.
  * Maintains 100% backward compatibility with previous versions.
  */
-static bool generate_classic(SudokuBoard *board,
-                            const SudokuGenerationConfig *config,
-                            SudokuGenerationStats *stats);
+static SudokuStatus generate_classic(SudokuBoard *board,
+                                     const SudokuGenerationConfig *config,
+                                     SudokuGenerationStats *stats);
 
 /**
  * @brief Generate puzzle using AC3HB algorithm (NEW in v3.0)
@@ -64,9 +68,9 @@ static bool generate_classic(SudokuBoard *board,
  * @note Currently delegates to generate_classic()
  * @todo Implement full AC3HB path (Week 3 of roadmap)
  */
-static bool generate_with_ac3hb(SudokuBoard *board,
-                               const SudokuGenerationConfig *config,
-                               SudokuGenerationStats *stats);
+static SudokuStatus generate_with_ac3hb(SudokuBoard *board,
+                                        const SudokuGenerationConfig *config,
+                                        SudokuGenerationStats *stats);
 
 // ═══════════════════════════════════════════════════════════════════
 //                    PUBLIC API IMPLEMENTATION
@@ -90,6 +94,18 @@ static bool generate_with_ac3hb(SudokuBoard *board,
 bool sudoku_generate_ex(SudokuBoard *board,
                         const SudokuGenerationConfig *config,
                         SudokuGenerationStats *stats) {
+    return sudoku_generate_with_status(board, config, stats) == SUDOKU_STATUS_OK;
+}
+
+/**
+ * @brief sudoku_generate_ex() reporting why it stopped
+ * 
+ * Holds the dispatcher; the returned status also lands in
+ * stats->status so callers of sudoku_generate_ex() can read it.
+ */
+SudokuStatus sudoku_generate_with_status(SudokuBoard *board,
+                                         const SudokuGenerationConfig *config,
+                                         SudokuGenerationStats *stats) {
     
     // ═══════════════════════════════════════════════════════════════
     // ✨ NEW v3.0.2: ALGORITHM PATH SELECTION
@@ -117,15 +133,165 @@ bool sudoku_generate_ex(SudokuBoard *board,
      * sudoku_generate_ex(&board, &config, &stats);
      */
     
+    /*
+     * SCRATCH MEMORY: every internal buffer of this generation comes
+     * from one arena - the caller's (config->arena) or this thread's
+     * default one - and is rewound when generation ends, so repeated
+     * calls reuse the same memory without touching malloc().
+     */
+    SudokuArena *previous_arena = NULL;
+    bool caller_arena = (config != NULL && config->arena != NULL);
+    if (caller_arena) {
+        previous_arena = arena_set_active(config->arena);
+    }
+    SudokuArena *arena = arena_scratch();
+    SudokuArenaMark mark = sudoku_arena_mark(arena);
+    
+    SudokuStatus status;
     if (config != NULL && config->use_ac3) {
         // ✨ NEW: AC3HB generation path
         // Expected speedup: 30-60× for large boards
-        return generate_with_ac3hb(board, config, stats);
+        status = generate_with_ac3hb(board, config, stats);
     } else {
         // ✅ EXISTING: Classic Fisher-Yates + Backtracking
         // 100% backward compatible
-        return generate_classic(board, config, stats);
+        status = generate_classic(board, config, stats);
+    }
+    
+    sudoku_arena_release(arena, mark);
+    if (caller_arena) {
+        arena_set_active(previous_arena);
+    }
+    if (stats) {
+        stats->status = status;
     }
+    return status;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    BOARD FILL WITH RESTARTS
+// ═══════════════════════════════════════════════════════════════════
+
+/** @brief Fill attempts when config->max_attempts is 0 */
+#define FILL_DEFAULT_ATTEMPTS 64
+
+/**
+ * @brief i-th term (0-based) of the Luby sequence 1,1,2,1,1,2,4,...
+ */
+static long luby(int i) {
+    long size = 1;      // Length of the smallest complete block 2^k - 1 holding i
+    int power = 0;
+    while (size < i + 1) {
+        size = 2 * size + 1;
+        power++;
+    }
+    while (size - 1 != i) {
+        size = (size - 1) / 2;
+        power--;
+        i = i % (int)size;
+    }
+    return 1L << power;
+}
+
+/**
+ * @brief Node budget of attempt @p attempt (0-based), or ≤ 0 if unlimited
+ * 
+ * The unit defaults to n³ nodes: measured on this backtracker, that is
+ * close to the median fill cost for 9×9 and 16×16, where Luby restarts
+ * cut the 99th percentile by two orders of magnitude.
+ */
+static long fill_budget(const SudokuBoard *board, const SudokuGenerationConfig *config,
+                        int attempt) {
+    long n = board->board_size;
+    long unit = n * n * n;
+    SudokuRestartPolicy policy = SUDOKU_RESTART_LUBY;
+    
+    if (config != NULL) {
+        if (config->fill_node_budget < 0) {
+            return 0;   // Unlimited: the pre-budget behaviour
+        }
+        if (config->fill_node_budget > 0) {
+            unit = config->fill_node_budget;
+        }
+        policy = config->restart_policy;
+    }
+    
+    long factor = (policy == SUDOKU_RESTART_GEOMETRIC)
+                ? 1L << (attempt < 30 ? attempt : 30)
+                : luby(attempt);
+    return unit * factor;
+}
+
+/**
+ * @brief Diagonal + budgeted backtracking, restarted until success
+ * 
+ * Every attempt re-initialises the board and draws new diagonal
+ * subgrids and new candidate orders, so a restart explores a fresh
+ * region of the search space instead of resuming the unlucky one.
+ * With SUDOKU_FILL_PATTERN the grid is written directly instead
+ * (fillPattern()) and the first attempt always succeeds.
+ * 
+ * @param interrupt Checked before every attempt and inside the
+ *                  backtracking search (NULL = none)
+ * @param[out] attempts_made Attempts performed (1 = no restart)
+ * @return true once an attempt completes the board
+ */
+static bool fill_with_restarts(SudokuBoard *board, const SudokuGenerationConfig *config,
+                               const SudokuInterrupt *interrupt,
+                               int max_attempts, int *attempts_made,
+                               SudokuGenerationStats *stats) {
+    long total_nodes = 0;
+    bool filled = false;
+    bool pattern = (config != NULL && config->fill_method == SUDOKU_FILL_PATTERN);
+    int attempt;
+    
+    for (attempt = 0; attempt < max_attempts && !filled; attempt++) {
+        if (sudoku_interrupt_check(interrupt) != SUDOKU_STATUS_OK) {
+            break;
+        }
+        if (attempt > 0) {
+            sudoku_board_init(board);
+        }
+        
+        if (pattern) {
+            // Permuted pattern grid: O(n²), nothing to search
+            filled = fillPattern(board);
+            if (filled) {
+                emit_event(SUDOKU_EVENT_DIAGONAL_FILL_COMPLETE, board, 0, 0);
+                emit_event(SUDOKU_EVENT_BACKTRACK_COMPLETE, board, 0, 0);
+            }
+            continue;
+        }
+        
+        // STEP 1: Fill diagonal subgrids with Fisher-Yates. Skipped on
+        // 4×4, where STEP 2 draws a whole grid from the table of all 288
+        // (grid4_internal.h) and random diagonals would only add dead ends
+        if (board->subgrid_size != 2) {
+            fillDiagonal(board);
+        }
+        
+        // Emit diagonal complete event
+        emit_event(SUDOKU_EVENT_DIAGONAL_FILL_COMPLETE, board, 0, 0);
+        
+        // STEP 2: Complete remaining cells with budgeted backtracking
+        long nodes = 0;
+        filled = sudoku_complete_backtracking_budget(board, fill_budget(board, config, attempt),
+                                                     &nodes, interrupt);
+        total_nodes += nodes;
+        
+        if (filled) {
+            // Emit backtracking complete event
+            emit_event(SUDOKU_EVENT_BACKTRACK_COMPLETE, board, 0, 0);
+        }
+    }
+    
+    *attempts_made = attempt;
+    if (stats) {
+        stats->total_attempts = attempt;
+        stats->fill_restarts = attempt > 0 ? attempt - 1 : 0;  // 0 if interrupted first
+        stats->fill_nodes = total_nodes;
+    }
+    return filled;
 }
 
 // ═══════════════════════════════════════════════════════════════════
@@ -133,16 +299,19 @@ bool sudoku_generate_ex(SudokuBoard *board,
 // ═══════════════════════════════════════════════════════════════════
 
 /**
- * @brief CLASSIC generation path - Fisher-Yates + Standard Backtracking
+ * @brief Steps 0-2 of the classic path: a full solution grid
  * 
- * This function contains the ENTIRE v2.2.1 generation algorithm,
- * extracted from the original sudoku_generate_ex() for modularity.
+ * Resets the board, the event system and the statistics, then fills
+ * the board (fill_with_restarts()). sudoku_generate_variants() calls
+ * it once for many puzzles; generate_classic() once per puzzle.
  * 
- * NO CHANGES to algorithm logic - pure refactoring for branching.
+ * @return SUDOKU_STATUS_OK with @p board complete, otherwise why the
+ *         fill stopped
  */
-static bool generate_classic(SudokuBoard *board,
-                            const SudokuGenerationConfig *config,
-                            SudokuGenerationStats *stats) {
+static SudokuStatus build_solution_grid(SudokuBoard *board,
+                                        const SudokuGenerationConfig *config,
+                                        const SudokuInterrupt *interrupt,
+                                        SudokuGenerationStats *stats) {
     
     // ═══════════════════════════════════════════════════════════════
     // STEP 0: Initialize board and extract dimensions
@@ -151,13 +320,12 @@ static bool generate_classic(SudokuBoard *board,
     sudoku_board_init(board);
     
     int board_size = sudoku_board_get_board_size(board);
-    int num_subgrids = board_size;
     
     // Initialize event system
     if (config != NULL && config->callback != NULL) {
-        events_init(config->callback, config->user_data);
+        events_init(config->callback, config->user_data, config->event_mask);
     } else {
-        events_init(NULL, NULL);
+        events_init(NULL, NULL, 0);
     }
     
     emit_event(SUDOKU_EVENT_GENERATION_START, NULL, 0, 0);
@@ -169,6 +337,13 @@ static bool generate_classic(SudokuBoard *board,
         stats->phase2_rounds = 0;
         stats->phase3_removed = 0;
         stats->total_attempts = 1;
+        stats->difficulty_aborts = 0;
+        stats->fill_restarts = 0;
+        stats->fill_nodes = 0;
+        stats->phase3_probes = 0;
+        stats->phase3_probes_saved = 0;
+        stats->phase3_probes_refuted = 0;
+        stats->status = SUDOKU_STATUS_OK;
     }
     
     // ═══════════════════════════════════════════════════════════════
@@ -180,69 +355,63 @@ static bool generate_classic(SudokuBoard *board,
      * 
      * Fisher-Yates can create incompletable configurations on small boards.
      * 4×4 has ~70% failure probability. We retry until success.
+     * 
+     * Each attempt is node-budgeted and restarts follow a Luby (or
+     * geometric) schedule with fresh diagonals, so one unlucky fill can
+     * no longer run for minutes (see fill_with_restarts()).
      */
     
-    int max_attempts;
-    switch (board_size) {
-        case 4:
-            max_attempts = 20;
-            break;
-        case 9:
-            max_attempts = 5;
-            break;
-        case 16:
-            max_attempts = 10;
-            break;
-        case 25:
-            max_attempts = 15;
-            break;
-        default:
-            max_attempts = 10;
-            break;
-    }
-    
-    bool generation_successful = false;
-    int attempt;
-    
-    for (attempt = 0; attempt < max_attempts && !generation_successful; attempt++) {
-        if (attempt > 0) {
-            sudoku_board_init(board);
-        }
-        
-        // STEP 1: Fill diagonal subgrids with Fisher-Yates
-        fillDiagonal(board);
-        
-        // Emit diagonal complete event
-        emit_event(SUDOKU_EVENT_DIAGONAL_FILL_COMPLETE, board, 0, 0);
-        
-        // STEP 2: Complete remaining cells with backtracking
-        if (sudoku_complete_backtracking(board)) {
-            generation_successful = true;
-            
-            // Emit backtracking complete event
-            emit_event(SUDOKU_EVENT_BACKTRACK_COMPLETE, board, 0, 0);
-            
-            if (stats) {
-                stats->total_attempts = attempt + 1;
-            }
-        }
-    }
+    int max_attempts = (config != NULL && config->max_attempts > 0)
+                     ? config->max_attempts : FILL_DEFAULT_ATTEMPTS;
+    int attempt = 0;
+    bool generation_successful = fill_with_restarts(board, config, interrupt, max_attempts,
+                                                    &attempt, stats);
     
     if (!generation_successful) {
-        fprintf(stderr, "❌ Error: Failed to complete board (size %d×%d) after %d attempts\n",
-                board_size, board_size, max_attempts);
+        SudokuStatus status = sudoku_interrupt_check(interrupt);
+        if (status == SUDOKU_STATUS_OK) {
+            fprintf(stderr, "❌ Error: Failed to complete board (size %d×%d) after %d attempts\n",
+                    board_size, board_size, max_attempts);
+            status = SUDOKU_STATUS_FAILED;
+        }
         emit_event(SUDOKU_EVENT_GENERATION_FAILED, board, attempt, 0);
-        return false;
+        return status;
     }
+    return SUDOKU_STATUS_OK;
+}
+
+/**
+ * @brief Steps 3 to the end of the classic path: carve the puzzle
+ * 
+ * Runs Phases 1-3 on the full grid in @p board. Every removal order is
+ * drawn afresh, so carving copies of one grid gives different puzzles
+ * with that grid as their solution. Such carves can share
+ * @p counterexamples (NULL for a single carve).
+ * 
+ * @return SUDOKU_STATUS_OK with a finished puzzle; FAILED if the
+ *         difficulty target became unreachable; the interrupt status
+ *         if Phase 3 was stopped
+ */
+static SudokuStatus carve_puzzle(SudokuBoard *board,
+                                 const SudokuGenerationConfig *config,
+                                 const SudokuInterrupt *interrupt,
+                                 Phase3Counterexamples *counterexamples,
+                                 SudokuGenerationStats *stats) {
+    int board_size = sudoku_board_get_board_size(board);
+    int num_subgrids = board_size;
     
     // ═══════════════════════════════════════════════════════════════
     // STEP 3: Allocate dynamic array for subgrid indices
     // ═══════════════════════════════════════════════════════════════
     
-    int *subgrid_indices = (int *)malloc(num_subgrids * sizeof(int));
+    // Scratch allocation: rewound right after Phase 2 (LIFO with the
+    // buffers Phase 1/2 take from the same arena)
+    SudokuArena *arena = arena_scratch();
+    SudokuArenaMark indices_mark = sudoku_arena_mark(arena);
+    int *subgrid_indices = (int *)sudoku_arena_alloc(arena, num_subgrids * sizeof(int));
     if (subgrid_indices == NULL) {
         fprintf(stderr, "❌ Error: Memory allocation failed for subgrid indices\n");
-        return false;
+        return SUDOKU_STATUS_FAILED;
     }
     
     for (int i = 0; i < num_subgrids; i++) {
@@ -255,7 +424,10 @@ static bool generate_classic(SudokuBoard *board,
     
     sudoku_generate_permutation(subgrid_indices, num_subgrids, 0);
     
-    int removed1 = phase1Elimination(board, subgrid_indices, num_subgrids);
+    // With a symmetry every phase removes whole orbits
+    SudokuSymmetry symmetry = (config != NULL) ? config->symmetry : SUDOKU_SYMMETRY_NONE;
+    
+    int removed1 = phase1EliminationEx(board, subgrid_indices, num_subgrids, symmetry);
     
     if (stats) {
         stats->phase1_removed = removed1;
@@ -272,7 +444,8 @@ static bool generate_classic(SudokuBoard *board,
     int removed_this_round;
     
     do {
-        removed_this_round = phase2Elimination(board, subgrid_indices, num_subgrids);
+        removed_this_round = phase2EliminationEx(board, subgrid_indices, num_subgrids,
+                                                 symmetry);
         total_removed2 += removed_this_round;
         
         if (removed_this_round > 0) {
@@ -294,20 +467,65 @@ static bool generate_classic(SudokuBoard *board,
     emit_event(SUDOKU_EVENT_PHASE2_COMPLETE, board, total_removed2, rounds);
     
     // ═══════════════════════════════════════════════════════════════
-    // CLEANUP: Free dynamically allocated memory
+    // CLEANUP: Return the index array to the scratch arena
     // ═══════════════════════════════════════════════════════════════
     
-    free(subgrid_indices);
+    sudoku_arena_release(arena, indices_mark);
     subgrid_indices = NULL;
     
     // ═══════════════════════════════════════════════════════════════
     // PHASE 3: Free elimination with uniqueness verification
     // ═══════════════════════════════════════════════════════════════
     
-    int removed3 = phase3EliminationAuto(board);
+    /*
+     * With a difficulty target, Phase 3 grades every removal, stops as
+     * soon as the target bucket is reached and abandons the attempt as
+     * soon as it becomes unreachable (see phase3EliminationEx()).
+     * With minimal_puzzle, every clue is decided instead of stopping at
+     * calculate_phase3_target().
+     */
+    Phase3Outcome outcome = PHASE3_COMPLETED;
+    Phase3Probes probes = { 0 };
+    Phase3Config phase3_config = {
+        .max_removals = calculate_phase3_target(board),
+        .probes = &probes,
+        .interrupt = interrupt,
+        .symmetry = symmetry,
+        .counterexamples = counterexamples
+    };
+    
+    if (config != NULL && config->use_target_difficulty) {
+        phase3_config.max_removals = board_size * board_size;
+        phase3_config.use_target_difficulty = true;
+        phase3_config.target_difficulty = config->target_difficulty;
+    } else if (config != NULL && config->minimal_puzzle) {
+        // Decide every clue: the result is a minimal puzzle
+        phase3_config.minimal = true;
+    }
+    
+    int removed3 = phase3EliminationEx(board, &phase3_config, &outcome);
     
     if (stats) {
         stats->phase3_removed = removed3;
+        stats->phase3_probes = probes.probes;
+        stats->phase3_probes_saved = probes.probes_saved;
+        stats->phase3_probes_refuted = probes.probes_refuted;
+    }
+    
+    if (outcome == PHASE3_TARGET_UNREACHABLE) {
+        if (stats) {
+            stats->difficulty_aborts = 1;
+        }
+        sudoku_board_update_stats(board);
+        emit_event(SUDOKU_EVENT_GENERATION_FAILED, board, 3, removed3);
+        return SUDOKU_STATUS_FAILED;
+    }
+    
+    if (outcome == PHASE3_INTERRUPTED) {
+        // Board keeps a unique solution but is not a finished puzzle
+        sudoku_board_update_stats(board);
+        emit_event(SUDOKU_EVENT_GENERATION_FAILED, board, 3, removed3);
+        return sudoku_interrupt_check(interrupt);
     }
     
     // Emit phase 3 complete event
@@ -321,7 +539,30 @@ static bool generate_classic(SudokuBoard *board,
     
     emit_event(SUDOKU_EVENT_GENERATION_COMPLETE, board, 0, 0);
     
-    return true;
+    return SUDOKU_STATUS_OK;
+}
+
+/**
+ * @brief CLASSIC generation path - Fisher-Yates + Standard Backtracking
+ * 
+ * This function contains the ENTIRE v2.2.1 generation algorithm,
+ * extracted from the original sudoku_generate_ex() for modularity:
+ * build_solution_grid() followed by carve_puzzle().
+ * 
+ * NO CHANGES to algorithm logic - pure refactoring for branching.
+ */
+static SudokuStatus generate_classic(SudokuBoard *board,
+                                     const SudokuGenerationConfig *config,
+                                     SudokuGenerationStats *stats) {
+    // Cancellation token / deadline, if the caller set either
+    SudokuInterrupt interrupt_storage;
+    const SudokuInterrupt *interrupt = interrupt_from_config(config, &interrupt_storage);
+    
+    SudokuStatus status = build_solution_grid(board, config, interrupt, stats);
+    if (status != SUDOKU_STATUS_OK) {
+        return status;
+    }
+    return carve_puzzle(board, config, interrupt, NULL, stats);
 }
 
 // ═══════════════════════════════════════════════════════════════════
@@ -351,9 +592,9 @@ static bool generate_classic(SudokuBoard *board,
  * @note Currently forwards to generate_classic()
  * @todo Implement full AC3HB algorithm (Week 3 roadmap)
  */
-static bool generate_with_ac3hb(SudokuBoard *board,
-                               const SudokuGenerationConfig *config,
-                               SudokuGenerationStats *stats) {
+static SudokuStatus generate_with_ac3hb(SudokuBoard *board,
+                                        const SudokuGenerationConfig *config,
+                                        SudokuGenerationStats *stats) {
     
     /*
      * ⚠️ STUB IMPLEMENTATION
@@ -388,20 +629,201 @@ bool sudoku_generate(SudokuBoard *board, SudokuGenerationStats *stats) {
 //                    DIFFICULTY-TARGETED GENERATION
 // ═══════════════════════════════════════════════════════════════════
 
+/**
+ * @brief Maximum generations tried before giving up on a difficulty
+ * 
+ * Most attempts that miss the target are abandoned right after Phase 2
+ * or early in Phase 3, so even the rare buckets stay affordable.
+ */
+#define DIFFICULTY_MAX_GENERATIONS 200
+
 /**
  * @brief Generate a Sudoku puzzle targeting a specific difficulty level
  * 
- * @note Currently generates normally - difficulty targeting not yet implemented
- * @todo Adjust elimination parameters based on target difficulty
+ * Runs the classic pipeline with Phase 3 steered toward the requested
+ * bucket. Attempts that cannot reach it are dropped early and retried
+ * with a fresh board; stats->difficulty_aborts reports how many.
  */
 bool sudoku_generate_with_difficulty(SudokuBoard *board,
                                     SudokuDifficulty difficulty,
                                     SudokuGenerationStats *stats) {
-    bool result = sudoku_generate(board, stats);
+    if (board == NULL || difficulty < SUDOKU_EASY || difficulty >= SUDOKU_INVALID) {
+        return false;
+    }
+    
+    SudokuGenerationConfig config = {
+        .callback = NULL,
+        .user_data = NULL,
+        .max_attempts = 0,
+        .use_target_difficulty = true,
+        .target_difficulty = difficulty
+    };
+    
+    int aborts = 0;
+    for (int generation = 0; generation < DIFFICULTY_MAX_GENERATIONS; generation++) {
+        if (sudoku_generate_ex(board, &config, stats)) {
+            if (stats) {
+                stats->difficulty_aborts = aborts;
+            }
+            return true;
+        }
+        aborts++;
+    }
+    
+    fprintf(stderr, "❌ Error: No %s puzzle found after %d generations\n",
+            sudoku_difficulty_to_string(difficulty), DIFFICULTY_MAX_GENERATIONS);
+    
+    // The last attempt's carve is of another difficulty: never hand it out
+    sudoku_board_init(board);
+    if (stats) {
+        stats->difficulty_aborts = aborts;
+        stats->status = SUDOKU_STATUS_FAILED;
+    }
+    return false;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    REPRODUCIBLE GENERATION
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Generate the puzzle of an ID
+ * 
+ * Every random choice of the pipeline comes from the thread's
+ * generator (random_internal.h) and nothing else varies between runs:
+ * node budgets replace time limits, the counters are deterministic and
+ * ties in Phase 3 are broken by the shuffled order. Seeding the stream
+ * with the ID therefore fixes the whole run.
+ */
+bool sudoku_generate_from_id(SudokuBoard *board, uint64_t id,
+                             SudokuDifficulty difficulty,
+                             SudokuGenerationStats *stats) {
+    if (board == NULL) {
+        return false;
+    }
+    
+    RandomState caller = random_save();
+    random_seed(id);
+    bool ok = sudoku_generate_with_difficulty(board, difficulty, stats);
+    random_restore(&caller);
+    return ok;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    SHARED-SOLUTION VARIANTS
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Carves tried per variant before sudoku_generate_variants() stops
+ * 
+ * Same bound as DIFFICULTY_MAX_GENERATIONS, but each try only repeats
+ * the phases, not the fill.
+ */
+#define VARIANT_MAX_CARVES DIFFICULTY_MAX_GENERATIONS
+
+/**
+ * @brief True if @p board equals one of the first @p count puzzles
+ */
+static bool variant_seen(SudokuBoard *const *puzzles, int count, const SudokuBoard *board) {
+    for (int i = 0; i < count; i++) {
+        if (sudoku_board_equals(puzzles[i], board)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Fill one grid, then carve @p count distinct puzzles out of it
+ * 
+ * The grid is built in a board of its own; every variant starts as a
+ * copy of it and gets its own Phase 1-3 removal orders. A carve that
+ * misses the difficulty target, or repeats an earlier variant, is
+ * retried on a fresh copy: cheap next to the fill.
+ * 
+ * Carves share a Phase 3 counterexample cache: every second solution
+ * one carve's probes find rejects, without a probe, the removals of
+ * later carves that it still satisfies.
+ */
+int sudoku_generate_variants(SudokuBoard *const *puzzles, int count,
+                             const SudokuGenerationConfig *config,
+                             SudokuGenerationStats *stats) {
+    if (puzzles == NULL || count <= 0 || puzzles[0] == NULL) {
+        return 0;
+    }
+    for (int i = 1; i < count; i++) {
+        if (puzzles[i] == NULL || puzzles[i]->subgrid_size != puzzles[0]->subgrid_size) {
+            return 0;
+        }
+    }
+    
+    SudokuBoard *grid = sudoku_board_create_size(puzzles[0]->subgrid_size);
+    if (grid == NULL) {
+        return 0;
+    }
+    
+    // Same scratch-memory discipline as sudoku_generate_with_status()
+    SudokuArena *previous_arena = NULL;
+    bool caller_arena = (config != NULL && config->arena != NULL);
+    if (caller_arena) {
+        previous_arena = arena_set_active(config->arena);
+    }
+    SudokuArena *arena = arena_scratch();
+    SudokuArenaMark mark = sudoku_arena_mark(arena);
+    
+    SudokuInterrupt interrupt_storage;
+    const SudokuInterrupt *interrupt = interrupt_from_config(config, &interrupt_storage);
+    
+    SudokuStatus status = build_solution_grid(grid, config, interrupt, stats);
+    int produced = 0;
+    int rejected = 0;
+    int refuted = 0;
+    
+    Phase3Counterexamples storage;
+    Phase3Counterexamples *counterexamples =
+        phase3_counterexamples_init(&storage, grid, arena) ? &storage : NULL;
+    
+    while (status == SUDOKU_STATUS_OK && produced < count) {
+        bool done = false;
+        for (int carve = 0; carve < VARIANT_MAX_CARVES && !done; carve++) {
+            SudokuBoard *puzzle = puzzles[produced];
+            sudoku_board_copy_into(puzzle, grid);
+            
+            SudokuStatus carved = carve_puzzle(puzzle, config, interrupt,
+                                               counterexamples, stats);
+            if (stats) {
+                refuted += stats->phase3_probes_refuted;
+            }
+            if (carved == SUDOKU_STATUS_OK && !variant_seen(puzzles, produced, puzzle)) {
+                done = true;
+            } else if (carved == SUDOKU_STATUS_OK || carved == SUDOKU_STATUS_FAILED) {
+                rejected++;
+            } else {
+                status = carved;    // Cancelled or past the deadline
+                break;
+            }
+        }
+        if (!done) {
+            if (status == SUDOKU_STATUS_OK) {
+                status = SUDOKU_STATUS_FAILED;
+            }
+            break;
+        }
+        produced++;
+    }
     
-    (void)difficulty;  // Suppress unused parameter warning
+    sudoku_arena_release(arena, mark);
+    if (caller_arena) {
+        arena_set_active(previous_arena);
+    }
+    sudoku_board_destroy(grid);
     
-    return result;
+    if (stats) {
+        stats->difficulty_aborts = rejected;
+        stats->phase3_probes_refuted = refuted;
+        stats->status = status;
+    }
+    return produced;
 }
 
 // ═══════════════════════════════════════════════════════════════════
@@ -411,13 +833,20 @@ bool sudoku_generate_with_difficulty(SudokuBoard *board,
 /**
  * @brief Evaluate the difficulty level of a puzzle
  * 
- * Analyzes based on clue percentage. Thresholds scale with board size:
+ * Grades the puzzle by the hardest human technique it requires
+ * (see grader.c). Boards the grader cannot handle (larger than 64×64)
+ * fall back to the clue-percentage thresholds that scale with size:
  * - EASY:   ≥55% filled
  * - MEDIUM: ≥43% filled
  * - HARD:   ≥31% filled
  * - EXPERT: <31% filled
  */
 SudokuDifficulty sudoku_evaluate_difficulty(const SudokuBoard *board) {
+    SudokuGradeResult grade;
+    if (sudoku_grade_puzzle(board, &grade)) {
+        return grade.difficulty;
+    }
+
     int clues = sudoku_board_get_clues(board);
     int board_size = sudoku_board_get_board_size(board);
     int total_cells = board_size * board_size;
@@ -0,0 +1,705 @@
+/**
+ * @file grader.c
+ * @brief Logical solver with incremental candidate masks, and the grader
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * The solver loop always restarts from the cheapest technique after any
+ * progress. That keeps the technique counts meaningful: an X-Wing is only
+ * recorded when no single, locked candidate or subset was available.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "sudoku/core/grader.h"
+#include "internal/logic_internal.h"
+#include "internal/arena_internal.h"
+#include "internal/grid4_internal.h"
+
+/** @brief Search nodes allowed when logic stalls before giving up */
+#define LOGIC_SEARCH_BUDGET 2000000L
+
+/** @brief Score contribution of one application of each technique */
+static const int TECHNIQUE_WEIGHT[SUDOKU_TECH_COUNT] = {
+    0,      // NONE
+    1,      // NAKED_SINGLE
+    2,      // HIDDEN_SINGLE
+    10,     // LOCKED_CANDIDATES
+    20,     // NAKED_PAIR
+    25,     // HIDDEN_PAIR
+    40,     // NAKED_TRIPLE
+    50,     // HIDDEN_TRIPLE
+    80,     // X_WING
+    120,    // SWORDFISH
+    500     // BACKTRACKING (counted once)
+};
+
+// ═══════════════════════════════════════════════════════════════════
+//                    STATE LIFECYCLE
+// ═══════════════════════════════════════════════════════════════════
+
+bool logic_state_init(LogicState *st, const SudokuBoard *board) {
+    memset(st, 0, sizeof(*st));
+    if (board == NULL || board->board_size > LOGIC_MAX_BOARD_SIZE) {
+        return false;
+    }
+
+    const int n = board->board_size;
+    const int k = board->subgrid_size;
+    const size_t cells = (size_t)n * n;
+
+    // uint64_t arrays first so every array stays naturally aligned
+    size_t bytes = sizeof(uint64_t) * (cells + 3 * (size_t)n)
+                 + sizeof(int) * (cells + 3 * cells);
+    st->arena = arena_scratch();
+    st->mark = sudoku_arena_mark(st->arena);
+    st->block = sudoku_arena_alloc(st->arena, bytes);
+    if (st->block == NULL) {
+        return false;
+    }
+
+    st->n = n;
+    st->k = k;
+    st->full = (n == 64) ? ~0ULL : ((1ULL << n) - 1);
+    st->cand = st->block;
+    st->row_used = st->cand + cells;
+    st->col_used = st->row_used + n;
+    st->box_used = st->col_used + n;
+    st->value = (int *)(st->box_used + n);
+    st->units = st->value + cells;
+
+    memset(st->row_used, 0, sizeof(uint64_t) * 3 * n);
+
+    // Unit membership: rows, columns, boxes
+    for (int u = 0; u < n; u++) {
+        int box_row = (u / k) * k;
+        int box_col = (u % k) * k;
+        for (int i = 0; i < n; i++) {
+            st->units[u * n + i] = u * n + i;
+            st->units[(n + u) * n + i] = i * n + u;
+            st->units[(2 * n + u) * n + i] = (box_row + i / k) * n + box_col + i % k;
+        }
+    }
+
+    // Givens: duplicates are reported as a contradiction, not a failure
+    st->empty = 0;
+    for (int r = 0; r < n; r++) {
+        for (int c = 0; c < n; c++) {
+            int v = board->cells[r][c];
+            st->value[r * n + c] = v;
+            if (v == 0) {
+                st->empty++;
+                continue;
+            }
+            uint64_t bit = 1ULL << (v - 1);
+            int b = logic_box_of(st, r, c);
+            if ((st->row_used[r] | st->col_used[c] | st->box_used[b]) & bit) {
+                st->contradiction = true;
+            }
+            st->row_used[r] |= bit;
+            st->col_used[c] |= bit;
+            st->box_used[b] |= bit;
+        }
+    }
+
+    for (int r = 0; r < n; r++) {
+        for (int c = 0; c < n; c++) {
+            int cell = r * n + c;
+            if (st->value[cell] != 0) {
+                st->cand[cell] = 0;
+                continue;
+            }
+            st->cand[cell] = st->full & ~(st->row_used[r] | st->col_used[c]
+                                          | st->box_used[logic_box_of(st, r, c)]);
+            if (st->cand[cell] == 0) {
+                st->contradiction = true;
+            }
+        }
+    }
+
+    return true;
+}
+
+void logic_state_free(LogicState *st) {
+    if (st->block != NULL) {
+        sudoku_arena_release(st->arena, st->mark);
+    }
+    st->block = NULL;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    INCREMENTAL UPDATES
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Remove candidate bits from one cell
+ * @return true if something was removed
+ */
+static inline bool eliminate(LogicState *st, int cell, uint64_t bits) {
+    if (st->value[cell] != 0 || !(st->cand[cell] & bits)) {
+        return false;
+    }
+    st->cand[cell] &= ~bits;
+    if (st->cand[cell] == 0) {
+        st->contradiction = true;
+    }
+    return true;
+}
+
+static inline uint64_t unit_used(const LogicState *st, int u) {
+    if (u < st->n) return st->row_used[u];
+    if (u < 2 * st->n) return st->col_used[u - st->n];
+    return st->box_used[u - 2 * st->n];
+}
+
+bool logic_place(LogicState *st, int cell, int digit) {
+    const int n = st->n;
+    uint64_t bit = 1ULL << (digit - 1);
+
+    if (st->value[cell] != 0 || !(st->cand[cell] & bit)) {
+        st->contradiction = true;
+        return false;
+    }
+
+    int r = cell / n;
+    int c = cell % n;
+    int b = logic_box_of(st, r, c);
+
+    st->value[cell] = digit;
+    st->cand[cell] = 0;
+    st->empty--;
+    st->row_used[r] |= bit;
+    st->col_used[c] |= bit;
+    st->box_used[b] |= bit;
+
+    const int *row = &st->units[r * n];
+    const int *col = &st->units[(n + c) * n];
+    const int *box = &st->units[(2 * n + b) * n];
+    for (int i = 0; i < n; i++) {
+        eliminate(st, row[i], bit);
+        eliminate(st, col[i], bit);
+        eliminate(st, box[i], bit);
+    }
+
+    return !st->contradiction;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    TECHNIQUES
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Place every cell that has exactly one candidate
+ * @return Number of placements
+ */
+static int apply_naked_singles(LogicState *st) {
+    const int cells = st->n * st->n;
+    int placed = 0;
+
+    for (int cell = 0; cell < cells && !st->contradiction; cell++) {
+        uint64_t m = st->cand[cell];
+        if (st->value[cell] == 0 && m != 0 && (m & (m - 1)) == 0) {
+            logic_place(st, cell, logic_lowest_bit(m) + 1);
+            placed++;
+        }
+    }
+    return placed;
+}
+
+/**
+ * @brief Place one digit that has a single position in some unit
+ *
+ * Uses the once/twice trick: after folding all candidate masks of a
+ * unit, @c once & ~twice holds the digits that appear exactly once.
+ *
+ * @return true if a digit was placed
+ */
+static bool apply_hidden_single(LogicState *st) {
+    const int n = st->n;
+
+    for (int u = 0; u < 3 * n; u++) {
+        const int *unit = &st->units[u * n];
+        uint64_t once = 0, twice = 0;
+
+        for (int i = 0; i < n; i++) {
+            uint64_t m = st->cand[unit[i]];
+            twice |= once & m;
+            once |= m;
+        }
+
+        uint64_t used = unit_used(st, u);
+        if ((once | used) != st->full) {
+            st->contradiction = true;   // Some digit has no place left
+            return false;
+        }
+
+        uint64_t hidden = once & ~twice & ~used;
+        if (hidden == 0) {
+            continue;
+        }
+
+        uint64_t bit = hidden & (~hidden + 1);
+        for (int i = 0; i < n; i++) {
+            if (st->cand[unit[i]] & bit) {
+                logic_place(st, unit[i], logic_lowest_bit(bit) + 1);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Pointing and claiming (box/line interactions)
+ * @return true if any candidate was eliminated
+ */
+static bool apply_locked_candidates(LogicState *st) {
+    const int n = st->n;
+
+    for (int b = 0; b < n; b++) {
+        const int *box = &st->units[(2 * n + b) * n];
+        uint64_t todo = st->full & ~st->box_used[b];
+
+        while (todo) {
+            uint64_t bit = todo & (~todo + 1);
+            todo &= todo - 1;
+
+            // Pointing: all positions of the digit in this box share a line
+            uint64_t rows = 0, cols = 0;
+            for (int i = 0; i < n; i++) {
+                if (st->cand[box[i]] & bit) {
+                    rows |= 1ULL << (box[i] / n);
+                    cols |= 1ULL << (box[i] % n);
+                }
+            }
+
+            bool changed = false;
+            if (rows && (rows & (rows - 1)) == 0) {
+                int r = logic_lowest_bit(rows);
+                for (int c = 0; c < n; c++) {
+                    if (logic_box_of(st, r, c) != b) {
+                        changed |= eliminate(st, r * n + c, bit);
+                    }
+                }
+            }
+            if (cols && (cols & (cols - 1)) == 0) {
+                int c = logic_lowest_bit(cols);
+                for (int r = 0; r < n; r++) {
+                    if (logic_box_of(st, r, c) != b) {
+                        changed |= eliminate(st, r * n + c, bit);
+                    }
+                }
+            }
+            if (changed) return true;
+        }
+    }
+
+    // Claiming: all positions of the digit in a line share one box
+    for (int u = 0; u < 2 * n; u++) {
+        const int *line = &st->units[u * n];
+        uint64_t todo = st->full & ~unit_used(st, u);
+
+        while (todo) {
+            uint64_t bit = todo & (~todo + 1);
+            todo &= todo - 1;
+
+            int target = -1;
+            bool single_box = true;
+            for (int i = 0; i < n && single_box; i++) {
+                if (st->cand[line[i]] & bit) {
+                    int b = logic_box_of(st, line[i] / n, line[i] % n);
+                    if (target < 0) target = b;
+                    else if (b != target) single_box = false;
+                }
+            }
+            if (!single_box || target < 0) {
+                continue;
+            }
+
+            bool changed = false;
+            const int *box = &st->units[(2 * n + target) * n];
+            for (int i = 0; i < n; i++) {
+                int cell = box[i];
+                bool on_line = (u < n) ? (cell / n == u) : (cell % n == u - n);
+                if (!on_line) {
+                    changed |= eliminate(st, cell, bit);
+                }
+            }
+            if (changed) return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Advance to the next s-combination of {0..count-1}
+ */
+static bool next_combination(int *idx, int s, int count) {
+    int i = s - 1;
+    while (i >= 0 && idx[i] == count - s + i) {
+        i--;
+    }
+    if (i < 0) {
+        return false;
+    }
+    idx[i]++;
+    for (int j = i + 1; j < s; j++) {
+        idx[j] = idx[j - 1] + 1;
+    }
+    return true;
+}
+
+/**
+ * @brief Naked subsets: s cells of a unit whose candidates union has s digits
+ * @return true if any candidate was eliminated
+ */
+static bool apply_naked_subset(LogicState *st, int s) {
+    const int n = st->n;
+    int pos[LOGIC_MAX_BOARD_SIZE];
+    int idx[3];
+
+    for (int u = 0; u < 3 * n; u++) {
+        const int *unit = &st->units[u * n];
+        int count = 0;
+
+        for (int i = 0; i < n; i++) {
+            int pc = logic_popcount(st->cand[unit[i]]);
+            if (pc >= 2 && pc <= s) pos[count++] = i;
+        }
+        if (count < s) continue;
+
+        for (int i = 0; i < s; i++) idx[i] = i;
+        do {
+            uint64_t uni = 0, members = 0;
+            for (int i = 0; i < s; i++) {
+                uni |= st->cand[unit[pos[idx[i]]]];
+                members |= 1ULL << pos[idx[i]];
+            }
+            if (logic_popcount(uni) != s) continue;
+
+            bool changed = false;
+            for (int i = 0; i < n; i++) {
+                if (!(members & (1ULL << i))) {
+                    changed |= eliminate(st, unit[i], uni);
+                }
+            }
+            if (changed) return true;
+        } while (next_combination(idx, s, count));
+    }
+    return false;
+}
+
+/**
+ * @brief Hidden subsets: s digits of a unit confined to the same s cells
+ * @return true if any candidate was eliminated
+ */
+static bool apply_hidden_subset(LogicState *st, int s) {
+    const int n = st->n;
+    uint64_t where[LOGIC_MAX_BOARD_SIZE];
+    int digits[LOGIC_MAX_BOARD_SIZE];
+    int idx[3];
+
+    for (int u = 0; u < 3 * n; u++) {
+        const int *unit = &st->units[u * n];
+        uint64_t used = unit_used(st, u);
+        int count = 0;
+
+        for (int d = 0; d < n; d++) {
+            if (used & (1ULL << d)) continue;
+            uint64_t w = 0;
+            for (int i = 0; i < n; i++) {
+                if (st->cand[unit[i]] & (1ULL << d)) w |= 1ULL << i;
+            }
+            int pc = logic_popcount(w);
+            if (pc >= 2 && pc <= s) {
+                where[count] = w;
+                digits[count++] = d;
+            }
+        }
+        if (count < s) continue;
+
+        for (int i = 0; i < s; i++) idx[i] = i;
+        do {
+            uint64_t cells = 0, keep = 0;
+            for (int i = 0; i < s; i++) {
+                cells |= where[idx[i]];
+                keep |= 1ULL << digits[idx[i]];
+            }
+            if (logic_popcount(cells) != s) continue;
+
+            bool changed = false;
+            for (int i = 0; i < n; i++) {
+                if (cells & (1ULL << i)) {
+                    changed |= eliminate(st, unit[i], ~keep);
+                }
+            }
+            if (changed) return true;
+        } while (next_combination(idx, s, count));
+    }
+    return false;
+}
+
+/**
+ * @brief Basic fish of size s (2 = X-Wing, 3 = Swordfish)
+ *
+ * For a digit, if s rows hold all their candidates in the same s
+ * columns, the digit can be removed from those columns in every other
+ * row (and symmetrically with rows and columns swapped).
+ *
+ * @return true if any candidate was eliminated
+ */
+static bool apply_fish(LogicState *st, int s) {
+    const int n = st->n;
+    uint64_t cover[LOGIC_MAX_BOARD_SIZE];
+    int lines[LOGIC_MAX_BOARD_SIZE];
+    int idx[3];
+
+    for (int d = 0; d < n; d++) {
+        uint64_t bit = 1ULL << d;
+
+        for (int orient = 0; orient < 2; orient++) {
+            const uint64_t *used = orient == 0 ? st->row_used : st->col_used;
+            int count = 0;
+
+            for (int line = 0; line < n; line++) {
+                if (used[line] & bit) continue;
+                uint64_t m = 0;
+                for (int i = 0; i < n; i++) {
+                    int cell = orient == 0 ? line * n + i : i * n + line;
+                    if (st->cand[cell] & bit) m |= 1ULL << i;
+                }
+                int pc = logic_popcount(m);
+                if (pc >= 2 && pc <= s) {
+                    cover[count] = m;
+                    lines[count++] = line;
+                }
+            }
+            if (count < s) continue;
+
+            for (int i = 0; i < s; i++) idx[i] = i;
+            do {
+                uint64_t cross = 0, base = 0;
+                for (int i = 0; i < s; i++) {
+                    cross |= cover[idx[i]];
+                    base |= 1ULL << lines[idx[i]];
+                }
+                if (logic_popcount(cross) != s) continue;
+
+                bool changed = false;
+                for (int line = 0; line < n; line++) {
+                    if (base & (1ULL << line)) continue;
+                    for (uint64_t m = cross; m; m &= m - 1) {
+                        int i = logic_lowest_bit(m);
+                        int cell = orient == 0 ? line * n + i : i * n + line;
+                        changed |= eliminate(st, cell, bit);
+                    }
+                }
+                if (changed) return true;
+            } while (next_combination(idx, s, count));
+        }
+    }
+    return false;
+}
+
+bool logic_propagate_singles(LogicState *st, int *naked, int *hidden) {
+    int naked_count = 0, hidden_count = 0;
+
+    while (st->empty > 0 && !st->contradiction) {
+        int placed = apply_naked_singles(st);
+        if (placed > 0) {
+            naked_count += placed;
+            continue;
+        }
+        if (apply_hidden_single(st)) {
+            hidden_count++;
+            continue;
+        }
+        break;
+    }
+
+    if (naked) *naked = naked_count;
+    if (hidden) *hidden = hidden_count;
+    return !st->contradiction;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    SEARCH FALLBACK
+// ═══════════════════════════════════════════════════════════════════
+
+static int search(LogicState *st, int limit) {
+    const int n = st->n;
+    const int cells = n * n;
+    int best = -1;
+    int best_count = n + 1;
+    uint64_t best_mask = 0;
+
+    if (--st->node_budget < 0) {
+        st->aborted = true;
+        return 0;
+    }
+
+    // MRV: the empty cell with the fewest legal digits
+    for (int cell = 0; cell < cells; cell++) {
+        if (st->value[cell] != 0) continue;
+        int r = cell / n, c = cell % n;
+        uint64_t m = st->cand[cell] & ~(st->row_used[r] | st->col_used[c]
+                                        | st->box_used[logic_box_of(st, r, c)]);
+        int pc = logic_popcount(m);
+        if (pc == 0) return 0;
+        if (pc < best_count) {
+            best = cell;
+            best_count = pc;
+            best_mask = m;
+            if (pc == 1) break;
+        }
+    }
+    if (best < 0) {
+        if (st->solution != NULL &&
+            (st->exclude == NULL || memcmp(st->value, st->exclude, sizeof(int) * cells) != 0)) {
+            memcpy(st->solution, st->value, sizeof(int) * cells);
+            st->solution = NULL;
+        }
+        return 1;   // No empty cell left: one solution
+    }
+
+    int r = best / n, c = best % n, b = logic_box_of(st, r, c);
+    int found = 0;
+
+    for (uint64_t m = best_mask; m && found < limit && !st->aborted; m &= m - 1) {
+        uint64_t bit = m & (~m + 1);
+        st->value[best] = logic_lowest_bit(bit) + 1;
+        st->row_used[r] |= bit;
+        st->col_used[c] |= bit;
+        st->box_used[b] |= bit;
+
+        found += search(st, limit - found);
+
+        st->row_used[r] &= ~bit;
+        st->col_used[c] &= ~bit;
+        st->box_used[b] &= ~bit;
+        st->value[best] = 0;
+    }
+    return found;
+}
+
+int logic_count_solutions(LogicState *st, int limit) {
+    if (st->contradiction) {
+        return 0;
+    }
+    st->aborted = false;
+    if (st->k == 2) {
+        // Every 4×4 grid is in the table: filter it instead of searching
+        int *solution = (st->exclude == NULL) ? st->solution : NULL;
+        int found = grid4_count_solutions(st->value, limit, solution);
+        if (found > 0 && solution != NULL) {
+            st->solution = NULL;
+        }
+        return found;
+    }
+    if (st->node_budget <= 0) {
+        st->node_budget = LOGIC_SEARCH_BUDGET;
+    }
+    return search(st, limit);
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    PUBLIC GRADER
+// ═══════════════════════════════════════════════════════════════════
+
+static void record(SudokuGradeResult *result, SudokuTechnique tech, int uses) {
+    result->technique_uses[tech] += uses;
+    result->score += TECHNIQUE_WEIGHT[tech] * uses;
+    if (tech > result->hardest) {
+        result->hardest = tech;
+    }
+}
+
+bool sudoku_grade_puzzle(const SudokuBoard *board, SudokuGradeResult *result) {
+    if (result == NULL) {
+        return false;
+    }
+    memset(result, 0, sizeof(*result));
+    result->difficulty = SUDOKU_INVALID;
+    result->hardest = SUDOKU_TECH_NONE;
+
+    LogicState st;
+    if (!logic_state_init(&st, board)) {
+        return false;
+    }
+
+    while (st.empty > 0 && !st.contradiction) {
+        int placed = apply_naked_singles(&st);
+        if (placed > 0) { record(result, SUDOKU_TECH_NAKED_SINGLE, placed); continue; }
+        if (apply_hidden_single(&st)) { record(result, SUDOKU_TECH_HIDDEN_SINGLE, 1); continue; }
+        if (st.contradiction) break;
+        if (apply_locked_candidates(&st)) { record(result, SUDOKU_TECH_LOCKED_CANDIDATES, 1); continue; }
+        if (apply_naked_subset(&st, 2)) { record(result, SUDOKU_TECH_NAKED_PAIR, 1); continue; }
+        if (apply_hidden_subset(&st, 2)) { record(result, SUDOKU_TECH_HIDDEN_PAIR, 1); continue; }
+        if (apply_naked_subset(&st, 3)) { record(result, SUDOKU_TECH_NAKED_TRIPLE, 1); continue; }
+        if (apply_hidden_subset(&st, 3)) { record(result, SUDOKU_TECH_HIDDEN_TRIPLE, 1); continue; }
+        if (apply_fish(&st, 2)) { record(result, SUDOKU_TECH_X_WING, 1); continue; }
+        if (apply_fish(&st, 3)) { record(result, SUDOKU_TECH_SWORDFISH, 1); continue; }
+        break;  // Logic stalled
+    }
+
+    if (st.contradiction) {
+        result->solutions = 0;
+    } else if (st.empty == 0) {
+        // Every technique above is sound, so a consistent full grid is
+        // the only solution
+        result->solutions = 1;
+        result->solved_by_logic = true;
+    } else {
+        record(result, SUDOKU_TECH_BACKTRACKING, 1);
+        result->solutions = logic_count_solutions(&st, 2);
+        if (st.aborted) {
+            result->solutions = -1;
+        }
+    }
+
+    if (result->solutions == 1 || result->solutions == -1) {
+        result->difficulty = sudoku_technique_difficulty(result->hardest);
+    }
+
+    logic_state_free(&st);
+    return true;
+}
+
+SudokuDifficulty sudoku_technique_difficulty(SudokuTechnique hardest) {
+    switch (hardest) {
+        case SUDOKU_TECH_NONE:
+        case SUDOKU_TECH_NAKED_SINGLE:
+        case SUDOKU_TECH_HIDDEN_SINGLE:
+            return SUDOKU_EASY;
+        case SUDOKU_TECH_LOCKED_CANDIDATES:
+        case SUDOKU_TECH_NAKED_PAIR:
+        case SUDOKU_TECH_HIDDEN_PAIR:
+            return SUDOKU_MEDIUM;
+        case SUDOKU_TECH_NAKED_TRIPLE:
+        case SUDOKU_TECH_HIDDEN_TRIPLE:
+        case SUDOKU_TECH_X_WING:
+        case SUDOKU_TECH_SWORDFISH:
+            return SUDOKU_HARD;
+        case SUDOKU_TECH_BACKTRACKING:
+            return SUDOKU_EXPERT;
+        default:
+            return SUDOKU_INVALID;
+    }
+}
+
+const char* sudoku_technique_to_string(SudokuTechnique technique) {
+    switch (technique) {
+        case SUDOKU_TECH_NONE:              return "None";
+        case SUDOKU_TECH_NAKED_SINGLE:      return "Naked Single";
+        case SUDOKU_TECH_HIDDEN_SINGLE:     return "Hidden Single";
+        case SUDOKU_TECH_LOCKED_CANDIDATES: return "Locked Candidates";
+        case SUDOKU_TECH_NAKED_PAIR:        return "Naked Pair";
+        case SUDOKU_TECH_HIDDEN_PAIR:       return "Hidden Pair";
+        case SUDOKU_TECH_NAKED_TRIPLE:      return "Naked Triple";
+        case SUDOKU_TECH_HIDDEN_TRIPLE:     return "Hidden Triple";
+        case SUDOKU_TECH_X_WING:            return "X-Wing";
+        case SUDOKU_TECH_SWORDFISH:         return "Swordfish";
+        case SUDOKU_TECH_BACKTRACKING:      return "Backtracking";
+        default:                            return "Unknown";
+    }
+}
@@ -0,0 +1,134 @@
+/**
+ * @file grid4.c
+ * @brief The 288 4×4 solution grids and the table-driven queries
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * See grid4_internal.h. The table was produced by enumerating every
+ * completion of the empty 4×4 board in row-major order, trying digits
+ * 1 to 4 in turn; test_grid4 checks it is complete and valid.
+ */
+
+#include <stddef.h>
+#include "internal/grid4_internal.h"
+#include "internal/random_internal.h"
+
+const uint32_t grid4_table[GRID4_COUNT] = {
+    0x1bb14ee4u, 0x93394ee4u, 0x39934ee4u, 0xb11b4ee4u, 0x4bb11ee4u, 0xb14b1ee4u,
+    0x1eb14be4u, 0xb11e4be4u, 0x4eb11be4u, 0x728d1be4u, 0x8d721be4u, 0xb14e1be4u,
+    0x1be14eb4u, 0xe11b4eb4u, 0x4be11eb4u, 0x63c91eb4u, 0xc9631eb4u, 0xe14b1eb4u,
+    0x1ee14bb4u, 0xd22d4bb4u, 0x2dd24bb4u, 0xe11e4bb4u, 0x4ee11bb4u, 0xe14e1bb4u,
+    0x27728dd8u, 0x63368dd8u, 0x36638dd8u, 0x72278dd8u, 0x87722dd8u, 0x72872dd8u,
+    0x722d87d8u, 0x2d7287d8u, 0x4eb127d8u, 0x728d27d8u, 0x8d7227d8u, 0xb14e27d8u,
+    0x27d28d78u, 0xd2278d78u, 0x87d22d78u, 0x93c62d78u, 0xc6932d78u, 0xd2872d78u,
+    0x1ee18778u, 0xd22d8778u, 0x2dd28778u, 0xe11e8778u, 0xd28d2778u, 0x8dd22778u,
+    0x2772c99cu, 0x6336c99cu, 0x3663c99cu, 0x7227c99cu, 0x63c6399cu, 0xc663399cu,
+    0x6339c69cu, 0x3963c69cu, 0x4be1369cu, 0x63c9369cu, 0xc963369cu, 0xe14b369cu,
+    0x9336c96cu, 0x3693c96cu, 0x87d2396cu, 0x93c6396cu, 0xc693396cu, 0xd287396cu,
+    0x1bb1c66cu, 0x9339c66cu, 0x3993c66cu, 0xb11bc66cu, 0x93c9366cu, 0xc993366cu,
+    0x1bb44ee1u, 0xb41b4ee1u, 0x4bb41ee1u, 0x87781ee1u, 0x78871ee1u, 0xb44b1ee1u,
+    0x1eb44be1u, 0x369c4be1u, 0x9c364be1u, 0xb41e4be1u, 0x4eb41be1u, 0xb44e1be1u,
+    0x1be44eb1u, 0x27d84eb1u, 0xd8274eb1u, 0xe41b4eb1u, 0x4be41eb1u, 0xe44b1eb1u,
+    0x1ee44bb1u, 0xe41e4bb1u, 0x4ee41bb1u, 0xc66c1bb1u, 0x6cc61bb1u, 0xe44e1bb1u,
+    0x27729cc9u, 0x63369cc9u, 0x36639cc9u, 0x72279cc9u, 0x93366cc9u, 0x36936cc9u,
+    0x366c93c9u, 0x6c3693c9u, 0x1eb463c9u, 0x369c63c9u, 0x9c3663c9u, 0xb41e63c9u,
+    0x63c69c39u, 0xc6639c39u, 0x87d26c39u, 0x93c66c39u, 0xc6936c39u, 0xd2876c39u,
+    0x4ee49339u, 0xc66c9339u, 0x6cc69339u, 0xe44e9339u, 0xc69c6339u, 0x9cc66339u,
+    0x2772d88du, 0x6336d88du, 0x3663d88du, 0x7227d88du, 0x27d2788du, 0xd227788du,
+    0x2778d28du, 0x7827d28du, 0x1be4728du, 0x27d8728du, 0xd827728du, 0xe41b728du,
+    0x8772d82du, 0x7287d82du, 0x87d2782du, 0x93c6782du, 0xc693782du, 0xd287782du,
+    0x4bb4d22du, 0x8778d22du, 0x7887d22du, 0xb44bd22du, 0x87d8722du, 0xd887722du,
+    0x27788dd2u, 0x78278dd2u, 0x4bb42dd2u, 0x87782dd2u, 0x78872dd2u, 0xb44b2dd2u,
+    0x2d7887d2u, 0x396c87d2u, 0x6c3987d2u, 0x782d87d2u, 0x8d7827d2u, 0x788d27d2u,
+    0x1be48d72u, 0x27d88d72u, 0xd8278d72u, 0xe41b8d72u, 0x87d82d72u, 0xd8872d72u,
+    0x2dd88772u, 0xd82d8772u, 0x8dd82772u, 0xc99c2772u, 0x9cc92772u, 0xd88d2772u,
+    0x63399cc6u, 0x39639cc6u, 0x1bb16cc6u, 0x93396cc6u, 0x39936cc6u, 0xb11b6cc6u,
+    0x2d7893c6u, 0x396c93c6u, 0x6c3993c6u, 0x782d93c6u, 0x399c63c6u, 0x9c3963c6u,
+    0x4be19c36u, 0x63c99c36u, 0xc9639c36u, 0xe14b9c36u, 0x93c96c36u, 0xc9936c36u,
+    0xc96c9336u, 0x6cc99336u, 0x8dd86336u, 0xc99c6336u, 0x9cc96336u, 0xd88d6336u,
+    0x1bb1e44eu, 0x9339e44eu, 0x3993e44eu, 0xb11be44eu, 0x1be1b44eu, 0xe11bb44eu,
+    0x1bb4e14eu, 0xb41be14eu, 0x1be4b14eu, 0x27d8b14eu, 0xd827b14eu, 0xe41bb14eu,
+    0x4bb1e41eu, 0xb14be41eu, 0x4be1b41eu, 0x63c9b41eu, 0xc963b41eu, 0xe14bb41eu,
+    0x4bb4e11eu, 0x8778e11eu, 0x7887e11eu, 0xb44be11eu, 0x4be4b11eu, 0xe44bb11eu,
+    0x366cc993u, 0x6c36c993u, 0x4ee43993u, 0xc66c3993u, 0x6cc63993u, 0xe44e3993u,
+    0x2d78c693u, 0x396cc693u, 0x6c39c693u, 0x782dc693u, 0xc96c3693u, 0x6cc93693u,
+    0x1eb4c963u, 0x369cc963u, 0x9c36c963u, 0xb41ec963u, 0xc69c3963u, 0x9cc63963u,
+    0x399cc663u, 0x9c39c663u, 0x8dd83663u, 0xc99c3663u, 0x9cc93663u, 0xd88d3663u,
+    0x722dd887u, 0x2d72d887u, 0x1ee17887u, 0xd22d7887u, 0x2dd27887u, 0xe11e7887u,
+    0x2d78d287u, 0x396cd287u, 0x6c39d287u, 0x782dd287u, 0x2dd87287u, 0xd82d7287u,
+    0x4eb1d827u, 0x728dd827u, 0x8d72d827u, 0xb14ed827u, 0xd28d7827u, 0x8dd27827u,
+    0x8d78d227u, 0x788dd227u, 0x8dd87227u, 0xc99c7227u, 0x9cc97227u, 0xd88d7227u,
+    0x1eb1e44bu, 0xb11ee44bu, 0x1ee1b44bu, 0xd22db44bu, 0x2dd2b44bu, 0xe11eb44bu,
+    0x1eb4e14bu, 0x369ce14bu, 0x9c36e14bu, 0xb41ee14bu, 0x1ee4b14bu, 0xe41eb14bu,
+    0x4eb1e41bu, 0x728de41bu, 0x8d72e41bu, 0xb14ee41bu, 0x4ee1b41bu, 0xe14eb41bu,
+    0x4eb4e11bu, 0xb44ee11bu, 0x4ee4b11bu, 0xc66cb11bu, 0x6cc6b11bu, 0xe44eb11bu,
+};
+
+/**
+ * @brief Pack the givens of a board into value and mask words
+ *
+ * @return false if a cell holds a value outside 0..4 (no grid matches)
+ */
+static bool pack_givens(const int *cells, uint32_t *value, uint32_t *mask) {
+    uint32_t v = 0, m = 0;
+    for (int i = 0; i < GRID4_CELLS; i++) {
+        int digit = cells[i];
+        if (digit == 0) {
+            continue;
+        }
+        if (digit < 1 || digit > 4) {
+            return false;
+        }
+        v |= (uint32_t)(digit - 1) << (2 * i);
+        m |= 3u << (2 * i);
+    }
+    *value = v;
+    *mask = m;
+    return true;
+}
+
+void grid4_unpack(int index, int *cells) {
+    uint32_t grid = grid4_table[index];
+    for (int i = 0; i < GRID4_CELLS; i++) {
+        cells[i] = (int)((grid >> (2 * i)) & 3u) + 1;
+    }
+}
+
+int grid4_count_solutions(const int *cells, int limit, int *solution) {
+    uint32_t value, mask;
+    if (!pack_givens(cells, &value, &mask)) {
+        return 0;
+    }
+
+    int found = 0;
+    for (int g = 0; g < GRID4_COUNT && found < limit; g++) {
+        if ((grid4_table[g] & mask) == value) {
+            if (found == 0 && solution != NULL) {
+                grid4_unpack(g, solution);
+            }
+            found++;
+        }
+    }
+    return found;
+}
+
+bool grid4_random_completion(const int *cells, int *solution) {
+    uint32_t value, mask;
+    if (!pack_givens(cells, &value, &mask)) {
+        return false;
+    }
+
+    // Indices of the matching grids, then one draw among them
+    int16_t matches[GRID4_COUNT];
+    int count = 0;
+    for (int g = 0; g < GRID4_COUNT; g++) {
+        if ((grid4_table[g] & mask) == value) {
+            matches[count++] = (int16_t)g;
+        }
+    }
+    if (count == 0) {
+        return false;
+    }
+    grid4_unpack(matches[random_below(count)], solution);
+    return true;
+}
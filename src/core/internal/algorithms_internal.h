@@ -5,6 +5,7 @@
 
 #include <stdbool.h>
 #include "sudoku/core/board.h"
+#include "sudoku/core/cancel.h"
 
 /**
  * @brief Completa el tablero usando backtracking recursivo
@@ -14,6 +15,24 @@
  */
 bool sudoku_complete_backtracking(SudokuBoard *board);
 
+/**
+ * @brief Backtracking con presupuesto de nodos
+ * 
+ * Igual que sudoku_complete_backtracking(), pero abandona tras
+ * node_budget nodos de recursión para que el llamador reinicie con
+ * aleatoriedad nueva (ver fill_with_restarts() en generator.c).
+ * 
+ * @param board Puntero al tablero a completar
+ * @param node_budget Máximo de nodos (≤ 0 = sin límite)
+ * @param[out] nodes_used Nodos visitados (puede ser NULL)
+ * @param interrupt Token de cancelación / plazo límite (NULL = ninguno)
+ * @return true si se completó, false si no hay solución, se agotó el
+ *         presupuesto o se interrumpió la búsqueda
+ */
+bool sudoku_complete_backtracking_budget(SudokuBoard *board, long node_budget,
+                                         long *nodes_used,
+                                         const SudokuInterrupt *interrupt);
+
 /**
  * @brief Genera una permutación aleatoria de números consecutivos
  * 
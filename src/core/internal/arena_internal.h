@@ -0,0 +1,46 @@
+/**
+ * @file arena_internal.h
+ * @brief Scratch-arena access for library internals
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * Internal buffers (Phase 1/3 position lists, backtracking frames, the
+ * grader's candidate masks...) are taken from the arena returned by
+ * arena_scratch() between a mark and a release:
+ *
+ * @code
+ * SudokuArena *arena = arena_scratch();
+ * SudokuArenaMark mark = sudoku_arena_mark(arena);
+ * int *buffer = sudoku_arena_alloc(arena, n * sizeof(int));
+ * ...
+ * sudoku_arena_release(arena, mark);
+ * @endcode
+ *
+ * Because every user releases in LIFO order, nested callers (generator →
+ * Phase 3 → grader) share the same arena without interfering.
+ */
+
+#ifndef SUDOKU_ARENA_INTERNAL_H
+#define SUDOKU_ARENA_INTERNAL_H
+
+#include "sudoku/core/arena.h"
+
+/**
+ * @brief Arena for internal scratch buffers on the calling thread
+ *
+ * Returns the arena installed with arena_set_active() if any, else the
+ * thread's own scratch arena (created on first call).
+ *
+ * @return Arena, or NULL only if creating the scratch arena failed
+ */
+SudokuArena* arena_scratch(void);
+
+/**
+ * @brief Route this thread's scratch allocations to a caller arena
+ *
+ * @param arena Arena to use, or NULL to go back to the thread scratch
+ * @return Previously active arena, to be restored afterwards
+ */
+SudokuArena* arena_set_active(SudokuArena *arena);
+
+#endif // SUDOKU_ARENA_INTERNAL_H
@@ -18,7 +18,10 @@
 #define SUDOKU_BOARD_INTERNAL_H
 
 #include "sudoku/core/types.h"
+#include "zobrist_internal.h"
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 /**
  * @brief Finds the first empty cell in the board using row-major traversal
@@ -52,155 +55,68 @@ bool sudoku_find_empty_cell(const SudokuBoard *board, SudokuPosition *pos);
 void fillSubGrid(SudokuBoard *board, const SudokuSubGrid *sg);
 void fillDiagonal(SudokuBoard *board);
 
+/**
+ * @brief Write a random valid full grid without searching
+ *
+ * Canonical shifted pattern, then a random SUDOKU_TRANSFORM_ALL
+ * transform (see algorithms/pattern.c). O(n²), any board size.
+ *
+ * @return false only if the transform's scratch allocation failed
+ */
+bool fillPattern(SudokuBoard *board);
+
 // Actualización de contadores (wrapper)
 void sudoku_board_update_stats(SudokuBoard *board);
 
+// SudokuBoard itself is defined in sudoku/core/types.h (cells, counters, hash)
+
+// ═══════════════════════════════════════════════════════════════════
+//                    FAST CELL ACCESS
+// ═══════════════════════════════════════════════════════════════════
+
 /**
- * @brief Complete internal definition of SudokuBoard
- * 
- * PHASE 2A: DYNAMIC MEMORY ARCHITECTURE
- * =======================================
- * 
- * This structure now supports configurable board sizes through dynamic
- * memory allocation. The key changes from v2.2.x:
- * 
- * BEFORE (v2.2.x - Static Array):
- *   int cells[SUDOKU_SIZE][SUDOKU_SIZE];  // Fixed 9×9, 324 bytes
- * 
- * AFTER (v3.0 - Dynamic Array):
- *   int **cells;                            // Pointer to pointer
- *   int subgrid_size;                       // Size of subgrids (2-5)
- *   int board_size;                         // Full board size (4-25)
- *   int total_cells;                        // Total cells in board
- * 
- * MEMORY LAYOUT EXAMPLE (4×4 board):
- * ===================================
- * 
- * board->cells → [ptr0] → [1][2][3][4]  ← Row 0
- *                [ptr1] → [5][6][7][8]  ← Row 1
- *                [ptr2] → [9][0][0][0]  ← Row 2
- *                [ptr3] → [0][0][0][0]  ← Row 3
- * 
- * ALLOCATION STRATEGY:
- * ====================
- * 1. Allocate array of row pointers: malloc(board_size * sizeof(int*))
- * 2. For each row, allocate column array: malloc(board_size * sizeof(int))
- * 
- * DEALLOCATION STRATEGY:
- * ======================
- * 1. Free each row individually: free(cells[i]) for i in [0, board_size)
- * 2. Free the row pointer array: free(cells)
+ * @brief Zobrist key of @p value in flat cell index @p cell (0 for empty)
+ */
+static inline uint64_t board_cell_key(const SudokuBoard *board, int cell, int value) {
+    return board->zobrist != NULL
+         ? board->zobrist[cell * (board->board_size + 1) + value]
+         : zobrist_key(board->subgrid_size, cell, value);
+}
+
+/**
+ * @brief Zobrist hash of the current cells, from scratch: O(n²)
  * 
- * CLIENT CODE COMPATIBILITY:
- * ==========================
- * The syntax board->cells[row][col] remains IDENTICAL to static arrays.
- * This is the beauty of C's pointer arithmetic - the [][] operator works
- * seamlessly with both static and dynamic 2D arrays.
+ * What board->hash must equal. Values outside 0..board_size can only be
+ * written directly (the setters refuse them); they get a computed key
+ * instead of an index past the end of the key table.
+ */
+static inline uint64_t board_hash_from_cells(const SudokuBoard *board) {
+    const int *values = board->cells[0];
+    uint64_t hash = zobrist_salt(board->subgrid_size);
+    for (int cell = 0; cell < board->total_cells; cell++) {
+        int value = values[cell];
+        hash ^= (value >= 0 && value <= board->board_size)
+              ? board_cell_key(board, cell, value)
+              : zobrist_key(board->subgrid_size, cell, value);
+    }
+    return hash;
+}
+
+/**
+ * @brief Write a cell and update the hash, without any checks
  * 
- * WHY DYNAMIC ALLOCATION?
- * =======================
- * 1. Flexibility: Support any valid Sudoku size at runtime
- * 2. Memory efficiency: Only allocate what's needed
- * 3. Scalability: Can handle very large boards (25×25 = 625 cells)
- * 4. Professional practice: Standard approach for variable-size data
+ * The setter for the generator and the elimination phases: no bounds
+ * or value validation and no statistics update, just the write and two
+ * XORs on board->hash. Temporary write-and-restore probes may keep
+ * writing cells directly; the hash is right again once they restore.
  * 
- * EDUCATIONAL NOTE:
- * =================
- * This transformation from static to dynamic arrays is a fundamental
- * skill in systems programming. The key insight is that int** creates
- * a "pointer to pointer" structure that mimics 2D array syntax while
- * allowing runtime size determination.
+ * @pre 0 <= row, col < board_size and 0 <= value <= board_size
  */
-struct SudokuBoard {
-    // ═══════════════════════════════════════════════════════════
-    //  DYNAMIC MEMORY: The 2D Cell Grid
-    // ═══════════════════════════════════════════════════════════
-    
-    /**
-     * @brief Dynamic 2D array of cell values
-     * 
-     * This is allocated as an array of pointers, where each pointer
-     * points to a row of integers. Access syntax remains identical
-     * to static arrays: cells[row][col]
-     * 
-     * Memory ownership: This structure owns this memory and is
-     * responsible for freeing it in sudoku_board_destroy()
-     * 
-     * Valid values: 0 (empty) or 1 to board_size (filled)
-     */
-    int **cells;
-    
-    // ═══════════════════════════════════════════════════════════
-    //  DIMENSION TRACKING: Board Geometry
-    // ═══════════════════════════════════════════════════════════
-    
-    /**
-     * @brief Size of each subgrid (2, 3, 4, or 5)
-     * 
-     * Examples:
-     * - subgrid_size = 2 → 2×2 subgrids in 4×4 board
-     * - subgrid_size = 3 → 3×3 subgrids in 9×9 board (classic)
-     * - subgrid_size = 4 → 4×4 subgrids in 16×16 board
-     * - subgrid_size = 5 → 5×5 subgrids in 25×25 board
-     */
-    int subgrid_size;
-    
-    /**
-     * @brief Full size of the board (subgrid_size²)
-     * 
-     * This is the number of rows and columns in the board.
-     * 
-     * Formula: board_size = subgrid_size × subgrid_size
-     * 
-     * Examples:
-     * - subgrid_size = 2 → board_size = 4
-     * - subgrid_size = 3 → board_size = 9
-     * - subgrid_size = 4 → board_size = 16
-     */
-    int board_size;
-    
-    /**
-     * @brief Total number of cells in the board (board_size²)
-     * 
-     * This is a cached value for performance - we could always
-     * compute it as board_size * board_size, but storing it
-     * avoids repeated multiplication in hot paths.
-     * 
-     * Formula: total_cells = board_size × board_size
-     * 
-     * Examples:
-     * - board_size = 4 → total_cells = 16
-     * - board_size = 9 → total_cells = 81
-     * - board_size = 16 → total_cells = 256
-     * 
-     * Invariant: clues + empty = total_cells (always)
-     */
-    int total_cells;
-    
-    // ═══════════════════════════════════════════════════════════
-    //  STATISTICS: Cell Counts (Cached for Performance)
-    // ═══════════════════════════════════════════════════════════
-    
-    /**
-     * @brief Number of filled cells (non-zero values)
-     * 
-     * This is updated by sudoku_board_update_stats() and represents
-     * the count of cells containing values from 1 to board_size.
-     * 
-     * Valid range: [0, total_cells]
-     */
-    int clues;
-    
-    /**
-     * @brief Number of empty cells (zero values)
-     * 
-     * This is the complement of clues. It represents the count of
-     * cells that still need to be filled.
-     * 
-     * Valid range: [0, total_cells]
-     * Invariant: empty = total_cells - clues
-     */
-    int empty;
-};
+static inline void board_set_cell_fast(SudokuBoard *board, int row, int col, int value) {
+    int *slot = &board->cells[row][col];
+    int cell = row * board->board_size + col;
+    board->hash ^= board_cell_key(board, cell, *slot) ^ board_cell_key(board, cell, value);
+    *slot = value;
+}
 
 #endif // SUDOKU_BOARD_INTERNAL_H
@@ -39,7 +39,9 @@
 #define SUDOKU_ELIMINATION_INTERNAL_H
 
 #include <stdbool.h>
+#include <stdint.h>
 #include "sudoku/core/types.h"
+#include "sudoku/core/cancel.h"
 
 // ═══════════════════════════════════════════════════════════════
 //                    PHASE 1: BALANCED DISTRIBUTION
@@ -67,6 +69,20 @@
  */
 int phase1Elimination(SudokuBoard *board, const int *index, int count);
 
+/**
+ * @brief Phase 1 keeping a symmetric clue pattern
+ * 
+ * Same selection as phase1Elimination(); the chosen cell is removed
+ * together with its orbit, and only if every clue of the orbit is
+ * forced (see symmetry_remove_orbit_if_forced()). Otherwise the
+ * subgrid is left untouched.
+ * 
+ * @param symmetry SUDOKU_SYMMETRY_NONE behaves like phase1Elimination()
+ * @return Number of cells removed
+ */
+int phase1EliminationEx(SudokuBoard *board, const int *index, int count,
+                        SudokuSymmetry symmetry);
+
 // ═══════════════════════════════════════════════════════════════
 //                    PHASE 2: HEURISTIC ELIMINATION
 // ═══════════════════════════════════════════════════════════════
@@ -90,7 +106,9 @@ int phase1Elimination(SudokuBoard *board, const int *index, int count);
  * cells, hence the iterative approach.
  * 
  * CONFIGURABLE SIZE SUPPORT:
- * - hasAlternative() checks use dynamic row/column/subgrid bounds
+ * - Boards up to 64×64: O(1) alternative test on incremental position
+ *   masks rebuilt once per round (O(n²) per round)
+ * - Larger boards: hasAlternative() with dynamic row/column/subgrid bounds
  * - Subgrid iteration uses board->board_size
  * 
  * @param board Board with partially filled solution
@@ -100,6 +118,20 @@ int phase1Elimination(SudokuBoard *board, const int *index, int count);
  */
 int phase2Elimination(SudokuBoard *board, const int *index, int count);
 
+/**
+ * @brief Phase 2 keeping a symmetric clue pattern
+ * 
+ * A cell without alternative is removed together with its orbit, and
+ * only if each other clue of the orbit is also without alternative at
+ * the moment it is removed; otherwise the orbit is restored and the
+ * scan of the subgrid goes on.
+ * 
+ * @param symmetry SUDOKU_SYMMETRY_NONE behaves like phase2Elimination()
+ * @return Number of cells removed in this round (0 when converged)
+ */
+int phase2EliminationEx(SudokuBoard *board, const int *index, int count,
+                        SudokuSymmetry symmetry);
+
 // ═══════════════════════════════════════════════════════════════
 //                    PHASE 3: VERIFIED ELIMINATION
 // ═══════════════════════════════════════════════════════════════
@@ -124,6 +156,121 @@ int phase2Elimination(SudokuBoard *board, const int *index, int count);
  */
 int phase3Elimination(SudokuBoard *board, int target);
 
+/**
+ * @brief Removal target used by phase3EliminationAuto()
+ * 
+ * 31% of the cells for boards up to 9×9, 27% up to 16×16, 23% above.
+ */
+int calculate_phase3_target(const SudokuBoard *board);
+
+/**
+ * @brief Uniqueness checks performed by phase3EliminationEx()
+ */
+typedef struct {
+    int probes;         ///< Solver calls (countSolutionsExact or grader)
+    int probes_saved;   ///< Removals certified by singles instead
+    int probes_refuted; ///< Removals rejected by a cached counterexample
+} Phase3Probes;
+
+/** @brief Counterexamples kept per grid (oldest overwritten beyond that) */
+#define PHASE3_COUNTEREXAMPLES_MAX 256
+
+/**
+ * @brief Second solutions found by Phase 3 while carving one grid
+ * 
+ * When a probe rejects a removal, the reduced puzzle has a solution
+ * other than the grid. Only the cells where that alternate differs
+ * from the grid are kept, as a bitmask. The alternate solves every
+ * puzzle of the same grid that has no clue inside the mask. So a later
+ * removal that leaves the mask free of clues is rejected without a
+ * probe.
+ * 
+ * A single Phase 3 pass never benefits: the clue whose removal
+ * exposed the alternate is put back and never decided again. Later
+ * carves of the same grid do (sudoku_generate_variants()).
+ */
+typedef struct {
+    const int *solution;    ///< Grid shared by every carve (n*n values, row-major)
+    int cells;              ///< n*n
+    int words;              ///< uint64_t words per mask
+    int count;              ///< Masks stored
+    int next;               ///< Slot the next mask overwrites once full
+    uint64_t *masks;        ///< PHASE3_COUNTEREXAMPLES_MAX × words
+    int *scratch;           ///< n*n values: alternate being recorded
+} Phase3Counterexamples;
+
+/**
+ * @brief Empty cache for puzzles carved from @p grid
+ * 
+ * Memory comes from @p arena and lives until the caller rewinds it;
+ * @p grid must outlive the cache.
+ * 
+ * @return false if allocation failed (cx is then unusable)
+ */
+bool phase3_counterexamples_init(Phase3Counterexamples *cx, const SudokuBoard *grid,
+                                 SudokuArena *arena);
+
+/**
+ * @brief Options for phase3EliminationEx()
+ * 
+ * Zero-initialised fields reproduce the classic behaviour except for
+ * max_removals, which must always be set (ignored in minimal mode).
+ */
+typedef struct {
+    int max_removals;                   ///< Stop after this many removals
+    bool use_target_difficulty;         ///< Grade removals against target
+    SudokuDifficulty target_difficulty; ///< Requested bucket
+    bool minimal;                       ///< Decide every clue (ignored when targeting)
+    Phase3Probes *probes;               ///< Optional probe counters (may be NULL)
+    const SudokuInterrupt *interrupt;   ///< Checked before every probe (NULL = none)
+    SudokuSymmetry symmetry;            ///< Remove whole orbits, one probe each
+    Phase3Counterexamples *counterexamples; ///< Alternates of this grid (NULL = none)
+} Phase3Config;
+
+/**
+ * @brief How phase3EliminationEx() finished
+ */
+typedef enum {
+    PHASE3_COMPLETED = 0,           ///< Classic run (no targeting)
+    PHASE3_TARGET_REACHED,          ///< Puzzle is in the requested bucket
+    PHASE3_TARGET_UNREACHABLE,      ///< Abandoned: target cannot be met
+    PHASE3_INTERRUPTED              ///< Stopped by config->interrupt
+} Phase3Outcome;
+
+/**
+ * @brief Phase 3 with difficulty targeting and early abort
+ * 
+ * Same removal loop as phase3Elimination(). When targeting is enabled:
+ * - Removals that push the grade above the target are undone
+ * - The phase stops once the grade matches and the clue count is
+ *   within the target's band (55% / 43% / 31% of cells)
+ * - It gives up early if the puzzle is already too hard, or if the
+ *   unprobed cells cannot bring the clue count into the band
+ * 
+ * In minimal mode every clue is decided once, most-alternatives first,
+ * and the result is a minimal puzzle (no clue can be removed).
+ * 
+ * Without targeting, a removal that leaves the value as a naked or
+ * hidden single, or whose puzzle singles alone still solve, is
+ * accepted without calling the solver; those are counted in
+ * Phase3Probes::probes_saved.
+ * 
+ * With config->counterexamples, removals that a known alternate still
+ * solves are rejected without calling the solver
+ * (Phase3Probes::probes_refuted), and every rejection found by a
+ * probe adds its alternate to the cache.
+ * 
+ * @param board Board after Phases 1 and 2
+ * @param config Removal limit and optional difficulty target
+ * @param[out] outcome How the phase ended (may be NULL)
+ * @return Number of cells removed
+ * 
+ * @note On PHASE3_TARGET_UNREACHABLE the board is still a valid unique
+ *       puzzle, just not of the requested difficulty
+ */
+int phase3EliminationEx(SudokuBoard *board, const Phase3Config *config,
+                        Phase3Outcome *outcome);
+
 /**
  * @brief Phase 3 elimination with automatic target calculation
  * 
@@ -176,10 +323,48 @@ int phase3EliminationAuto(SudokuBoard *board);
  * @param num The number to check for alternatives
  * @return true if at least one alternative position exists
  * 
- * @internal Used by phase2Elimination()
+ * @internal Used by phase2Elimination() for boards above 64×64 (smaller
+ *           boards use the equivalent position-mask test)
  */
 bool hasAlternative(SudokuBoard *board, const SudokuPosition *pos, int num);
 
+// ═══════════════════════════════════════════════════════════════
+//                    SYMMETRY (symmetry.c)
+// ═══════════════════════════════════════════════════════════════
+
+/** @brief Largest orbit of any SudokuSymmetry (quarter turn) */
+#define SYMMETRY_ORBIT_MAX 4
+
+/**
+ * @brief Cells of the orbit of (row, col), starting with (row, col)
+ * 
+ * @param board_size Board side n
+ * @param symmetry Symmetry (NONE gives an orbit of size 1)
+ * @param[out] orbit Orbit cells, no duplicates
+ * @return Orbit size (1 to SYMMETRY_ORBIT_MAX)
+ */
+int symmetry_orbit(int board_size, SudokuSymmetry symmetry, int row, int col,
+                   SudokuPosition orbit[SYMMETRY_ORBIT_MAX]);
+
+/**
+ * @brief true if (row, col) is the first cell of its orbit in row-major
+ *        order (used to visit every orbit exactly once)
+ */
+bool symmetry_is_representative(int board_size, SudokuSymmetry symmetry, int row, int col);
+
+/**
+ * @brief Remove the clues of an orbit one by one while each is forced
+ * 
+ * A clue is forced when hasAlternative() is false at the moment it is
+ * removed; such removals keep the solution unique without the solver.
+ * If any clue is not forced, the orbit is restored completely.
+ * 
+ * @param[out] values Previous value of each orbit cell (0 if it was empty)
+ * @return Clues removed (0 if the orbit was restored or already empty)
+ */
+int symmetry_remove_orbit_if_forced(SudokuBoard *board, const SudokuPosition *orbit,
+                                    int size, int *values);
+
 /**
  * @brief Count solutions with early exit optimization
  * 
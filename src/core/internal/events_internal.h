@@ -14,6 +14,8 @@
 #define SUDOKU_EVENTS_INTERNAL_H
 
 #include "sudoku/core/types.h"
+#include <stdbool.h>
+#include <stdint.h>
 
 /**
  * @brief Initialize the event system with a callback
@@ -22,10 +24,40 @@
  * 
  * @param callback Callback function to receive events (NULL to disable)
  * @param user_data Custom data to pass to callback
+ * @param mask Subscribed event types, built with SUDOKU_EVENT_BIT()
+ *             (0 = every event)
  * 
  * @internal Called by sudoku_generate_ex()
  */
-void events_init(SudokuEventCallback callback, void *user_data);
+void events_init(SudokuEventCallback callback, void *user_data, uint64_t mask);
+
+/**
+ * @brief Event types with a live subscriber
+ * 
+ * 0 when no callback is registered. Read through events_wanted() only.
+ * Thread-local: events_init() only affects the calling thread.
+ * 
+ * @internal Written by events_init()
+ */
+extern _Thread_local uint64_t events_subscribed;
+
+/**
+ * @brief Check whether anyone listens to an event type
+ * 
+ * emit_event() and emit_event_cell() test this BEFORE evaluating their
+ * arguments or building a SudokuEventData, so an unsubscribed per-cell
+ * event costs one shift and one branch.
+ * 
+ * With SUDOKU_DISABLE_EVENTS defined (CMake option of the same name)
+ * this is the constant false and every emission is compiled out.
+ */
+#ifdef SUDOKU_DISABLE_EVENTS
+#define events_wanted(type) ((void)(type), false)
+#else
+static inline bool events_wanted(SudokuEventType type) {
+    return (events_subscribed >> type) & 1u;
+}
+#endif
 
 /**
  * @brief Emit a simple event (no cell-specific data)
@@ -37,12 +69,22 @@ void events_init(SudokuEventCallback callback, void *user_data);
  * @param phase Phase number (1, 2, or 3; use 0 if not applicable)
  * @param cells_removed Total cells removed in this phase
  * 
+ * @note Called through the emit_event() macro, which skips the call
+ *       when events_wanted(type) is false
+ * 
  * @internal Used throughout generation code
  */
-void emit_event(SudokuEventType type,
-                const SudokuBoard *board,
-                int phase,
-                int cells_removed);
+void events_emit(SudokuEventType type,
+                 const SudokuBoard *board,
+                 int phase,
+                 int cells_removed);
+
+#define emit_event(type, board, phase, cells_removed) \
+    do { \
+        if (events_wanted(type)) { \
+            events_emit((type), (board), (phase), (cells_removed)); \
+        } \
+    } while (0)
 
 /**
  * @brief Emit a cell-specific event
@@ -57,14 +99,24 @@ void emit_event(SudokuEventType type,
  * @param col Column of the cell
  * @param value Value in the cell
  * 
+ * @note Called through the emit_event_cell() macro (see emit_event())
+ * 
  * @internal Used in elimination phases
  */
-void emit_event_cell(SudokuEventType type,
-                     const SudokuBoard *board,
-                     int phase,
-                     int cells_removed,
-                     int row,
-                     int col,
-                     int value);
+void events_emit_cell(SudokuEventType type,
+                      const SudokuBoard *board,
+                      int phase,
+                      int cells_removed,
+                      int row,
+                      int col,
+                      int value);
+
+#define emit_event_cell(type, board, phase, cells_removed, row, col, value) \
+    do { \
+        if (events_wanted(type)) { \
+            events_emit_cell((type), (board), (phase), (cells_removed), \
+                             (row), (col), (value)); \
+        } \
+    } while (0)
 
 #endif // SUDOKU_EVENTS_INTERNAL_H
@@ -14,6 +14,7 @@
 #define SUDOKU_GENERATOR_INTERNAL_H
 
 #include "sudoku/core/types.h"
+#include "sudoku/core/cancel.h"
 #include <stdbool.h>
 
 /**
@@ -38,6 +39,18 @@
  */
 bool sudoku_complete_backtracking(SudokuBoard *board);
 
+/**
+ * @brief Node-budgeted variant of sudoku_complete_backtracking()
+ * 
+ * @param node_budget Maximum recursion nodes (≤ 0 = unlimited)
+ * @param[out] nodes_used Nodes visited (may be NULL)
+ * @param interrupt Cancellation token / deadline (NULL = none)
+ * @return false on dead end, budget exhaustion OR interruption
+ */
+bool sudoku_complete_backtracking_budget(SudokuBoard *board, long node_budget,
+                                         long *nodes_used,
+                                         const SudokuInterrupt *interrupt);
+
 /**
  * @brief Counts the number of solutions to a puzzle
  * 
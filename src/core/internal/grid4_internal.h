@@ -0,0 +1,73 @@
+/**
+ * @file grid4_internal.h
+ * @brief Every 4×4 solution grid, and queries answered from that table
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * A 4×4 Sudoku has exactly 288 solution grids, few enough to list them
+ * all. With the table, every question the library asks about a 4×4
+ * board becomes a scan of 288 words instead of a search:
+ *
+ * - Counting solutions counts the grids that agree with the givens
+ * - Completing a board (generation fill, solving) picks one of those
+ *   grids uniformly at random; on the empty board that is a uniform
+ *   draw over all 4×4 Sudokus
+ *
+ * Each grid is packed into a uint32_t, 2 bits per cell in row-major
+ * order (cell i at bits 2i..2i+1, holding digit - 1). The givens of a
+ * board pack the same way into a value and a mask with 0b11 over every
+ * filled cell, so "grid agrees with the givens" is one AND and one
+ * compare.
+ *
+ * INTERNAL USE ONLY - Not part of public API
+ */
+
+#ifndef SUDOKU_GRID4_INTERNAL_H
+#define SUDOKU_GRID4_INTERNAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** @brief Number of 4×4 solution grids */
+#define GRID4_COUNT 288
+
+/** @brief Cells of a 4×4 board */
+#define GRID4_CELLS 16
+
+/**
+ * @brief All 4×4 solution grids, packed, in lexicographic row-major order
+ */
+extern const uint32_t grid4_table[GRID4_COUNT];
+
+/**
+ * @brief Count the solutions of a 4×4 board by filtering the table
+ *
+ * Same result as the backtracking counters: conflicting givens, or a
+ * value outside 1..4, leave no grid and give 0.
+ *
+ * @param cells 16 values in row-major order (0 = empty)
+ * @param limit Stop after this many solutions
+ * @param solution If non-NULL, receives the first matching grid (16
+ *                 values); untouched when there is none
+ * @return Solutions found (≤ limit)
+ */
+int grid4_count_solutions(const int *cells, int limit, int *solution);
+
+/**
+ * @brief Pick a uniformly random solution of a 4×4 board
+ *
+ * Draws from the calling thread's generator (random_internal.h), so
+ * seeded generation stays reproducible.
+ *
+ * @param cells 16 values in row-major order (0 = empty)
+ * @param[out] solution Receives the chosen grid (16 values)
+ * @return false if the board has no solution (@p solution untouched)
+ */
+bool grid4_random_completion(const int *cells, int *solution);
+
+/**
+ * @brief Unpack grid @p index of the table into 16 values
+ */
+void grid4_unpack(int index, int *cells);
+
+#endif // SUDOKU_GRID4_INTERNAL_H
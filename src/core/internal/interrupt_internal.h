@@ -0,0 +1,69 @@
+/**
+ * @file interrupt_internal.h
+ * @brief Amortised cancellation/deadline polling for search loops
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * sudoku_interrupt_check() loads an atomic and may read the clock; a
+ * search visiting millions of nodes only pays for it once every
+ * SUDOKU_INTERRUPT_INTERVAL nodes. Once a poller sees an interruption
+ * it stays interrupted, so every recursion level unwinds.
+ *
+ * INTERNAL USE ONLY - Not part of public API
+ */
+
+#ifndef SUDOKU_INTERRUPT_INTERNAL_H
+#define SUDOKU_INTERRUPT_INTERNAL_H
+
+#include "sudoku/core/cancel.h"
+#include <stdbool.h>
+
+/**
+ * @brief Node countdown in front of a SudokuInterrupt
+ */
+typedef struct {
+    const SudokuInterrupt *source;  ///< Conditions (NULL = never interrupted)
+    unsigned countdown;             ///< Nodes until the next real check
+    SudokuStatus status;            ///< SUDOKU_STATUS_OK until interrupted
+} InterruptPoller;
+
+static inline void interrupt_poller_init(InterruptPoller *poller,
+                                         const SudokuInterrupt *source) {
+    poller->source = source;
+    poller->countdown = SUDOKU_INTERRUPT_INTERVAL;
+    poller->status = SUDOKU_STATUS_OK;
+}
+
+/**
+ * @brief Count one node; true if the search must stop
+ */
+static inline bool interrupt_poller_tick(InterruptPoller *poller) {
+    if (poller->source == NULL) {
+        return false;
+    }
+    if (poller->status != SUDOKU_STATUS_OK) {
+        return true;
+    }
+    if (--poller->countdown > 0) {
+        return false;
+    }
+    poller->countdown = SUDOKU_INTERRUPT_INTERVAL;
+    poller->status = sudoku_interrupt_check(poller->source);
+    return poller->status != SUDOKU_STATUS_OK;
+}
+
+/**
+ * @brief SudokuInterrupt built from a generation config, or NULL when
+ *        the config sets neither a token nor a deadline
+ */
+static inline const SudokuInterrupt* interrupt_from_config(const SudokuGenerationConfig *config,
+                                                           SudokuInterrupt *storage) {
+    if (config == NULL || (config->cancel == NULL && config->deadline_ns == 0)) {
+        return NULL;
+    }
+    storage->cancel = config->cancel;
+    storage->deadline_ns = config->deadline_ns;
+    return storage;
+}
+
+#endif // SUDOKU_INTERRUPT_INTERNAL_H
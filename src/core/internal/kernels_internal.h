@@ -0,0 +1,70 @@
+/**
+ * @file kernels_internal.h
+ * @brief Hot kernels specialised per board geometry
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * The public functions work for any subgrid_size, so every loop bound,
+ * box corner and index is computed from the board at run time. The
+ * four geometries we actually ship (4×4, 9×9, 16×16, 25×25) instead get
+ * their own copy of each kernel, stamped out from kernels_template.h
+ * with N and K as compile-time constants:
+ *
+ * - Loops have constant trip counts and are fully unrolled
+ * - Row/box arithmetic is by a constant (no division instructions),
+ *   and the search kernels precompute each cell's box once per call
+ * - The cells are addressed as one flat row-major array
+ *
+ * sudoku_kernels_for() is the dispatcher keyed on subgrid_size; it
+ * returns NULL for any other geometry and callers keep their generic
+ * code for those. Every kernel gives exactly the results of the
+ * generic code, including the search order of the solution counter.
+ * On 16×16 and 25×25 the counter also consults a transposition table
+ * (solution_cache_internal.h), which skips subtrees it has already
+ * counted: same results, fewer nodes. Its keys are the ones behind
+ * SudokuBoard::hash, recomputed from the cells on every call.
+ *
+ * INTERNAL USE ONLY - Not part of public API
+ */
+
+#ifndef SUDOKU_KERNELS_INTERNAL_H
+#define SUDOKU_KERNELS_INTERNAL_H
+
+#include <stdbool.h>
+#include "sudoku/core/types.h"
+#include "interrupt_internal.h"
+
+/**
+ * @brief Kernel table for one geometry
+ *
+ * @c cells is board->cells[0]: the board_size² values in row-major
+ * order (see SudokuBoard::cells).
+ */
+typedef struct {
+    int subgrid_size;
+
+    /** @brief sudoku_is_safe_position() */
+    bool (*is_safe)(const int *cells, int row, int col, int num);
+
+    /** @brief sudoku_find_empty_cell(): first empty cell in row-major order */
+    bool (*find_empty)(const int *cells, SudokuPosition *pos);
+
+    /** @brief sudoku_validate_board() */
+    bool (*validate)(const int *cells);
+
+    /** @brief Recursion of countSolutionsExact(); leaves the cells untouched */
+    int (*count_solutions)(const int *cells, int limit, InterruptPoller *poller);
+
+    /** @brief hasAlternative(); the cell is emptied and restored */
+    bool (*has_alternative)(int *cells, int row, int col, int num);
+} SudokuKernels;
+
+/**
+ * @brief Specialised kernels for a geometry
+ *
+ * @param subgrid_size Board's subgrid_size
+ * @return Kernel table for 2, 3, 4 and 5; NULL for any other size
+ */
+const SudokuKernels* sudoku_kernels_for(int subgrid_size);
+
+#endif // SUDOKU_KERNELS_INTERNAL_H
@@ -0,0 +1,314 @@
+/**
+ * @file kernels_template.h
+ * @brief Kernel bodies instantiated once per geometry by kernels.c
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * NOT a normal header: no include guard on purpose. kernels.c defines
+ * KERNEL_K and includes this file once per supported subgrid size; each
+ * inclusion produces a set of static functions suffixed _k<K> and the
+ * SudokuKernels table kernels_k<K>.
+ *
+ * Requires (from kernels.c): KERNEL_UNROLL, KERNEL_CACHE_MIN_K,
+ * KernelCell, kernel_digit() and zobrist_table().
+ *
+ * INTERNAL USE ONLY - Not part of public API
+ */
+
+#ifndef KERNEL_K
+#error "Define KERNEL_K before including kernels_template.h"
+#endif
+
+#define KT_K KERNEL_K
+#define KT_N (KERNEL_K * KERNEL_K)
+#define KT_CELLS (KT_N * KT_N)
+#define KT_FULL ((((uint32_t)1 << KT_N) - 1) << 1)   ///< Bits 1..N: digits 1..N
+#define KT_PASTE_(name, k) name##_k##k
+#define KT_PASTE(name, k) KT_PASTE_(name, k)
+#define KT(name) KT_PASTE(name, KERNEL_K)
+
+// ═══════════════════════════════════════════════════════════════
+//                    POSITION / TRAVERSAL / VALIDATION
+// ═══════════════════════════════════════════════════════════════
+
+static bool KT(is_safe)(const int *cells, int row, int col, int num) {
+    const int *in_row = cells + row * KT_N;
+    KERNEL_UNROLL
+    for (int x = 0; x < KT_N; x++) {
+        if (in_row[x] == num) {
+            return false;
+        }
+    }
+
+    const int *in_col = cells + col;
+    KERNEL_UNROLL
+    for (int x = 0; x < KT_N; x++) {
+        if (in_col[x * KT_N] == num) {
+            return false;
+        }
+    }
+
+    // Remainder by a constant: compiled to multiply and shift
+    const int *in_box = cells + (row - row % KT_K) * KT_N + (col - col % KT_K);
+    KERNEL_UNROLL
+    for (int i = 0; i < KT_K; i++) {
+        KERNEL_UNROLL
+        for (int j = 0; j < KT_K; j++) {
+            if (in_box[i * KT_N + j] == num) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool KT(find_empty)(const int *cells, SudokuPosition *pos) {
+    for (int i = 0; i < KT_CELLS; i++) {
+        if (cells[i] == 0) {
+            pos->row = i / KT_N;
+            pos->col = i % KT_N;
+            return true;
+        }
+    }
+    // Same final position as the generic row/column loops
+    pos->row = KT_N;
+    pos->col = KT_N;
+    return false;
+}
+
+static bool KT(validate)(const int *cells) {
+    uint32_t rows[KT_N] = { 0 };
+    uint32_t cols[KT_N] = { 0 };
+    uint32_t boxes[KT_N] = { 0 };
+
+    for (int r = 0; r < KT_N; r++) {
+        const int *in_row = cells + r * KT_N;
+        const int band = (r / KT_K) * KT_K;
+        KERNEL_UNROLL
+        for (int c = 0; c < KT_N; c++) {
+            int num = in_row[c];
+            if (num == 0) {
+                continue;
+            }
+            if (num < 0 || num > KT_N) {
+                return false;
+            }
+            uint32_t bit = (uint32_t)1 << num;
+            int b = band + c / KT_K;
+            if ((rows[r] | cols[c] | boxes[b]) & bit) {
+                return false;
+            }
+            rows[r] |= bit;
+            cols[c] |= bit;
+            boxes[b] |= bit;
+        }
+    }
+    return true;
+}
+
+// ═══════════════════════════════════════════════════════════════
+//                    SOLUTION COUNTING
+// ═══════════════════════════════════════════════════════════════
+
+/**
+ * @brief Same search as count_solutions_recursive() in validation.c
+ *
+ * The empty cells are listed in row-major order, so empties[0] is the
+ * cell sudoku_find_empty_cell() would return at this depth, and digits
+ * are tried in increasing order: the tree, the node count and thus the
+ * interrupt polling match the generic search exactly. Safety is a mask
+ * test instead of a 3N-cell scan.
+ */
+static int KT(count_search)(const KernelCell *empties, int remaining,
+                            uint32_t *rows, uint32_t *cols, uint32_t *boxes,
+                            int limit, InterruptPoller *poller) {
+    if (interrupt_poller_tick(poller)) {
+        return 0;
+    }
+    if (remaining == 0) {
+        return 1;
+    }
+
+    const KernelCell cell = empties[0];
+    uint32_t candidates = ~(rows[cell.row] | cols[cell.col] | boxes[cell.box]) & KT_FULL;
+    int total = 0;
+
+    // Lowest bit first: digits in increasing order
+    while (candidates != 0) {
+        uint32_t bit = candidates & (~candidates + 1);
+        candidates &= candidates - 1;
+
+        rows[cell.row] |= bit;
+        cols[cell.col] |= bit;
+        boxes[cell.box] |= bit;
+        total += KT(count_search)(empties + 1, remaining - 1, rows, cols, boxes,
+                                  limit, poller);
+        rows[cell.row] &= ~bit;
+        cols[cell.col] &= ~bit;
+        boxes[cell.box] &= ~bit;
+
+        if (total >= limit || poller->status != SUDOKU_STATUS_OK) {
+            return total;
+        }
+    }
+    return total;
+}
+
+#if KERNEL_K >= KERNEL_CACHE_MIN_K
+
+/**
+ * @brief count_search() behind the transposition table
+ *
+ * @c hash is the Zobrist hash of the current board contents, with the
+ * keys of SudokuBoard::hash; a child state is hash ^ keys[cell][digit],
+ * read from the same table the setters use. Near the leaves (fewer than
+ * SOLUTION_CACHE_MIN_EMPTY empty cells) subtrees are too cheap to be
+ * worth a table access and the plain search takes over.
+ */
+static int KT(count_search_cached)(const KernelCell *empties, int remaining,
+                                   uint32_t *rows, uint32_t *cols, uint32_t *boxes,
+                                   const uint64_t *keys, uint64_t hash, int limit,
+                                   InterruptPoller *poller, uint64_t *nodes) {
+    if (remaining < SOLUTION_CACHE_MIN_EMPTY) {
+        return KT(count_search)(empties, remaining, rows, cols, boxes, limit, poller);
+    }
+    if (interrupt_poller_tick(poller)) {
+        return 0;
+    }
+    (*nodes)++;
+
+    int total = 0;
+    if (solution_cache_lookup(hash, limit, &total)) {
+        return total;
+    }
+    const uint64_t start = *nodes;
+
+    const KernelCell cell = empties[0];
+    const int index = cell.row * KT_N + cell.col;
+    uint32_t candidates = ~(rows[cell.row] | cols[cell.col] | boxes[cell.box]) & KT_FULL;
+
+    while (candidates != 0) {
+        uint32_t bit = candidates & (~candidates + 1);
+        candidates &= candidates - 1;
+
+        rows[cell.row] |= bit;
+        cols[cell.col] |= bit;
+        boxes[cell.box] |= bit;
+        total += KT(count_search_cached)(empties + 1, remaining - 1, rows, cols, boxes, keys,
+                                         hash ^ keys[index * (KT_N + 1) + kernel_digit(bit)],
+                                         limit, poller, nodes);
+        rows[cell.row] &= ~bit;
+        cols[cell.col] &= ~bit;
+        boxes[cell.box] &= ~bit;
+
+        if (poller->status != SUDOKU_STATUS_OK) {
+            return total;   // Interrupted: the count is partial, never cache it
+        }
+        if (total >= limit) {
+            solution_cache_store(hash, total, limit, false, *nodes - start);
+            return total;
+        }
+    }
+    solution_cache_store(hash, total, limit, true, *nodes - start);
+    return total;
+}
+
+#endif
+
+static int KT(count_solutions)(const int *cells, int limit, InterruptPoller *poller) {
+    uint32_t rows[KT_N] = { 0 };
+    uint32_t cols[KT_N] = { 0 };
+    uint32_t boxes[KT_N] = { 0 };
+    KernelCell empties[KT_CELLS];
+    int remaining = 0;
+
+    for (int r = 0; r < KT_N; r++) {
+        for (int c = 0; c < KT_N; c++) {
+            int num = cells[r * KT_N + c];
+            int b = (r / KT_K) * KT_K + c / KT_K;
+            if (num == 0) {
+                empties[remaining].row = (unsigned char)r;
+                empties[remaining].col = (unsigned char)c;
+                empties[remaining].box = (unsigned char)b;
+                remaining++;
+            } else if (num > 0 && num <= KT_N) {
+                // Out-of-range values never equal a candidate: no constraint
+                uint32_t bit = (uint32_t)1 << num;
+                rows[r] |= bit;
+                cols[c] |= bit;
+                boxes[b] |= bit;
+            }
+        }
+    }
+
+#if KERNEL_K >= KERNEL_CACHE_MIN_K
+    // Root key from the cells, never from board->hash: callers may have
+    // written cells directly since the hash was last kept (O(n²), next
+    // to nothing beside the search). Same keys as SudokuBoard::hash.
+    const uint64_t *keys = zobrist_table(KERNEL_K);
+    uint64_t hash = zobrist_salt(KERNEL_K);
+    for (int i = 0; i < KT_CELLS; i++) {
+        int num = cells[i];
+        hash ^= (num >= 0 && num <= KT_N) ? keys[i * (KT_N + 1) + num]
+                                          : zobrist_key(KERNEL_K, i, num);
+    }
+    uint64_t nodes = 0;
+    int total = KT(count_search_cached)(empties, remaining, rows, cols, boxes,
+                                        keys, hash, limit, poller, &nodes);
+    solution_cache_add_nodes(nodes);
+    return total;
+#else
+    return KT(count_search)(empties, remaining, rows, cols, boxes, limit, poller);
+#endif
+}
+
+// ═══════════════════════════════════════════════════════════════
+//                    PHASE 2
+// ═══════════════════════════════════════════════════════════════
+
+static bool KT(has_alternative)(int *cells, int row, int col, int num) {
+    int *self = cells + row * KT_N + col;
+    int temp = *self;
+    *self = 0;
+    bool found = false;
+
+    const int *in_row = cells + row * KT_N;
+    for (int c = 0; c < KT_N && !found; c++) {
+        found = c != col && in_row[c] == 0 && KT(is_safe)(cells, row, c, num);
+    }
+
+    for (int r = 0; r < KT_N && !found; r++) {
+        found = r != row && cells[r * KT_N + col] == 0 && KT(is_safe)(cells, r, col, num);
+    }
+
+    const int row_start = row - row % KT_K;
+    const int col_start = col - col % KT_K;
+    for (int i = 0; i < KT_K && !found; i++) {
+        for (int j = 0; j < KT_K && !found; j++) {
+            int r = row_start + i;
+            int c = col_start + j;
+            found = (r != row || c != col) && cells[r * KT_N + c] == 0 &&
+                    KT(is_safe)(cells, r, c, num);
+        }
+    }
+
+    *self = temp;
+    return found;
+}
+
+static const SudokuKernels KT(kernels) = {
+    KERNEL_K,
+    KT(is_safe),
+    KT(find_empty),
+    KT(validate),
+    KT(count_solutions),
+    KT(has_alternative)
+};
+
+#undef KT_K
+#undef KT_N
+#undef KT_CELLS
+#undef KT_FULL
+#undef KT_PASTE_
+#undef KT_PASTE
+#undef KT
@@ -0,0 +1,149 @@
+/**
+ * @file logic_internal.h
+ * @brief Internal candidate-mask solver shared by the grader and the generator
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * The logical solver keeps one uint64_t candidate mask per cell (bit d-1
+ * set = digit d still possible) plus one "used" mask per row, column and
+ * box. Placing a digit clears that bit from the 3(n-1) peers, so the
+ * masks are always up to date and no technique has to rescan the board
+ * to rebuild candidates.
+ *
+ * LIMITATIONS:
+ * - Boards up to 64×64 (subgrid_size ≤ 8), the width of a uint64_t.
+ *   logic_state_init() returns false for larger boards and callers fall
+ *   back to their previous behaviour.
+ */
+
+#ifndef SUDOKU_LOGIC_INTERNAL_H
+#define SUDOKU_LOGIC_INTERNAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sudoku/core/types.h"
+#include "sudoku/core/arena.h"
+
+/** @brief Largest board_size the mask solver supports */
+#define LOGIC_MAX_BOARD_SIZE 64
+
+// ═══════════════════════════════════════════════════════════════
+//                    SOLVER STATE
+// ═══════════════════════════════════════════════════════════════
+
+/**
+ * @brief Working state of the logical solver
+ *
+ * Cells are stored flat (index = row * n + col). Units are numbered
+ * rows 0..n-1, columns n..2n-1, boxes 2n..3n-1 and @c units lists the
+ * n cell indices of each one.
+ */
+typedef struct {
+    int n;                  ///< Board size
+    int k;                  ///< Subgrid size
+    uint64_t full;          ///< Mask with the n lowest bits set
+    int empty;              ///< Remaining empty cells
+    bool contradiction;     ///< Set when a cell or unit runs out of options
+    bool aborted;           ///< Set when logic_count_solutions() ran out of budget
+    long node_budget;       ///< Remaining search nodes for logic_count_solutions()
+    int *solution;          ///< If set, logic_count_solutions() copies the first
+                            ///< solution here (n*n values) and clears the pointer
+    const int *exclude;     ///< If set, a solution equal to these n*n values is
+                            ///< never the one copied (4×4: nothing is copied)
+
+    int *value;             ///< n*n cell values (0 = empty)
+    uint64_t *cand;         ///< n*n candidate masks (0 for filled cells)
+    uint64_t *row_used;     ///< n masks of digits placed per row
+    uint64_t *col_used;     ///< n masks of digits placed per column
+    uint64_t *box_used;     ///< n masks of digits placed per box
+    int *units;             ///< 3n*n cell indices
+
+    void *block;            ///< Single scratch-arena allocation backing all arrays
+    SudokuArena *arena;     ///< Arena the block came from
+    SudokuArenaMark mark;   ///< Rewind point restored by logic_state_free()
+} LogicState;
+
+/**
+ * @brief Box index of a (row, col) pair
+ */
+static inline int logic_box_of(const LogicState *st, int row, int col) {
+    return (row / st->k) * st->k + col / st->k;
+}
+
+/**
+ * @brief Population count of a 64-bit mask
+ */
+static inline int logic_popcount(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(x);
+#else
+    int count = 0;
+    while (x) { x &= x - 1; count++; }
+    return count;
+#endif
+}
+
+/**
+ * @brief Index of the lowest set bit (x must be non-zero)
+ */
+static inline int logic_lowest_bit(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(x);
+#else
+    int i = 0;
+    while (!(x & 1)) { x >>= 1; i++; }
+    return i;
+#endif
+}
+
+// ═══════════════════════════════════════════════════════════════
+//                    LIFECYCLE AND PROPAGATION
+// ═══════════════════════════════════════════════════════════════
+
+/**
+ * @brief Build solver state from a board
+ *
+ * @return false if the board is larger than LOGIC_MAX_BOARD_SIZE or
+ *         allocation failed. Conflicting givens do NOT fail: they set
+ *         st->contradiction instead.
+ */
+bool logic_state_init(LogicState *st, const SudokuBoard *board);
+
+/**
+ * @brief Release memory owned by the state (safe on a zeroed state)
+ *
+ * The block lives in the thread's scratch arena, so states must be
+ * freed in reverse order of initialisation.
+ */
+void logic_state_free(LogicState *st);
+
+/**
+ * @brief Place a digit and update the peers' candidate masks
+ *
+ * @return false (and sets st->contradiction) if the digit is not a
+ *         candidate of the cell or a peer runs out of candidates
+ */
+bool logic_place(LogicState *st, int cell, int digit);
+
+/**
+ * @brief Apply naked and hidden singles until no more progress
+ *
+ * @param[out] naked  Naked singles applied (may be NULL)
+ * @param[out] hidden Hidden singles applied (may be NULL)
+ * @return false if a contradiction was found
+ */
+bool logic_propagate_singles(LogicState *st, int *naked, int *hidden);
+
+/**
+ * @brief Count solutions from the current state by MRV backtracking
+ *
+ * Uses the (sound) candidate masks left by logic to prune the search.
+ * The state's values are restored before returning.
+ *
+ * @param limit Stop after this many solutions
+ * @return Solutions found (≤ limit); st->aborted is set if the node
+ *         budget ran out first
+ */
+int logic_count_solutions(LogicState *st, int limit);
+
+#endif // SUDOKU_LOGIC_INTERNAL_H
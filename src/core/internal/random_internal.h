@@ -0,0 +1,61 @@
+/**
+ * @file random_internal.h
+ * @brief Per-thread pseudo-random generator behind every random choice
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * The library used to draw from rand(): one hidden global stream,
+ * shared by every thread, seeded from time(NULL) and implemented
+ * differently by every C library. The same seed could not rebuild the
+ * same puzzle on another machine, and two threads generating at once
+ * interleaved each other's draws.
+ *
+ * Every random choice (diagonal permutations, fill digit order, removal
+ * orders, transformations) now draws from a xoshiro256** generator
+ * whose state is thread-local:
+ *
+ * - Defined algorithm: the same seed gives the same sequence everywhere
+ * - No sharing: a thread's sequence never depends on other threads
+ * - Unseeded threads seed themselves from the clock and the address of
+ *   their state, so independent runs still differ
+ *
+ * random_below() maps draws to a range without modulo bias (Lemire's
+ * multiply-and-reject), again with exact integer arithmetic.
+ *
+ * INTERNAL USE ONLY - Not part of public API
+ */
+
+#ifndef SUDOKU_RANDOM_INTERNAL_H
+#define SUDOKU_RANDOM_INTERNAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Complete state of a thread's generator
+ */
+typedef struct {
+    uint64_t s[4];      ///< xoshiro256** state
+    bool seeded;        ///< false until seeded (explicitly or from the clock)
+} RandomState;
+
+/** @brief Next 64 random bits of the calling thread's stream */
+uint64_t random_next(void);
+
+/**
+ * @brief Uniform integer in [0, bound)
+ *
+ * @pre 0 < bound < 2^32
+ */
+int random_below(int bound);
+
+/** @brief Seed the calling thread's stream (see sudoku_random_seed()) */
+void random_seed(uint64_t seed);
+
+/** @brief Current state of the calling thread's stream */
+RandomState random_save(void);
+
+/** @brief Put back a state returned by random_save() */
+void random_restore(const RandomState *state);
+
+#endif // SUDOKU_RANDOM_INTERNAL_H
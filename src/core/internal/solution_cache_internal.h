@@ -0,0 +1,91 @@
+/**
+ * @file solution_cache_internal.h
+ * @brief Transposition table for the solution counter (16×16 and 25×25)
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * countSolutionsExact() always fills the first empty cell, so one call
+ * never reaches the same state twice. Phase 3 calls it once per probe
+ * on boards that differ by a single clue, though, and every probe
+ * re-explores the same subtrees: once the search has refilled the
+ * probed cell with its original value, the state (the full board
+ * contents) is one the previous probes already visited.
+ *
+ * The table remembers, per state, how many solutions the subtree below
+ * it returned:
+ *
+ * - EXACT: the subtree was exhausted (count < limit, usually 0 or 1);
+ *   valid for any later limit above the count
+ * - BOUND: the search stopped at the limit; valid for that same limit
+ *
+ * so a hit returns exactly what the search would have returned and
+ * results never change, only the node count.
+ *
+ * States are identified by Zobrist hashes with the keys behind
+ * SudokuBoard::hash (zobrist_internal.h). The root is hashed from the
+ * cells, which callers may have written directly, and the search XORs
+ * one key per digit it places, so a key means the same board contents
+ * everywhere in the library.
+ *
+ * MEMORY: one table per thread, 2^SOLUTION_CACHE_BITS two-entry
+ * buckets (1 MiB), allocated on first use and freed by
+ * sudoku_arena_thread_cleanup(). Replacement: the first entry of a
+ * bucket keeps the costlier subtree, the second is always replaced.
+ *
+ * INTERNAL USE ONLY - Not part of public API
+ */
+
+#ifndef SUDOKU_SOLUTION_CACHE_INTERNAL_H
+#define SUDOKU_SOLUTION_CACHE_INTERNAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** @brief log2 of the number of buckets */
+#define SOLUTION_CACHE_BITS 15
+
+/** @brief Subtrees with fewer empty cells are searched, not cached */
+#define SOLUTION_CACHE_MIN_EMPTY 12
+
+/**
+ * @brief Counters of the calling thread's table
+ */
+typedef struct {
+    uint64_t probes;    ///< Lookups
+    uint64_t hits;      ///< Lookups answered from the table
+    uint64_t stores;    ///< Results written
+    uint64_t nodes;     ///< Search nodes visited by cached searches
+} SolutionCacheStats;
+
+/**
+ * @brief Look up a state
+ *
+ * @param[out] count Solutions the subtree returns under @p limit
+ * @return true on a usable entry
+ */
+bool solution_cache_lookup(uint64_t key, int limit, int *count);
+
+/**
+ * @brief Record a finished (not interrupted) subtree
+ *
+ * @param exact true if the subtree was exhausted (count < limit)
+ * @param nodes Nodes the subtree cost: replacement priority
+ */
+void solution_cache_store(uint64_t key, int count, int limit, bool exact, uint64_t nodes);
+
+/** @brief Add nodes visited by a cached search to the thread's counters */
+void solution_cache_add_nodes(uint64_t nodes);
+
+/** @brief Turn the calling thread's table on or off (default on) */
+void solution_cache_set_enabled(bool enabled);
+
+/** @brief Forget every entry and reset the counters */
+void solution_cache_clear(void);
+
+/** @brief Counters since the last solution_cache_clear() */
+SolutionCacheStats solution_cache_stats(void);
+
+/** @brief Free the calling thread's table */
+void solution_cache_thread_cleanup(void);
+
+#endif // SUDOKU_SOLUTION_CACHE_INTERNAL_H
@@ -0,0 +1,65 @@
+/**
+ * @file zobrist_internal.h
+ * @brief Zobrist keys behind SudokuBoard::hash
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * A board's hash is the XOR of one 64-bit key per filled cell, keyed by
+ * (cell, value), over a per-geometry salt. Placing or clearing a digit
+ * XORs one key in or out, so the setters keep the hash current in O(1)
+ * instead of rescanning the n² cells.
+ *
+ * KEY TABLES: the shipped geometries (subgrid sizes 2-5) read their
+ * keys from a table of total_cells × (board_size + 1) entries, indexed
+ * cell * (board_size + 1) + value; the value-0 column is all zeros so
+ * clearing and placing need no branch. The tables are filled once, the
+ * first time any board is created, and are read-only afterwards
+ * (~170 KiB in total). Larger experimental geometries compute each key
+ * on the fly with zobrist_key().
+ *
+ * Keys are a pure function of (subgrid_size, cell, value): hashes are
+ * stable across runs and processes.
+ *
+ * INTERNAL USE ONLY - Not part of public API
+ */
+
+#ifndef SUDOKU_ZOBRIST_INTERNAL_H
+#define SUDOKU_ZOBRIST_INTERNAL_H
+
+#include <stdint.h>
+
+/**
+ * @brief Key of @p value in @p cell of a board with this geometry
+ *
+ * splitmix64 of the packed (subgrid_size, cell, value); 0 for value 0.
+ */
+static inline uint64_t zobrist_key(int subgrid_size, int cell, int value) {
+    if (value == 0) {
+        return 0;
+    }
+    uint64_t z = ((uint64_t)subgrid_size << 48 | (uint64_t)cell << 16 | (uint64_t)value)
+               + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Hash of an empty board of this geometry
+ *
+ * Keeps empty (and generally, equal-looking) boards of different sizes
+ * apart in shared hash sets.
+ */
+static inline uint64_t zobrist_salt(int subgrid_size) {
+    return zobrist_key(subgrid_size, 0xFFFFFF, 0xFFFF);
+}
+
+/**
+ * @brief Key table of a geometry
+ *
+ * @return Table for subgrid sizes 2-5 (filled on the first call,
+ *         thread-safe); NULL for any other size
+ */
+const uint64_t* zobrist_table(int subgrid_size);
+
+#endif // SUDOKU_ZOBRIST_INTERNAL_H
@@ -0,0 +1,94 @@
+/**
+ * @file kernels.c
+ * @brief Geometry-specialised kernels and their dispatcher
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * Instantiates kernels_template.h for subgrid sizes 2, 3, 4 and 5
+ * (4×4, 9×9, 16×16, 25×25). See kernels_internal.h.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "internal/kernels_internal.h"
+#include "internal/solution_cache_internal.h"
+#include "internal/zobrist_internal.h"
+
+/**
+ * @brief Ask the compiler to fully unroll the next constant-bound loop
+ *
+ * With N and K known at compile time the optimiser can unroll on its
+ * own; the pragma makes it do so for the 9-, 16- and 25-iteration
+ * loops too, where its heuristics would otherwise stop.
+ */
+#if defined(__clang__)
+#define KERNEL_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__) && __GNUC__ >= 8
+#define KERNEL_UNROLL _Pragma("GCC unroll 32")
+#else
+#define KERNEL_UNROLL
+#endif
+
+/**
+ * @brief Empty cell of the solution counter, with its box precomputed
+ */
+typedef struct {
+    unsigned char row;
+    unsigned char col;
+    unsigned char box;
+} KernelCell;
+
+/**
+ * @brief Digit of a one-bit mask (bit d → digit d)
+ */
+static inline int kernel_digit(uint32_t bit) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(bit);
+#else
+    int d = 0;
+    while (!(bit & 1)) { bit >>= 1; d++; }
+    return d;
+#endif
+}
+
+/**
+ * @brief Smallest subgrid size whose solution counter uses the
+ *        transposition table (solution_cache_internal.h)
+ *
+ * 4×4 and 9×9 probes are too short for the table to pay for itself.
+ */
+#define KERNEL_CACHE_MIN_K 4
+
+// ═══════════════════════════════════════════════════════════════════
+//                    INSTANTIATIONS
+// ═══════════════════════════════════════════════════════════════════
+
+#define KERNEL_K 2
+#include "internal/kernels_template.h"
+#undef KERNEL_K
+
+#define KERNEL_K 3
+#include "internal/kernels_template.h"
+#undef KERNEL_K
+
+#define KERNEL_K 4
+#include "internal/kernels_template.h"
+#undef KERNEL_K
+
+#define KERNEL_K 5
+#include "internal/kernels_template.h"
+#undef KERNEL_K
+
+// ═══════════════════════════════════════════════════════════════════
+//                    DISPATCHER
+// ═══════════════════════════════════════════════════════════════════
+
+const SudokuKernels* sudoku_kernels_for(int subgrid_size) {
+    switch (subgrid_size) {
+        case 3:  return &kernels_k3;   // 9×9 first: almost all traffic
+        case 2:  return &kernels_k2;
+        case 4:  return &kernels_k4;
+        case 5:  return &kernels_k5;
+        default: return NULL;
+    }
+}
@@ -0,0 +1,228 @@
+/**
+ * @file minimal.c
+ * @brief Multi-threaded minimality check of unique puzzles
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * One probe per clue: empty the cell, count up to 2 solutions, put the
+ * clue back. The clue is redundant when the count is still 1.
+ *
+ * WORK SHARING: the clues are listed once and the workers claim them
+ * through an atomic cursor, one clue at a time. Probe costs vary by
+ * orders of magnitude from clue to clue, so dynamic claiming keeps the
+ * workers busy where a static split would leave most of them waiting
+ * for the one that drew the expensive clues.
+ *
+ * Every worker probes its OWN clone of the puzzle (the counter writes
+ * to the board) and uses its own thread-local scratch arena and
+ * solution cache, so workers share nothing but the cursor, the result
+ * array and a cancel token.
+ *
+ * EARLY EXIT: sudoku_is_minimal() only needs one redundant clue. The
+ * worker that finds it cancels the shared token; the others stop
+ * claiming clues and their in-flight probes return within
+ * SUDOKU_INTERRUPT_INTERVAL nodes (countSolutionsExactEx()).
+ *
+ * Without C11 threads (__STDC_NO_THREADS__) the calling thread does
+ * all the probes.
+ */
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef __STDC_NO_THREADS__
+#include <threads.h>
+#endif
+#include "sudoku/core/validation.h"
+#include "sudoku/core/board.h"
+#include "sudoku/core/arena.h"
+#include "sudoku/core/cancel.h"
+#include "internal/board_internal.h"
+
+/** @brief Upper bound on worker threads per call */
+#define MINIMAL_MAX_THREADS 64
+
+/**
+ * @brief State shared by the workers of one check
+ */
+typedef struct {
+    const SudokuBoard *puzzle;
+    const int *clues;           ///< Flat indices of the clues, row-major
+    int clue_count;
+    atomic_int next;            ///< Next unclaimed entry of clues
+    unsigned char *redundant;   ///< One flag per clue
+    bool stop_at_first;         ///< Cancel everything on the first hit
+    SudokuCancelToken *stop;    ///< Cancelled on early exit or failure
+    SudokuInterrupt interrupt;  ///< Wraps stop for the counter
+    atomic_bool failed;         ///< A worker could not get its board
+} MinimalJob;
+
+/**
+ * @brief Claim and probe clues until none are left or the job stops
+ */
+static void minimal_work(MinimalJob *job) {
+    SudokuBoard *copy = sudoku_board_clone(job->puzzle);
+    if (copy == NULL) {
+        atomic_store(&job->failed, true);
+        sudoku_cancel_token_cancel(job->stop);
+        return;
+    }
+    int n = copy->board_size;
+
+    for (;;) {
+        if (sudoku_cancel_token_is_cancelled(job->stop)) {
+            break;
+        }
+        int i = atomic_fetch_add_explicit(&job->next, 1, memory_order_relaxed);
+        if (i >= job->clue_count) {
+            break;
+        }
+
+        int row = job->clues[i] / n, col = job->clues[i] % n;
+        int value = copy->cells[row][col];
+        SudokuStatus status;
+
+        board_set_cell_fast(copy, row, col, 0);
+        int solutions = countSolutionsExactEx(copy, 2, &job->interrupt, &status);
+        board_set_cell_fast(copy, row, col, value);
+
+        if (status == SUDOKU_STATUS_OK && solutions == 1) {
+            job->redundant[i] = 1;
+            if (job->stop_at_first) {
+                sudoku_cancel_token_cancel(job->stop);
+            }
+        }
+    }
+
+    sudoku_board_destroy(copy);
+}
+
+#ifndef __STDC_NO_THREADS__
+/**
+ * @brief Thread entry: the work, then the thread's scratch cleanup
+ */
+static int minimal_thread(void *arg) {
+    minimal_work((MinimalJob *)arg);
+    sudoku_arena_thread_cleanup();
+    return 0;
+}
+#endif
+
+/**
+ * @brief Run @p threads workers (the caller included) over the job
+ */
+static void minimal_run(MinimalJob *job, int threads) {
+#ifndef __STDC_NO_THREADS__
+    thrd_t workers[MINIMAL_MAX_THREADS];
+    int started = 0;
+    for (int t = 1; t < threads; t++) {
+        if (thrd_create(&workers[started], minimal_thread, job) != thrd_success) {
+            break;      // Fewer helpers; the caller still finishes the job
+        }
+        started++;
+    }
+    minimal_work(job);
+    for (int t = 0; t < started; t++) {
+        thrd_join(workers[t], NULL);
+    }
+#else
+    (void)threads;
+    minimal_work(job);
+#endif
+}
+
+/**
+ * @brief Shared implementation
+ *
+ * @return Number of redundant clues (with stop_at_first: 0 or ≥ 1),
+ *         or -1 on a non-unique puzzle, NULL input or allocation failure
+ */
+static int minimal_check(const SudokuBoard *board, int threads, bool stop_at_first,
+                         SudokuPosition *redundant, int capacity) {
+    if (board == NULL || (redundant == NULL && capacity > 0)) {
+        return -1;
+    }
+
+    // Minimality is only defined for puzzles with a unique solution
+    SudokuBoard *probe = sudoku_board_clone(board);
+    if (probe == NULL) {
+        return -1;
+    }
+    int solutions = countSolutionsExact(probe, 2);
+    sudoku_board_destroy(probe);
+    if (solutions != 1) {
+        return -1;
+    }
+
+    int total = board->total_cells, n = board->board_size;
+    int *clues = malloc(sizeof(int) * total);
+    unsigned char *flags = calloc(total, 1);
+    SudokuCancelToken *token = sudoku_cancel_token_create();
+    if (clues == NULL || flags == NULL || token == NULL) {
+        free(clues);
+        free(flags);
+        sudoku_cancel_token_destroy(token);
+        return -1;
+    }
+
+    int clue_count = 0;
+    for (int cell = 0; cell < total; cell++) {
+        if (board->cells[0][cell] != 0) {
+            clues[clue_count++] = cell;
+        }
+    }
+
+    MinimalJob job = {
+        .puzzle = board,
+        .clues = clues,
+        .clue_count = clue_count,
+        .redundant = flags,
+        .stop_at_first = stop_at_first,
+        .stop = token,
+        .interrupt = { .cancel = token, .deadline_ns = 0 },
+    };
+    atomic_init(&job.next, 0);
+    atomic_init(&job.failed, false);
+
+    if (threads < 1) {
+        threads = 1;
+    }
+    if (threads > MINIMAL_MAX_THREADS) {
+        threads = MINIMAL_MAX_THREADS;
+    }
+    if (threads > clue_count) {
+        threads = clue_count > 0 ? clue_count : 1;
+    }
+    minimal_run(&job, threads);
+
+    int found = 0;
+    for (int i = 0; i < clue_count; i++) {
+        if (flags[i]) {
+            if (found < capacity) {
+                redundant[found].row = clues[i] / n;
+                redundant[found].col = clues[i] % n;
+            }
+            found++;
+        }
+    }
+    // Some clues were never probed: only a redundant clue already
+    // found is still a valid answer, and only for the early-exit check
+    if (atomic_load(&job.failed) && (!stop_at_first || found == 0)) {
+        found = -1;
+    }
+
+    free(clues);
+    free(flags);
+    sudoku_cancel_token_destroy(token);
+    return found;
+}
+
+bool sudoku_is_minimal(const SudokuBoard *board, int threads) {
+    return minimal_check(board, threads, true, NULL, 0) == 0;
+}
+
+int sudoku_find_redundant_clues(const SudokuBoard *board, int threads,
+                                SudokuPosition *redundant, int capacity) {
+    return minimal_check(board, threads, false, redundant, capacity);
+}
@@ -7,6 +7,7 @@
 
 #include "sudoku/algorithms/network.h"
 #include "sudoku/core/board.h"
+#include "sudoku/core/arena.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -19,30 +20,36 @@
 /**
  * @brief Internal representation of constraint network
  * 
- * MEMORY LAYOUT:
- * - domains: 2D array of Domain structures (board_size × board_size)
- * - neighbors: 2D array of neighbor lists (board_size × board_size)
- * - neighbor_counts: 2D array of counts (board_size × board_size)
+ * MEMORY LAYOUT (one block, malloc'd or taken from a SudokuArena):
+ * 
+ * [ConstraintNetwork][domains: n² Domain][neighbors: n² × degree positions]
+ * 
+ * Every cell has exactly degree = 2(n-1) + (k-1)² neighbours, so the
+ * neighbour list of cell (r, c) starts at neighbors[(r*n + c) * degree].
  * 
  * For 9×9 board:
  * - domains: 81 × 8 bytes = 648 bytes
- * - neighbors: 81 × (20 × 8 bytes) = 12,960 bytes
- * - neighbor_counts: 81 × 4 bytes = 324 bytes
- * Total: ~14 KB
+ * - neighbors: 81 × 20 × 8 bytes = 12,960 bytes
+ * Total: ~14 KB in a single allocation (previously 3n+4 mallocs and
+ * one realloc per cell)
  */
 struct ConstraintNetwork {
     // Board geometry
     int board_size;          ///< Size of board (e.g., 9 for 9×9)
     int subgrid_size;        ///< Size of subgrids (e.g., 3 for 3×3)
+    int degree;              ///< Neighbours per cell
+    bool arena_owned;        ///< Block belongs to a SudokuArena
     
-    // Domain information
-    Domain **domains;        ///< 2D array of domains
+    // Domain information (row-major, n² entries)
+    Domain *domains;
     
-    // Neighbor relationships (constraint graph)
-    SudokuPosition ***neighbors;     ///< For each cell, array of neighbor positions
-    int **neighbor_counts;          ///< For each cell, number of neighbors
+    // Neighbor relationships (constraint graph, n² × degree entries)
+    SudokuPosition *neighbors;
 };
 
+/** @brief Domain of cell (row, col) */
+#define CELL_DOMAIN(net, row, col) ((net)->domains[(row) * (net)->board_size + (col)])
+
 // ═══════════════════════════════════════════════════════════════════
 //                    DOMAIN OPERATIONS
 // ═══════════════════════════════════════════════════════════════════
@@ -58,7 +65,8 @@ static Domain domain_full(int board_size) {
     
     // Set all bits from 0 to board_size-1
     // Example for board_size=9: 0b111111111 = 0x1FF
-    d.bits = (1u << board_size) - 1;
+    // (a 32-bit shift by 32 is undefined, so the full mask is special-cased)
+    d.bits = (board_size >= 32) ? 0xFFFFFFFFu : ((1u << board_size) - 1);
     d.count = board_size;
     
     return d;
@@ -81,18 +89,6 @@ static Domain domain_singleton(int value) {
     return d;
 }
 
-/**
- * @brief Create empty domain (no values possible)
- * 
- * @return Empty domain
- */
-static Domain domain_empty(void) {
-    Domain d;
-    d.bits = 0;
-    d.count = 0;
-    return d;
-}
-
 /**
  * @brief Check if value is in domain
  * 
@@ -211,206 +207,125 @@ static int compute_neighbors(int row, int col,
 //                    NETWORK CREATION AND DESTRUCTION
 // ═══════════════════════════════════════════════════════════════════
 
-ConstraintNetwork* constraint_network_create(const SudokuBoard *board) {
+/**
+ * @brief Neighbours per cell: row + column + rest of the subgrid
+ */
+static int network_degree(int board_size, int subgrid_size) {
+    return 2 * (board_size - 1) + (subgrid_size - 1) * (subgrid_size - 1);
+}
+
+/**
+ * @brief Bytes needed for a network of the given geometry
+ */
+static size_t network_footprint(int board_size, int subgrid_size) {
+    size_t cells = (size_t)board_size * board_size;
+    return sizeof(ConstraintNetwork)
+         + cells * sizeof(Domain)
+         + cells * network_degree(board_size, subgrid_size) * sizeof(SudokuPosition);
+}
+
+/**
+ * @brief Validate the board a network is requested for
+ */
+static bool network_supports(const SudokuBoard *board) {
     if (board == NULL) {
-        return NULL;
+        return false;
     }
-    
-    // Allocate main structure
-    ConstraintNetwork *net = (ConstraintNetwork*)malloc(sizeof(ConstraintNetwork));
-    if (net == NULL) {
-        return NULL;
+    if (sudoku_board_get_board_size(board) > NETWORK_MAX_BOARD_SIZE) {
+        fprintf(stderr, "Error: Constraint network supports boards up to %dx%d\n",
+                NETWORK_MAX_BOARD_SIZE, NETWORK_MAX_BOARD_SIZE);
+        return false;
     }
+    return true;
+}
+
+/**
+ * @brief Lay out a network in a raw block and initialise it from a board
+ */
+static ConstraintNetwork* network_layout(void *memory, const SudokuBoard *board,
+                                         bool arena_owned) {
+    ConstraintNetwork *net = (ConstraintNetwork*)memory;
     
     // Get board dimensions
     net->board_size = sudoku_board_get_board_size(board);
     net->subgrid_size = sudoku_board_get_subgrid_size(board);
+    net->degree = network_degree(net->board_size, net->subgrid_size);
+    net->arena_owned = arena_owned;
     
-    // Allocate 2D arrays (using same pattern as board.c)
     int size = net->board_size;
+    net->domains = (Domain*)(net + 1);
+    net->neighbors = (SudokuPosition*)(net->domains + (size_t)size * size);
     
-    // 1. Allocate domains array
-    net->domains = (Domain**)malloc(size * sizeof(Domain*));
-    if (net->domains == NULL) {
-        free(net);
-        return NULL;
-    }
-    
-    for (int i = 0; i < size; i++) {
-        net->domains[i] = (Domain*)malloc(size * sizeof(Domain));
-        if (net->domains[i] == NULL) {
-            // Cleanup partial allocation
-            for (int j = 0; j < i; j++) {
-                free(net->domains[j]);
-            }
-            free(net->domains);
-            free(net);
-            return NULL;
-        }
-    }
-    
-    // 2. Allocate neighbor arrays
-    net->neighbors = (SudokuPosition***)malloc(size * sizeof(SudokuPosition*));
-    if (net->neighbors == NULL) {
-        for (int i = 0; i < size; i++) {
-            free(net->domains[i]);
-        }
-        free(net->domains);
-        free(net);
-        return NULL;
-    }
-    
-    for (int i = 0; i < size; i++) {
-        net->neighbors[i] = (SudokuPosition**)malloc(size * sizeof(SudokuPosition*));
-        if (net->neighbors[i] == NULL) {
-            // Cleanup
-            for (int j = 0; j < i; j++) {
-                free(net->neighbors[j]);
-            }
-            free(net->neighbors);
-            for (int j = 0; j < size; j++) {
-                free(net->domains[j]);
-            }
-            free(net->domains);
-            free(net);
-            return NULL;
-        }
-    }
-    
-    // 3. Allocate neighbor counts
-    net->neighbor_counts = (int**)malloc(size * sizeof(int*));
-    if (net->neighbor_counts == NULL) {
-        // Cleanup everything
-        for (int i = 0; i < size; i++) {
-            free(net->neighbors[i]);
-            free(net->domains[i]);
-        }
-        free(net->neighbors);
-        free(net->domains);
-        free(net);
-        return NULL;
-    }
-    
-    for (int i = 0; i < size; i++) {
-        net->neighbor_counts[i] = (int*)malloc(size * sizeof(int));
-        if (net->neighbor_counts[i] == NULL) {
-            // Cleanup
-            for (int j = 0; j < i; j++) {
-                free(net->neighbor_counts[j]);
-            }
-            free(net->neighbor_counts);
-            for (int j = 0; j < size; j++) {
-                free(net->neighbors[j]);
-                free(net->domains[j]);
-            }
-            free(net->neighbors);
-            free(net->domains);
-            free(net);
-            return NULL;
-        }
-    }
-    
-    // 4. Initialize domains and neighbors for each cell
+    // Initialize domains and neighbors for each cell
     for (int row = 0; row < size; row++) {
         for (int col = 0; col < size; col++) {
             int value = sudoku_board_get_cell(board, row, col);
+            SudokuPosition *neighbors =
+                &net->neighbors[((size_t)row * size + col) * net->degree];
+            
+            // Neighbours go straight into their slot of the flat table
+            int count = compute_neighbors(row, col, size, net->subgrid_size, neighbors);
+            assert(count == net->degree);
+            (void)count;
             
             if (value != 0) {
                 // Filled cell: singleton domain
-                net->domains[row][col] = domain_singleton(value);
-            } else {
-                // Empty cell: full domain initially
-                net->domains[row][col] = domain_full(size);
-                
-                // Remove values that conflict with filled neighbors
-                // (This is initial constraint propagation)
-                for (int r = 0; r < size; r++) {
-                    if (r != row) {
-                        int neighbor_val = sudoku_board_get_cell(board, r, col);
-                        if (neighbor_val != 0) {
-                            domain_remove(&net->domains[row][col], neighbor_val);
-                        }
-                    }
-                }
-                
-                for (int c = 0; c < size; c++) {
-                    if (c != col) {
-                        int neighbor_val = sudoku_board_get_cell(board, row, c);
-                        if (neighbor_val != 0) {
-                            domain_remove(&net->domains[row][col], neighbor_val);
-                        }
-                    }
-                }
-                
-                // Subgrid neighbors
-                int subgrid_row = (row / net->subgrid_size) * net->subgrid_size;
-                int subgrid_col = (col / net->subgrid_size) * net->subgrid_size;
-                
-                for (int r = subgrid_row; r < subgrid_row + net->subgrid_size; r++) {
-                    for (int c = subgrid_col; c < subgrid_col + net->subgrid_size; c++) {
-                        if (r != row && c != col) {
-                            int neighbor_val = sudoku_board_get_cell(board, r, c);
-                            if (neighbor_val != 0) {
-                                domain_remove(&net->domains[row][col], neighbor_val);
-                            }
-                        }
-                    }
-                }
+                CELL_DOMAIN(net, row, col) = domain_singleton(value);
+                continue;
             }
             
-            // Compute neighbors (allocate temporary buffer)
-            SudokuPosition temp_neighbors[100];  // Max ~81 neighbors for 100×100 board
-            int count = compute_neighbors(row, col, size, net->subgrid_size, temp_neighbors);
-            
-            // Allocate exactly what we need
-            net->neighbors[row][col] = (SudokuPosition*)realloc(
-                net->neighbors[row][col],
-                count * sizeof(SudokuPosition)
-            );
-            
-            // Copy neighbors
-            memcpy(net->neighbors[row][col], temp_neighbors, count * sizeof(SudokuPosition));
-            net->neighbor_counts[row][col] = count;
+            // Empty cell: full domain minus values of filled neighbours
+            // (This is initial constraint propagation)
+            CELL_DOMAIN(net, row, col) = domain_full(size);
+            for (int i = 0; i < net->degree; i++) {
+                int neighbor_val = sudoku_board_get_cell(board, neighbors[i].row,
+                                                         neighbors[i].col);
+                if (neighbor_val != 0) {
+                    domain_remove(&CELL_DOMAIN(net, row, col), neighbor_val);
+                }
+            }
         }
     }
     
     return net;
 }
 
-void constraint_network_destroy(ConstraintNetwork *net) {
-    if (net == NULL) {
-        return;
+ConstraintNetwork* constraint_network_create(const SudokuBoard *board) {
+    if (!network_supports(board)) {
+        return NULL;
     }
     
-    int size = net->board_size;
+    void *memory = malloc(network_footprint(sudoku_board_get_board_size(board),
+                                            sudoku_board_get_subgrid_size(board)));
+    if (memory == NULL) {
+        return NULL;
+    }
     
-    // Free all 2D arrays in reverse order of allocation
-    if (net->neighbor_counts != NULL) {
-        for (int i = 0; i < size; i++) {
-            free(net->neighbor_counts[i]);
-        }
-        free(net->neighbor_counts);
+    return network_layout(memory, board, false);
+}
+
+ConstraintNetwork* constraint_network_create_in_arena(SudokuArena *arena,
+                                                      const SudokuBoard *board) {
+    if (arena == NULL || !network_supports(board)) {
+        return NULL;
     }
     
-   if (net->neighbors != NULL) {
-    for (int i = 0; i < size; i++) {
-        if (net->neighbors[i] != NULL) {
-            // ✅ Primero liberar cada array de vecinos
-            for (int j = 0; j < size; j++) {
-                free(net->neighbors[i][j]);
-            }
-            free(net->neighbors[i]);
-        }
+    void *memory = sudoku_arena_alloc(arena,
+        network_footprint(sudoku_board_get_board_size(board),
+                          sudoku_board_get_subgrid_size(board)));
+    if (memory == NULL) {
+        return NULL;
     }
-    free(net->neighbors);
-}    
-    if (net->domains != NULL) {
-        for (int i = 0; i < size; i++) {
-            free(net->domains[i]);
-        }
-        free(net->domains);
+    
+    return network_layout(memory, board, true);
+}
+
+void constraint_network_destroy(ConstraintNetwork *net) {
+    if (net == NULL || net->arena_owned) {
+        return;
     }
     
+    // Struct, domains and neighbour table are one block
     free(net);
 }
 
@@ -424,7 +339,7 @@ Domain constraint_network_get_domain(const ConstraintNetwork *net,
     assert(row >= 0 && row < net->board_size);
     assert(col >= 0 && col < net->board_size);
     
-    return net->domains[row][col];
+    return CELL_DOMAIN(net, row, col);
 }
 
 bool constraint_network_has_value(const ConstraintNetwork *net,
@@ -434,7 +349,7 @@ bool constraint_network_has_value(const ConstraintNetwork *net,
     assert(col >= 0 && col < net->board_size);
     assert(value >= 1 && value <= net->board_size);
     
-    return domain_contains(&net->domains[row][col], value);
+    return domain_contains(&CELL_DOMAIN(net, row, col), value);
 }
 
 int constraint_network_domain_size(const ConstraintNetwork *net,
@@ -443,7 +358,7 @@ int constraint_network_domain_size(const ConstraintNetwork *net,
     assert(row >= 0 && row < net->board_size);
     assert(col >= 0 && col < net->board_size);
     
-    return net->domains[row][col].count;
+    return CELL_DOMAIN(net, row, col).count;
 }
 
 bool constraint_network_domain_empty(const ConstraintNetwork *net,
@@ -452,7 +367,7 @@ bool constraint_network_domain_empty(const ConstraintNetwork *net,
     assert(row >= 0 && row < net->board_size);
     assert(col >= 0 && col < net->board_size);
     
-    return net->domains[row][col].count == 0;
+    return CELL_DOMAIN(net, row, col).count == 0;
 }
 
 // ═══════════════════════════════════════════════════════════════════
@@ -466,7 +381,7 @@ bool constraint_network_remove_value(ConstraintNetwork *net,
     assert(col >= 0 && col < net->board_size);
     assert(value >= 1 && value <= net->board_size);
     
-    return domain_remove(&net->domains[row][col], value);
+    return domain_remove(&CELL_DOMAIN(net, row, col), value);
 }
 
 void constraint_network_assign_value(ConstraintNetwork *net,
@@ -477,7 +392,7 @@ void constraint_network_assign_value(ConstraintNetwork *net,
     assert(value >= 1 && value <= net->board_size);
     
     // Replace domain with singleton
-    net->domains[row][col] = domain_singleton(value);
+    CELL_DOMAIN(net, row, col) = domain_singleton(value);
 }
 
 void constraint_network_restore_domain(ConstraintNetwork *net,
@@ -487,7 +402,7 @@ void constraint_network_restore_domain(ConstraintNetwork *net,
     assert(col >= 0 && col < net->board_size);
     
     // Restore full domain
-    net->domains[row][col] = domain_full(net->board_size);
+    CELL_DOMAIN(net, row, col) = domain_full(net->board_size);
 }
 
 // ═══════════════════════════════════════════════════════════════════
@@ -509,8 +424,8 @@ const SudokuPosition* constraint_network_get_neighbors(
     assert(col >= 0 && col < net->board_size);
     assert(count != NULL);
     
-    *count = net->neighbor_counts[row][col];
-    return net->neighbors[row][col];
+    *count = net->degree;
+    return &net->neighbors[((size_t)row * net->board_size + col) * net->degree];
 }
 
 // ═══════════════════════════════════════════════════════════════════
@@ -530,7 +445,7 @@ void constraint_network_print(const ConstraintNetwork *net) {
     
     for (int row = 0; row < net->board_size; row++) {
         for (int col = 0; col < net->board_size; col++) {
-            Domain d = net->domains[row][col];
+            Domain d = CELL_DOMAIN(net, row, col);
             
             printf("(%d,%d): {", row, col);
             
@@ -565,7 +480,7 @@ int constraint_network_total_possibilities(const ConstraintNetwork *net) {
     
     for (int row = 0; row < net->board_size; row++) {
         for (int col = 0; col < net->board_size; col++) {
-            total += net->domains[row][col].count;
+            total += CELL_DOMAIN(net, row, col).count;
         }
     }
     
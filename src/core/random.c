@@ -0,0 +1,84 @@
+/**
+ * @file random.c
+ * @brief Thread-local xoshiro256** generator
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * See random_internal.h.
+ */
+
+#include <stdint.h>
+#include "sudoku/core/generator.h"
+#include "sudoku/core/cancel.h"
+#include "internal/random_internal.h"
+
+static _Thread_local RandomState state;
+
+static inline uint64_t rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+/**
+ * @brief splitmix64 step: expands one seed into the four state words
+ */
+static uint64_t splitmix64(uint64_t *x) {
+    uint64_t z = (*x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+void random_seed(uint64_t seed) {
+    for (int i = 0; i < 4; i++) {
+        state.s[i] = splitmix64(&seed);
+    }
+    state.seeded = true;
+}
+
+uint64_t random_next(void) {
+    if (!state.seeded) {
+        // Different per run (clock) and per thread (address of the state)
+        random_seed(sudoku_clock_ns() ^ (uint64_t)(uintptr_t)&state);
+    }
+
+    uint64_t *s = state.s;
+    uint64_t result = rotl(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 45);
+
+    return result;
+}
+
+int random_below(int bound) {
+    uint32_t range = (uint32_t)bound;
+    uint64_t m = (random_next() >> 32) * range;
+    uint32_t low = (uint32_t)m;
+
+    // Reject the few draws that would over-represent low values
+    if (low < range) {
+        uint32_t threshold = (uint32_t)(-range) % range;
+        while (low < threshold) {
+            m = (random_next() >> 32) * range;
+            low = (uint32_t)m;
+        }
+    }
+    return (int)(m >> 32);
+}
+
+RandomState random_save(void) {
+    return state;
+}
+
+void random_restore(const RandomState *saved) {
+    state = *saved;
+}
+
+void sudoku_random_seed(uint64_t seed) {
+    random_seed(seed);
+}
@@ -0,0 +1,115 @@
+/**
+ * @file solution_cache.c
+ * @brief Per-thread transposition table of the solution counter
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * See solution_cache_internal.h.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "internal/solution_cache_internal.h"
+
+#define CACHE_BUCKETS ((size_t)1 << SOLUTION_CACHE_BITS)
+
+/**
+ * @brief One cached subtree (16 bytes)
+ */
+typedef struct {
+    uint64_t key;       ///< Zobrist hash of the state (0 = unused)
+    uint32_t count;     ///< Solutions returned by the subtree
+    uint16_t limit;     ///< Limit of the search that stored a BOUND
+    uint8_t exact;      ///< 1 = subtree exhausted, count exact
+    uint8_t cost;       ///< ⌊log2(nodes)⌋ + 1: replacement priority
+} CacheEntry;
+
+static _Thread_local CacheEntry *table = NULL;      ///< 2 entries per bucket
+static _Thread_local bool disabled = false;
+static _Thread_local bool alloc_failed = false;
+static _Thread_local SolutionCacheStats stats;
+
+/**
+ * @brief The thread's table, allocated on first use (NULL if off)
+ */
+static CacheEntry* cache_table(void) {
+    if (table == NULL && !disabled && !alloc_failed) {
+        table = calloc(2 * CACHE_BUCKETS, sizeof(CacheEntry));
+        alloc_failed = (table == NULL);
+    }
+    return disabled ? NULL : table;
+}
+
+static uint8_t cost_of(uint64_t nodes) {
+    uint8_t cost = 0;
+    while (nodes != 0 && cost < UINT8_MAX) {
+        nodes >>= 1;
+        cost++;
+    }
+    return cost;
+}
+
+bool solution_cache_lookup(uint64_t key, int limit, int *count) {
+    CacheEntry *t = cache_table();
+    if (t == NULL) {
+        return false;
+    }
+    stats.probes++;
+
+    CacheEntry *bucket = &t[2 * (key & (CACHE_BUCKETS - 1))];
+    for (int i = 0; i < 2; i++) {
+        const CacheEntry *e = &bucket[i];
+        if (e->key != key) {
+            continue;
+        }
+        if ((e->exact && (int)e->count < limit) || (!e->exact && e->limit == limit)) {
+            *count = (int)e->count;
+            stats.hits++;
+            return true;
+        }
+    }
+    return false;
+}
+
+void solution_cache_store(uint64_t key, int count, int limit, bool exact, uint64_t nodes) {
+    CacheEntry *t = cache_table();
+    if (t == NULL || count < 0 || limit <= 0 || limit > UINT16_MAX) {
+        return;
+    }
+    stats.stores++;
+
+    CacheEntry entry = { key, (uint32_t)count, (uint16_t)limit, exact ? 1 : 0, cost_of(nodes) };
+    CacheEntry *bucket = &t[2 * (key & (CACHE_BUCKETS - 1))];
+
+    // Slot 0 keeps the costlier subtree; slot 1 takes everything else
+    if (bucket[0].key == key || bucket[0].cost <= entry.cost) {
+        bucket[0] = entry;
+    } else {
+        bucket[1] = entry;
+    }
+}
+
+void solution_cache_add_nodes(uint64_t nodes) {
+    stats.nodes += nodes;
+}
+
+void solution_cache_set_enabled(bool enabled) {
+    disabled = !enabled;
+}
+
+void solution_cache_clear(void) {
+    if (table != NULL) {
+        memset(table, 0, 2 * CACHE_BUCKETS * sizeof(CacheEntry));
+    }
+    memset(&stats, 0, sizeof(stats));
+}
+
+SolutionCacheStats solution_cache_stats(void) {
+    return stats;
+}
+
+void solution_cache_thread_cleanup(void) {
+    free(table);
+    table = NULL;
+    alloc_failed = false;
+}
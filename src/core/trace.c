@@ -0,0 +1,221 @@
+/**
+ * @file trace.c
+ * @brief SPSC ring buffer for asynchronous event tracing
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * CLASSIC SPSC RING:
+ * - head: next slot to write, written only by the producer
+ * - tail: next slot to read, written only by the consumer
+ * - Both are free-running counters; slot = counter & mask
+ * - Occupancy = head - tail (never larger than capacity)
+ *
+ * The producer publishes a record with a release store of head after
+ * writing it; the consumer acquires head before reading records and
+ * releases tail after copying them out, which hands the slots back.
+ * head and tail live on different cache lines so the two threads do
+ * not invalidate each other's line on every event.
+ */
+
+#include "sudoku/core/trace.h"
+#include "sudoku/core/cancel.h"    // sudoku_clock_ns()
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#ifndef __STDC_NO_THREADS__
+#include <threads.h>
+#endif
+
+/** @brief Capacity used when sudoku_trace_create() is given 0 */
+#define TRACE_DEFAULT_CAPACITY 4096
+
+/** @brief Assumed cache line size (false-sharing padding) */
+#define TRACE_CACHE_LINE 64
+
+// ═══════════════════════════════════════════════════════════════════
+//                    INTERNAL STRUCTURE
+// ═══════════════════════════════════════════════════════════════════
+
+struct SudokuTraceBuffer {
+    // ─── Producer cache line ───
+    _Alignas(TRACE_CACHE_LINE) atomic_size_t head;
+    atomic_uint_least64_t pushed;
+    atomic_uint_least64_t dropped;
+    atomic_size_t high_water;
+    uint32_t next_sequence;             ///< Producer-only
+
+    // ─── Consumer cache line ───
+    _Alignas(TRACE_CACHE_LINE) atomic_size_t tail;
+    atomic_uint_least64_t drained;
+
+    // ─── Read-only after creation ───
+    _Alignas(TRACE_CACHE_LINE) size_t mask;
+    SudokuTraceOverflow policy;
+    SudokuTraceRecord *records;
+};
+
+/** @brief Let the consumer run while the producer waits (BLOCK policy) */
+static void trace_yield(void) {
+#ifndef __STDC_NO_THREADS__
+    thrd_yield();
+#endif
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    LIFECYCLE
+// ═══════════════════════════════════════════════════════════════════
+
+SudokuTraceBuffer* sudoku_trace_create(size_t capacity, SudokuTraceOverflow policy) {
+    size_t wanted = (capacity > 0) ? capacity : TRACE_DEFAULT_CAPACITY;
+    size_t size = 1;
+    while (size < wanted) {
+        size <<= 1;
+    }
+
+    // aligned_alloc() requires a size multiple of the alignment
+    size_t bytes = (sizeof(SudokuTraceBuffer) + TRACE_CACHE_LINE - 1)
+                   & ~(size_t)(TRACE_CACHE_LINE - 1);
+    SudokuTraceBuffer *trace = (SudokuTraceBuffer*)aligned_alloc(TRACE_CACHE_LINE, bytes);
+    if (trace == NULL) {
+        fprintf(stderr, "Error: Failed to allocate SudokuTraceBuffer structure\n");
+        return NULL;
+    }
+
+    trace->records = (SudokuTraceRecord*)malloc(size * sizeof(SudokuTraceRecord));
+    if (trace->records == NULL) {
+        fprintf(stderr, "Error: Failed to allocate %zu trace records\n", size);
+        free(trace);
+        return NULL;
+    }
+
+    atomic_init(&trace->head, 0);
+    atomic_init(&trace->pushed, 0);
+    atomic_init(&trace->dropped, 0);
+    atomic_init(&trace->high_water, 0);
+    trace->next_sequence = 0;
+    atomic_init(&trace->tail, 0);
+    atomic_init(&trace->drained, 0);
+    trace->mask = size - 1;
+    trace->policy = policy;
+    return trace;
+}
+
+void sudoku_trace_destroy(SudokuTraceBuffer *trace) {
+    if (trace == NULL) {
+        return;
+    }
+    free(trace->records);
+    free(trace);
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    PRODUCER SIDE
+// ═══════════════════════════════════════════════════════════════════
+
+bool sudoku_trace_push(SudokuTraceBuffer *trace, const SudokuEventData *event) {
+    if (trace == NULL || event == NULL) {
+        return false;
+    }
+
+    uint32_t sequence = trace->next_sequence++;
+    size_t head = atomic_load_explicit(&trace->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&trace->tail, memory_order_acquire);
+
+    if (head - tail > trace->mask) {
+        if (trace->policy == SUDOKU_TRACE_DROP_NEWEST) {
+            atomic_fetch_add_explicit(&trace->dropped, 1, memory_order_relaxed);
+            return false;
+        }
+        // SUDOKU_TRACE_BLOCK: wait for the consumer to hand slots back
+        do {
+            trace_yield();
+            tail = atomic_load_explicit(&trace->tail, memory_order_acquire);
+        } while (head - tail > trace->mask);
+    }
+
+    SudokuTraceRecord *record = &trace->records[head & trace->mask];
+    record->timestamp_ns = sudoku_clock_ns();
+    record->sequence = sequence;
+    record->type = (uint16_t)event->type;
+    record->phase_number = (int16_t)event->phase_number;
+    record->cells_removed_total = event->cells_removed_total;
+    record->round_number = event->round_number;
+    record->row = (int16_t)event->row;
+    record->col = (int16_t)event->col;
+    record->value = (int16_t)event->value;
+
+    // Publish the record
+    atomic_store_explicit(&trace->head, head + 1, memory_order_release);
+    atomic_fetch_add_explicit(&trace->pushed, 1, memory_order_relaxed);
+
+    size_t occupancy = head + 1 - tail;
+    if (occupancy > atomic_load_explicit(&trace->high_water, memory_order_relaxed)) {
+        atomic_store_explicit(&trace->high_water, occupancy, memory_order_relaxed);
+    }
+    return true;
+}
+
+void sudoku_trace_callback(const SudokuEventData *event, void *user_data) {
+    sudoku_trace_push((SudokuTraceBuffer*)user_data, event);
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    CONSUMER SIDE
+// ═══════════════════════════════════════════════════════════════════
+
+size_t sudoku_trace_drain(SudokuTraceBuffer *trace, SudokuTraceRecord *out, size_t max) {
+    if (trace == NULL || out == NULL || max == 0) {
+        return 0;
+    }
+
+    size_t tail = atomic_load_explicit(&trace->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&trace->head, memory_order_acquire);
+    size_t count = head - tail;
+    if (count > max) {
+        count = max;
+    }
+
+    // At most two memcpy: up to the end of the ring, then from slot 0
+    size_t start = tail & trace->mask;
+    size_t first = trace->mask + 1 - start;
+    if (first > count) {
+        first = count;
+    }
+    memcpy(out, &trace->records[start], first * sizeof(SudokuTraceRecord));
+    memcpy(out + first, trace->records, (count - first) * sizeof(SudokuTraceRecord));
+
+    // Hand the slots back to the producer
+    atomic_store_explicit(&trace->tail, tail + count, memory_order_release);
+    atomic_fetch_add_explicit(&trace->drained, count, memory_order_relaxed);
+    return count;
+}
+
+size_t sudoku_trace_pending(const SudokuTraceBuffer *trace) {
+    if (trace == NULL) {
+        return 0;
+    }
+    // C11 atomic loads take non-const pointers
+    SudokuTraceBuffer *t = (SudokuTraceBuffer*)trace;
+    size_t tail = atomic_load_explicit(&t->tail, memory_order_acquire);
+    size_t head = atomic_load_explicit(&t->head, memory_order_acquire);
+    return head - tail;
+}
+
+void sudoku_trace_get_stats(const SudokuTraceBuffer *trace, SudokuTraceStats *stats) {
+    if (stats == NULL) {
+        return;
+    }
+    memset(stats, 0, sizeof(*stats));
+    if (trace == NULL) {
+        return;
+    }
+
+    // C11 atomic loads take non-const pointers
+    SudokuTraceBuffer *t = (SudokuTraceBuffer*)trace;
+    stats->pushed = atomic_load_explicit(&t->pushed, memory_order_relaxed);
+    stats->dropped = atomic_load_explicit(&t->dropped, memory_order_relaxed);
+    stats->drained = atomic_load_explicit(&t->drained, memory_order_relaxed);
+    stats->high_water = atomic_load_explicit(&t->high_water, memory_order_relaxed);
+    stats->capacity = t->mask + 1;
+}
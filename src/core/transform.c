@@ -0,0 +1,154 @@
+/**
+ * @file transform.c
+ * @brief Validity-preserving board transforms
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * All enabled operations are first composed into three maps
+ * (destination row → source row, destination column → source column,
+ * old digit → new digit). Transpose and rotation are then folded into
+ * the coordinate lookup, so the board is rewritten in ONE pass through
+ * a scratch copy regardless of how many operations were selected.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "sudoku/core/transform.h"
+#include "sudoku/core/board.h"
+#include "internal/algorithms_internal.h"
+#include "internal/arena_internal.h"
+#include "internal/random_internal.h"
+
+// ═══════════════════════════════════════════════════════════════════
+//                    MAP CONSTRUCTION
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Build a line map respecting band (or stack) structure
+ *
+ * map[b*k + i] = group_perm[b]*k + inner_perm[i], where group_perm
+ * reorders whole bands and inner_perm (drawn per band) reorders the
+ * lines inside each band. Either permutation may be the identity.
+ * @p tmp must hold 2k ints.
+ */
+static void build_line_map(int *map, int *tmp, int k,
+                           bool shuffle_groups, bool shuffle_lines) {
+    int *groups = tmp + k;
+
+    if (shuffle_groups) {
+        sudoku_generate_permutation(groups, k, 0);
+    } else {
+        for (int b = 0; b < k; b++) groups[b] = b;
+    }
+
+    for (int b = 0; b < k; b++) {
+        if (shuffle_lines) {
+            sudoku_generate_permutation(tmp, k, 0);
+        } else {
+            for (int i = 0; i < k; i++) tmp[i] = i;
+        }
+        for (int i = 0; i < k; i++) {
+            map[b * k + i] = groups[b] * k + tmp[i];
+        }
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    PUBLIC API
+// ═══════════════════════════════════════════════════════════════════
+
+bool sudoku_board_transform(SudokuBoard *board, unsigned int flags) {
+    if (board == NULL || board->cells == NULL) {
+        return false;
+    }
+
+    const int n = board->board_size;
+    const int k = board->subgrid_size;
+
+    // One scratch-arena block: digit map, row map, column map,
+    // per-band scratch, then the n² snapshot of the original cells.
+    SudokuArena *arena = arena_scratch();
+    SudokuArenaMark mark = sudoku_arena_mark(arena);
+    int *buffer = sudoku_arena_alloc(arena, sizeof(int) * ((size_t)(n + 1) + 2 * n + 2 * k + n * n));
+    if (buffer == NULL) {
+        return false;
+    }
+    int *digit_map = buffer;
+    int *row_map = digit_map + (n + 1);
+    int *col_map = row_map + n;
+    int *tmp = col_map + n;
+    int *snapshot = tmp + 2 * k;
+
+    // Digit relabelling (0 always maps to 0 so empty cells stay empty)
+    digit_map[0] = 0;
+    if (flags & SUDOKU_TRANSFORM_DIGITS) {
+        sudoku_generate_permutation(digit_map + 1, n, 1);
+    } else {
+        for (int d = 1; d <= n; d++) digit_map[d] = d;
+    }
+
+    build_line_map(row_map, tmp, k,
+                   (flags & SUDOKU_TRANSFORM_BANDS) != 0,
+                   (flags & SUDOKU_TRANSFORM_ROWS) != 0);
+    build_line_map(col_map, tmp, k,
+                   (flags & SUDOKU_TRANSFORM_STACKS) != 0,
+                   (flags & SUDOKU_TRANSFORM_COLUMNS) != 0);
+
+    const bool transpose = (flags & SUDOKU_TRANSFORM_TRANSPOSE) && (random_below(2) == 1);
+    const int quarter_turns = (flags & SUDOKU_TRANSFORM_ROTATE) ? random_below(4) : 0;
+
+    // Rows are contiguous (see board_footprint()): one copy
+    memcpy(snapshot, board->cells[0], sizeof(int) * n * n);
+
+    // For each destination cell, walk the operations backwards to find
+    // the source cell: undo rotation, undo transpose, then apply maps.
+    for (int r = 0; r < n; r++) {
+        for (int c = 0; c < n; c++) {
+            int sr = r, sc = c;
+
+            // Clockwise quarter turn: new[r][c] = old[n-1-c][r]
+            for (int q = 0; q < quarter_turns; q++) {
+                int t = sr;
+                sr = n - 1 - sc;
+                sc = t;
+            }
+            if (transpose) {
+                int t = sr;
+                sr = sc;
+                sc = t;
+            }
+
+            board->cells[r][c] = digit_map[snapshot[row_map[sr] * n + col_map[sc]]];
+        }
+    }
+
+    sudoku_arena_release(arena, mark);
+    // Clue count is invariant, but keep the cached stats authoritative
+    sudoku_board_update_stats(board);
+    return true;
+}
+
+int sudoku_board_transform_batch(const SudokuBoard *seed,
+                                 SudokuBoard **variants,
+                                 int count,
+                                 unsigned int flags) {
+    if (seed == NULL || variants == NULL || count <= 0) {
+        return 0;
+    }
+
+    int produced = 0;
+
+    for (int i = 0; i < count; i++) {
+        SudokuBoard *variant = sudoku_board_clone(seed);
+        if (variant == NULL) {
+            break;
+        }
+        if (!sudoku_board_transform(variant, flags)) {
+            sudoku_board_destroy(variant);
+            break;
+        }
+        variants[produced++] = variant;
+    }
+
+    return produced;
+}
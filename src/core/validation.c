@@ -27,6 +27,11 @@
 #include "sudoku/core/validation.h"
 #include "sudoku/core/types.h"
 #include "internal/board_internal.h"
+#include "internal/arena_internal.h"
+#include "internal/interrupt_internal.h"
+#include "internal/kernels_internal.h"
+#include "internal/grid4_internal.h"
+#include <string.h>
 
 // ═══════════════════════════════════════════════════════════════════
 //                    POSITION VALIDATION
@@ -55,6 +60,12 @@
 bool sudoku_is_safe_position(const SudokuBoard *board, 
                               const SudokuPosition *pos, 
                               int num) {
+    // 4×4, 9×9, 16×16 and 25×25: constant-geometry kernel
+    const SudokuKernels *kernels = sudoku_kernels_for(board->subgrid_size);
+    if (kernels != NULL) {
+        return kernels->is_safe(board->cells[0], pos->row, pos->col, num);
+    }
+    
     // Extract board geometry dynamically from the board instance
     // This replaces hardcoded SUDOKU_SIZE and SUBGRID_SIZE constants
     int board_size = board->board_size;
@@ -129,6 +140,11 @@ bool sudoku_is_safe_position(const SudokuBoard *board,
  *       Future refactoring could relocate it for better architecture.
  */
 bool sudoku_find_empty_cell(const SudokuBoard *board, SudokuPosition *pos) {
+    const SudokuKernels *kernels = sudoku_kernels_for(board->subgrid_size);
+    if (kernels != NULL) {
+        return kernels->find_empty(board->cells[0], pos);
+    }
+    
     // Extract board size dynamically
     int board_size = board->board_size;
     
@@ -154,80 +170,166 @@ bool sudoku_find_empty_cell(const SudokuBoard *board, SudokuPosition *pos) {
 /**
  * @brief Validate that the entire board is free of rule violations
  * 
- * PHASE 2B CHANGES: Adapted to iterate to board->board_size. Also modified
- * the temporary board modification approach to work with dynamic memory
- * (cannot use simple struct copy with int **cells).
- * 
  * Performs comprehensive validation by checking every filled cell against
  * all three Sudoku rules. This is used to verify integrity of generated
  * puzzles or validate user-proposed solutions.
  * 
- * Algorithm: For each occupied cell, temporarily remove its value, then
- * verify that value would be legal in that position using standard safety
- * checks. If any cell fails this test, the board contains conflicts.
+ * Algorithm: ONE pass over the board with "seen" flags per row, column
+ * and subgrid. A value that was already seen in any of its three units is
+ * a conflict.
+ * 
+ * SEEN FLAGS LAYOUT (3 × n × (n+1) bytes, taken from the scratch arena):
  * 
- * This approach is elegant because it reuses sudoku_is_safe_position(),
- * avoiding code duplication of the validation logic.
+ *   rows[r * (n+1) + v]     value v already in row r
+ *   cols[c * (n+1) + v]     value v already in column c
+ *   boxes[b * (n+1) + v]    value v already in subgrid b
+ * 
+ * Earlier versions removed each value, called sudoku_is_safe_position()
+ * and put it back, which was O(n³) and had to cast away const. This
+ * version never writes to the board.
  * 
  * @param board Pointer to the board to validate (read-only)
  * @return true if board is valid (no conflicts), false if violations exist
+ *         or a cell holds a value outside 0..board_size
  * 
  * @note Empty cells (value 0) are skipped and don't affect validity
- * @note Time complexity: O(n³) where n=board_size, as we check all constraints
- *       for each of the n² cells
+ * @note Time complexity: O(n²) where n=board_size
  * @note A completely empty board is considered valid
- * @note The const qualifier on board parameter is temporarily "cast away"
- *       during validation, but the board is immediately restored to its
- *       original state. This is safe but technically violates const-correctness.
  */
 bool sudoku_validate_board(const SudokuBoard *board) {
+    const SudokuKernels *kernels = sudoku_kernels_for(board->subgrid_size);
+    if (kernels != NULL) {
+        return kernels->validate(board->cells[0]);
+    }
+    
     // Extract board size dynamically
-    int board_size = board->board_size;
+    const int n = board->board_size;
+    const int k = board->subgrid_size;
+    const size_t stride = (size_t)n + 1;
     
-    // Verify each cell in the board_size × board_size grid
-    // Iterate to board_size instead of SUDOKU_SIZE (9)
-    for (int i = 0; i < board_size; i++) {
-        for (int j = 0; j < board_size; j++) {
+    SudokuArena *arena = arena_scratch();
+    SudokuArenaMark mark = sudoku_arena_mark(arena);
+    unsigned char *rows = sudoku_arena_alloc(arena, 3 * (size_t)n * stride);
+    if (rows == NULL) {
+        return false;
+    }
+    memset(rows, 0, 3 * (size_t)n * stride);
+    unsigned char *cols = rows + (size_t)n * stride;
+    unsigned char *boxes = cols + (size_t)n * stride;
+    
+    bool valid = true;
+    for (int i = 0; i < n && valid; i++) {
+        for (int j = 0; j < n; j++) {
+            int num = board->cells[i][j];
+            
             // Skip empty cells - they don't violate any rules
-            if (board->cells[i][j] == 0) {
+            if (num == 0) {
                 continue;
             }
+            if (num < 0 || num > n) {
+                valid = false;
+                break;
+            }
             
-            // Save the current cell's value
-            int num = board->cells[i][j];
-            
-            // PHASE 2B NOTE: We cannot use "SudokuBoard temp = *board;" anymore
-            // because board->cells is now int** (pointer), not int[][] (array).
-            // Copying the struct would copy the pointer, not the actual data.
-            // Instead, we temporarily modify the board and immediately restore it.
-            
-            // Temporarily mark cell as empty to test if its value is legal
-            // We need to cast away const - this is safe because we restore immediately
-            int original = board->cells[i][j];
-            ((SudokuBoard*)board)->cells[i][j] = 0;
-            
-            // Check if this number could legally be placed at this position
-            // If not, then having it there violates Sudoku rules
-            SudokuPosition pos = {i, j};
-            bool is_safe = sudoku_is_safe_position(board, &pos, num);
-            
-            // Immediately restore the original value
-            ((SudokuBoard*)board)->cells[i][j] = original;
+            int b = (i / k) * k + j / k;
+            unsigned char *in_row = &rows[i * stride + num];
+            unsigned char *in_col = &cols[j * stride + num];
+            unsigned char *in_box = &boxes[b * stride + num];
             
-            if (!is_safe) {
-                return false;  // Conflict detected
+            if (*in_row || *in_col || *in_box) {
+                valid = false;  // Conflict detected
+                break;
             }
+            *in_row = *in_col = *in_box = 1;
         }
     }
     
-    // All cells passed verification - board is valid
-    return true;
+    sudoku_arena_release(arena, mark);
+    return valid;
 }
 
 // ═══════════════════════════════════════════════════════════════════
 //                    SOLUTION COUNTING
 // ═══════════════════════════════════════════════════════════════════
 
+/**
+ * @brief Recursive core of countSolutionsExact() / countSolutionsExactEx()
+ * 
+ * @param poller Interrupt countdown; once it fires, every level restores
+ *               its cell and returns the solutions counted so far
+ */
+static int count_solutions_recursive(SudokuBoard *board, int limit,
+                                     InterruptPoller *poller) {
+    SudokuPosition pos;
+    
+    if (interrupt_poller_tick(poller)) {
+        return 0;
+    }
+    
+    // Base case: if no empty cells remain, we have a complete solution
+    if (!sudoku_find_empty_cell(board, &pos)) {
+        return 1;
+    }
+    
+    // Extract board size to determine range of valid numbers
+    int board_size = board->board_size;
+    
+    int totalSolutions = 0;
+    
+    // Recursive case: try each number 1 to board_size in the first empty cell
+    // For 4×4: tries 1,2,3,4
+    // For 9×9: tries 1,2,3,4,5,6,7,8,9
+    // For 16×16: tries 1,2,3,...,16
+    // Iterate to board_size instead of SUDOKU_SIZE (9)
+    for (int num = 1; num <= board_size; num++) {
+        // Only try numbers that satisfy Sudoku rules at this position
+        if (sudoku_is_safe_position(board, &pos, num)) {
+            // Place number temporarily
+            board->cells[pos.row][pos.col] = num;
+            
+            // Recursively count solutions for the resulting board state
+            totalSolutions += count_solutions_recursive(board, limit, poller);
+            
+            // Early exit optimization: if we've already found enough solutions
+            // to exceed the limit (or the search was interrupted), no point
+            // continuing the search
+            if (totalSolutions >= limit || poller->status != SUDOKU_STATUS_OK) {
+                // Backtrack before returning (critical for correctness!)
+                board->cells[pos.row][pos.col] = 0;
+                return totalSolutions;
+            }
+            
+            // Backtrack: remove the number to try next possibility
+            // This ensures board is restored to state before this iteration
+            board->cells[pos.row][pos.col] = 0;
+        }
+    }
+    
+    // Return total solutions found across all valid placements
+    // Note: board is now in identical state as when function was called
+    return totalSolutions;
+}
+
+/**
+ * @brief Specialised counter for the shipped geometries, generic otherwise
+ * 
+ * Both explore the same tree in the same order, so they return the same
+ * count and are interrupted after the same number of nodes. 4×4 boards
+ * skip the search altogether: the count comes from the table of all
+ * 288 grids (grid4_internal.h), which is too quick to need polling.
+ */
+static int count_solutions_dispatch(SudokuBoard *board, int limit,
+                                    InterruptPoller *poller) {
+    if (board->subgrid_size == 2) {
+        return grid4_count_solutions(board->cells[0], limit, NULL);
+    }
+    const SudokuKernels *kernels = sudoku_kernels_for(board->subgrid_size);
+    if (kernels != NULL) {
+        return kernels->count_solutions(board->cells[0], limit, poller);
+    }
+    return count_solutions_recursive(board, limit, poller);
+}
+
 /**
  * @brief Count number of solutions using exhaustive backtracking
  * 
@@ -285,47 +387,30 @@ bool sudoku_validate_board(const SudokuBoard *board) {
  * @endcode
  */
 int countSolutionsExact(SudokuBoard *board, int limit) {
-    SudokuPosition pos;
-    
-    // Base case: if no empty cells remain, we have a complete solution
-    if (!sudoku_find_empty_cell(board, &pos)) {
-        return 1;
-    }
-    
-    // Extract board size to determine range of valid numbers
-    int board_size = board->board_size;
+    InterruptPoller poller;
+    interrupt_poller_init(&poller, NULL);
+    return count_solutions_dispatch(board, limit, &poller);
+}
+
+/**
+ * @brief countSolutionsExact() that can be cancelled or time out
+ * 
+ * Same search; the stop conditions are polled every
+ * SUDOKU_INTERRUPT_INTERVAL nodes. An interrupted search unwinds
+ * immediately, restoring the board on the way out.
+ */
+int countSolutionsExactEx(SudokuBoard *board, int limit,
+                          const SudokuInterrupt *interrupt, SudokuStatus *status) {
+    InterruptPoller poller;
+    interrupt_poller_init(&poller, interrupt);
     
-    int totalSolutions = 0;
+    // A request that is already over does not start the search
+    poller.status = sudoku_interrupt_check(interrupt);
+    int solutions = (poller.status == SUDOKU_STATUS_OK)
+                  ? count_solutions_dispatch(board, limit, &poller) : 0;
     
-    // Recursive case: try each number 1 to board_size in the first empty cell
-    // For 4×4: tries 1,2,3,4
-    // For 9×9: tries 1,2,3,4,5,6,7,8,9
-    // For 16×16: tries 1,2,3,...,16
-    // Iterate to board_size instead of SUDOKU_SIZE (9)
-    for (int num = 1; num <= board_size; num++) {
-        // Only try numbers that satisfy Sudoku rules at this position
-        if (sudoku_is_safe_position(board, &pos, num)) {
-            // Place number temporarily
-            board->cells[pos.row][pos.col] = num;
-            
-            // Recursively count solutions for the resulting board state
-            totalSolutions += countSolutionsExact(board, limit);
-            
-            // Early exit optimization: if we've already found enough solutions
-            // to exceed the limit, no point continuing the search
-            if (totalSolutions >= limit) {
-                // Backtrack before returning (critical for correctness!)
-                board->cells[pos.row][pos.col] = 0;
-                return totalSolutions;
-            }
-            
-            // Backtrack: remove the number to try next possibility
-            // This ensures board is restored to state before this iteration
-            board->cells[pos.row][pos.col] = 0;
-        }
+    if (status != NULL) {
+        *status = poller.status;
     }
-    
-    // Return total solutions found across all valid placements
-    // Note: board is now in identical state as when function was called
-    return totalSolutions;
+    return solutions;
 }
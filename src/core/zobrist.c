@@ -0,0 +1,70 @@
+/**
+ * @file zobrist.c
+ * @brief Per-geometry Zobrist key tables
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * See zobrist_internal.h.
+ */
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include "internal/zobrist_internal.h"
+
+#define ZOBRIST_MIN_K 2
+#define ZOBRIST_MAX_K 5
+
+/** @brief Entries of the table for subgrid size k: k⁴ cells × (k² + 1) values */
+#define ZOBRIST_ENTRIES(k) ((k) * (k) * (k) * (k) * ((k) * (k) + 1))
+
+static uint64_t keys_k2[ZOBRIST_ENTRIES(2)];
+static uint64_t keys_k3[ZOBRIST_ENTRIES(3)];
+static uint64_t keys_k4[ZOBRIST_ENTRIES(4)];
+static uint64_t keys_k5[ZOBRIST_ENTRIES(5)];
+
+static uint64_t *const tables[] = { keys_k2, keys_k3, keys_k4, keys_k5 };
+
+enum { TABLES_EMPTY, TABLES_FILLING, TABLES_READY };
+static atomic_int tables_state = TABLES_EMPTY;
+
+static void fill_table(uint64_t *table, int k) {
+    int n = k * k;
+    for (int cell = 0; cell < n * n; cell++) {
+        for (int value = 0; value <= n; value++) {
+            table[cell * (n + 1) + value] = zobrist_key(k, cell, value);
+        }
+    }
+}
+
+/**
+ * @brief Fill every table exactly once
+ *
+ * The first caller fills; concurrent callers wait for it. Readers see
+ * the tables through the release/acquire pair on tables_state.
+ */
+static void tables_init(void) {
+    if (atomic_load_explicit(&tables_state, memory_order_acquire) == TABLES_READY) {
+        return;
+    }
+
+    int expected = TABLES_EMPTY;
+    if (atomic_compare_exchange_strong(&tables_state, &expected, TABLES_FILLING)) {
+        for (int k = ZOBRIST_MIN_K; k <= ZOBRIST_MAX_K; k++) {
+            fill_table(tables[k - ZOBRIST_MIN_K], k);
+        }
+        atomic_store_explicit(&tables_state, TABLES_READY, memory_order_release);
+        return;
+    }
+
+    while (atomic_load_explicit(&tables_state, memory_order_acquire) != TABLES_READY) {
+        // A few microseconds: another thread is filling the tables
+    }
+}
+
+const uint64_t* zobrist_table(int subgrid_size) {
+    if (subgrid_size < ZOBRIST_MIN_K || subgrid_size > ZOBRIST_MAX_K) {
+        return NULL;
+    }
+    tables_init();
+    return tables[subgrid_size - ZOBRIST_MIN_K];
+}
@@ -0,0 +1,420 @@
+/**
+ * @file bench_kernels.c
+ * @brief Micro-benchmarks for the validation and search kernels
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * Times the individual building blocks of the generator in isolation,
+ * so a kernel-level optimisation can be measured without the noise of
+ * a full (randomised) generation:
+ *
+ *   sudoku_is_safe_position   sudoku_find_empty_cell   sudoku_validate_board
+ *   countSolutionsExact       hasAlternative           sudoku_generate_permutation
+ *   constraint_network_create
+ *
+ * METHOD:
+ * - Inputs are FIXED (hard-coded puzzles and a formula-generated grid),
+ *   so two runs measure exactly the same work
+ * - Each benchmark is warmed up, then calibrated once: the iteration
+ *   count is doubled until one sample takes ≥ BENCH_SAMPLE_NS. That
+ *   count is printed and reused for every sample (or forced with -n)
+ * - BENCH_SAMPLES samples are taken; median and minimum ns/op reported
+ * - Results go through bench_consume() and memory is clobbered between
+ *   iterations so the compiler cannot hoist or delete the work
+ *
+ * Build with optimisations for meaningful numbers:
+ *   cmake -S . -B build -DCMAKE_BUILD_TYPE=Release
+ *   cmake --build build --target bench_kernels
+ *   ./build/bin/bench_kernels [-f filter] [-n iterations]
+ *
+ * Not registered with CTest: timings are not pass/fail.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "sudoku/core/board.h"
+#include "sudoku/core/validation.h"
+#include "sudoku/core/cancel.h"
+#include "sudoku/core/batch.h"
+#include "sudoku/algorithms/network.h"
+#include "internal/algorithms_internal.h"
+#include "internal/elimination_internal.h"
+
+// ═══════════════════════════════════════════════════════════════════
+//                    HARNESS
+// ═══════════════════════════════════════════════════════════════════
+
+#define BENCH_SAMPLES 7
+#define BENCH_SAMPLE_NS 50000000ull    ///< Calibrated sample length (50 ms)
+#define BENCH_WARMUP_NS 20000000ull    ///< Warm-up before calibration (20 ms)
+
+/** @brief Sink for benchmark results (one volatile store per op) */
+static volatile uint64_t bench_sink;
+
+static inline void bench_consume(uint64_t value) {
+    bench_sink = value;
+}
+
+/**
+ * @brief Compiler barrier: memory may have changed, values were used
+ *
+ * Prevents loop-invariant hoisting of kernel calls whose inputs did not
+ * change between iterations.
+ */
+static inline void bench_clobber(void) {
+#if defined(__GNUC__) || defined(__clang__)
+    __asm__ __volatile__("" ::: "memory");
+#else
+    bench_sink = bench_sink;
+#endif
+}
+
+typedef void (*BenchFn)(long iterations);
+
+typedef struct {
+    const char *name;
+    BenchFn fn;
+} Benchmark;
+
+static uint64_t run_once(BenchFn fn, long iterations) {
+    uint64_t start = sudoku_clock_ns();
+    fn(iterations);
+    return sudoku_clock_ns() - start;
+}
+
+static int compare_double(const void *a, const void *b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static void run_benchmark(const Benchmark *bench, long forced_iterations) {
+    // Warm-up: caches, branch predictors, lazy allocations
+    uint64_t warm_start = sudoku_clock_ns();
+    while (sudoku_clock_ns() - warm_start < BENCH_WARMUP_NS) {
+        bench->fn(1);
+    }
+
+    // Calibration: fixed iteration count used by every sample
+    long iterations = forced_iterations;
+    if (iterations <= 0) {
+        iterations = 1;
+        while (run_once(bench->fn, iterations) < BENCH_SAMPLE_NS && iterations < (1L << 40)) {
+            iterations *= 2;
+        }
+    }
+
+    double ns_per_op[BENCH_SAMPLES];
+    for (int s = 0; s < BENCH_SAMPLES; s++) {
+        ns_per_op[s] = (double)run_once(bench->fn, iterations) / (double)iterations;
+    }
+    qsort(ns_per_op, BENCH_SAMPLES, sizeof(double), compare_double);
+
+    double median = ns_per_op[BENCH_SAMPLES / 2];
+    double spread = (ns_per_op[BENCH_SAMPLES - 1] - ns_per_op[0]) / median * 100.0;
+    printf("%-36s %12ld %14.1f %14.1f %8.1f%%\n",
+           bench->name, iterations, median, ns_per_op[0], spread);
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    FIXED INPUTS
+// ═══════════════════════════════════════════════════════════════════
+
+/** @brief 9×9 puzzles of increasing search cost (unique solutions) */
+static const char *PUZZLES_9[] = {
+    "530070000600195000098000060800060003400803001700020006060000280000419005000080079",
+    "003020600900305001001806400008102900700000008006708200002609500800203009005010300",
+    "000000907000420180000705026100904000050000040000507009920108000034059000507000000",
+    "030050040008010500460000012070502080000603000040109030250000098001020600080060020",
+};
+#define PUZZLE_COUNT (int)(sizeof(PUZZLES_9) / sizeof(PUZZLES_9[0]))
+
+static const char *SOLUTION_9 =
+    "534678912672195348198342567859761423426853791713924856961537284287419635345286179";
+
+static SudokuBoard *puzzles[PUZZLE_COUNT];
+static SudokuBoard *solved9;        ///< Complete 9×9
+static SudokuBoard *solved16;       ///< Complete 16×16 (pattern grid)
+static SudokuBoard *sparse9;        ///< Solution with 40 cells cleared
+static SudokuBoard *late_empty9;    ///< Solution with only the last cell empty
+
+static SudokuBoard *board_from_string(const char *digits) {
+    SudokuBoard *board = sudoku_board_create();
+    for (int i = 0; i < 81; i++) {
+        board->cells[i / 9][i % 9] = digits[i] - '0';
+    }
+    return board;
+}
+
+/**
+ * @brief Complete board from the classic shifted-pattern formula
+ */
+static SudokuBoard *pattern_board(int subgrid_size) {
+    SudokuBoard *board = sudoku_board_create_size(subgrid_size);
+    int n = board->board_size, k = subgrid_size;
+    for (int r = 0; r < n; r++) {
+        for (int c = 0; c < n; c++) {
+            board->cells[r][c] = (r * k + r / k + c) % n + 1;
+        }
+    }
+    return board;
+}
+
+static void setup_inputs(void) {
+    for (int i = 0; i < PUZZLE_COUNT; i++) {
+        puzzles[i] = board_from_string(PUZZLES_9[i]);
+    }
+    solved9 = board_from_string(SOLUTION_9);
+    solved16 = pattern_board(4);
+
+    sparse9 = board_from_string(SOLUTION_9);
+    for (int i = 0; i < 40; i++) {
+        int cell = (i * 29) % 81;       // 29 is coprime with 81: 40 distinct cells
+        sparse9->cells[cell / 9][cell % 9] = 0;
+    }
+
+    late_empty9 = board_from_string(SOLUTION_9);
+    late_empty9->cells[8][8] = 0;
+}
+
+static void teardown_inputs(void) {
+    for (int i = 0; i < PUZZLE_COUNT; i++) {
+        sudoku_board_destroy(puzzles[i]);
+    }
+    sudoku_board_destroy(solved9);
+    sudoku_board_destroy(solved16);
+    sudoku_board_destroy(sparse9);
+    sudoku_board_destroy(late_empty9);
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    KERNELS
+// ═══════════════════════════════════════════════════════════════════
+
+/* One op = one call; loops cycle through positions/values so the
+ * branch pattern is not trivially predictable. */
+
+static void bench_is_safe_9(long iterations) {
+    uint64_t hits = 0;
+    for (long i = 0; i < iterations; i++) {
+        SudokuPosition pos = { (int)(i % 9), (int)((i / 9) % 9) };
+        hits += sudoku_is_safe_position(puzzles[0], &pos, (int)(i % 9) + 1);
+        bench_clobber();
+    }
+    bench_consume(hits);
+}
+
+static void bench_is_safe_16(long iterations) {
+    uint64_t hits = 0;
+    for (long i = 0; i < iterations; i++) {
+        SudokuPosition pos = { (int)(i % 16), (int)((i / 16) % 16) };
+        hits += sudoku_is_safe_position(solved16, &pos, (int)(i % 16) + 1);
+        bench_clobber();
+    }
+    bench_consume(hits);
+}
+
+static void bench_find_empty_first(long iterations) {
+    SudokuPosition pos;
+    uint64_t acc = 0;
+    for (long i = 0; i < iterations; i++) {
+        acc += sudoku_find_empty_cell(puzzles[0], &pos) ? (uint64_t)pos.col : 0;
+        bench_clobber();
+    }
+    bench_consume(acc);
+}
+
+static void bench_find_empty_last(long iterations) {
+    SudokuPosition pos;
+    uint64_t acc = 0;
+    for (long i = 0; i < iterations; i++) {
+        acc += sudoku_find_empty_cell(late_empty9, &pos) ? (uint64_t)pos.row : 0;
+        bench_clobber();
+    }
+    bench_consume(acc);
+}
+
+static void bench_validate_9(long iterations) {
+    uint64_t valid = 0;
+    for (long i = 0; i < iterations; i++) {
+        valid += sudoku_validate_board(solved9);
+        bench_clobber();
+    }
+    bench_consume(valid);
+}
+
+static void bench_validate_16(long iterations) {
+    uint64_t valid = 0;
+    for (long i = 0; i < iterations; i++) {
+        valid += sudoku_validate_board(solved16);
+        bench_clobber();
+    }
+    bench_consume(valid);
+}
+
+static void bench_count_solutions_set(long iterations) {
+    uint64_t total = 0;
+    for (long i = 0; i < iterations; i++) {
+        total += countSolutionsExact(puzzles[i % PUZZLE_COUNT], 2);
+        bench_clobber();
+    }
+    bench_consume(total);
+}
+
+static void bench_count_solutions_sparse(long iterations) {
+    uint64_t total = 0;
+    for (long i = 0; i < iterations; i++) {
+        total += countSolutionsExact(sparse9, 2);
+        bench_clobber();
+    }
+    bench_consume(total);
+}
+
+static void bench_has_alternative(long iterations) {
+    uint64_t alternatives = 0;
+    for (long i = 0; i < iterations; i++) {
+        int cell = (int)(i % 81);
+        SudokuPosition pos = { cell / 9, cell % 9 };
+        int value = sparse9->cells[pos.row][pos.col];
+        if (value == 0) {
+            value = solved9->cells[pos.row][pos.col];
+        }
+        alternatives += hasAlternative(sparse9, &pos, value);
+        bench_clobber();
+    }
+    bench_consume(alternatives);
+}
+
+static void bench_permutation_9(long iterations) {
+    int array[9];
+    uint64_t acc = 0;
+    for (long i = 0; i < iterations; i++) {
+        sudoku_generate_permutation(array, 9, 1);
+        acc += (uint64_t)array[0];
+        bench_clobber();
+    }
+    bench_consume(acc);
+}
+
+static void bench_permutation_81(long iterations) {
+    int array[81];
+    uint64_t acc = 0;
+    for (long i = 0; i < iterations; i++) {
+        sudoku_generate_permutation(array, 81, 0);
+        acc += (uint64_t)array[0];
+        bench_clobber();
+    }
+    bench_consume(acc);
+}
+
+static void bench_network_create_9(long iterations) {
+    uint64_t acc = 0;
+    for (long i = 0; i < iterations; i++) {
+        ConstraintNetwork *net = constraint_network_create(puzzles[i % PUZZLE_COUNT]);
+        acc += (uint64_t)constraint_network_domain_size(net, 0, 2);
+        constraint_network_destroy(net);
+        bench_clobber();
+    }
+    bench_consume(acc);
+}
+
+/* One op = 16 puzzles: all lanes in one call, or one call per puzzle */
+
+static void bench_batch_lanes(long iterations) {
+    const SudokuBoard *pack[SUDOKU_BATCH_LANES];
+    int solutions[SUDOKU_BATCH_LANES];
+    for (int l = 0; l < SUDOKU_BATCH_LANES; l++) {
+        pack[l] = puzzles[l % PUZZLE_COUNT];
+    }
+    uint64_t total = 0;
+    for (long i = 0; i < iterations; i++) {
+        sudoku_batch_count_solutions(pack, SUDOKU_BATCH_LANES, 2, solutions, NULL);
+        total += (uint64_t)solutions[i % SUDOKU_BATCH_LANES];
+        bench_clobber();
+    }
+    bench_consume(total);
+}
+
+static void bench_batch_single(long iterations) {
+    int solution;
+    uint64_t total = 0;
+    for (long i = 0; i < iterations; i++) {
+        for (int l = 0; l < SUDOKU_BATCH_LANES; l++) {
+            const SudokuBoard *one = puzzles[l % PUZZLE_COUNT];
+            sudoku_batch_count_solutions(&one, 1, 2, &solution, NULL);
+            total += (uint64_t)solution;
+        }
+        bench_clobber();
+    }
+    bench_consume(total);
+}
+
+static const Benchmark BENCHMARKS[] = {
+    { "is_safe_position/9x9",              bench_is_safe_9 },
+    { "is_safe_position/16x16",            bench_is_safe_16 },
+    { "find_empty_cell/first_row",         bench_find_empty_first },
+    { "find_empty_cell/last_cell",         bench_find_empty_last },
+    { "validate_board/9x9",                bench_validate_9 },
+    { "validate_board/16x16",              bench_validate_16 },
+    { "countSolutionsExact/puzzle_set",    bench_count_solutions_set },
+    { "countSolutionsExact/41_clues",      bench_count_solutions_sparse },
+    { "hasAlternative/41_clues",           bench_has_alternative },
+    { "generate_permutation/9",            bench_permutation_9 },
+    { "generate_permutation/81",           bench_permutation_81 },
+    { "constraint_network_create/9x9",     bench_network_create_9 },
+    { "batch_count/16_lanes",              bench_batch_lanes },
+    { "batch_count/16_single_calls",       bench_batch_single },
+};
+#define BENCHMARK_COUNT (int)(sizeof(BENCHMARKS) / sizeof(BENCHMARKS[0]))
+
+// ═══════════════════════════════════════════════════════════════════
+//                    MAIN
+// ═══════════════════════════════════════════════════════════════════
+
+static void print_usage(const char *program) {
+    printf("Usage: %s [-f filter] [-n iterations] [-l]\n", program);
+    printf("  -f filter      Only run benchmarks whose name contains filter\n");
+    printf("  -n iterations  Fixed iteration count (skips calibration)\n");
+    printf("  -l             List benchmarks and exit\n");
+}
+
+int main(int argc, char *argv[]) {
+    const char *filter = NULL;
+    long forced_iterations = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            forced_iterations = atol(argv[++i]);
+        } else if (strcmp(argv[i], "-l") == 0) {
+            for (int b = 0; b < BENCHMARK_COUNT; b++) {
+                printf("%s\n", BENCHMARKS[b].name);
+            }
+            return 0;
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    // Fixed seed: the permutation kernels see the same rand() stream
+    srand(12345);
+    setup_inputs();
+
+#ifdef SUDOKU_BENCH_UNOPTIMIZED
+    printf("warning: built without optimisation (set CMAKE_BUILD_TYPE=Release)\n\n");
+#endif
+    printf("%-36s %12s %14s %14s %9s\n", "benchmark", "iterations", "median ns/op", "min ns/op", "spread");
+    printf("%-36s %12s %14s %14s %9s\n", "---------", "----------", "------------", "---------", "------");
+    for (int b = 0; b < BENCHMARK_COUNT; b++) {
+        if (filter == NULL || strstr(BENCHMARKS[b].name, filter) != NULL) {
+            run_benchmark(&BENCHMARKS[b], forced_iterations);
+        }
+    }
+
+    teardown_inputs();
+    return 0;
+}
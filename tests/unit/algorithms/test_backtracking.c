@@ -7,12 +7,27 @@
 
 #include <stdio.h>
 #include <stdlib.h>
-#include <assert.h>
 #include <time.h>
 #include "sudoku/core/types.h"
 #include "sudoku/core/board.h"
 #include "sudoku/core/validation.h"
+#include "sudoku/core/generator.h"
 #include "../internal/generator_internal.h"
+#include "../internal/board_internal.h"
+
+/**
+ * @brief CHECK() that survives NDEBUG
+ * 
+ * The checks wrap the very calls under test (and their results), so a
+ * Release build must still evaluate them.
+ */
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            printf("❌ FAILED\n  %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+            exit(1); \
+        } \
+    } while(0)
 
 /**
  * @brief Test backtracking with a 4×4 board (simplest case)
@@ -26,7 +41,7 @@ void test_backtracking_4x4_partial() {
     printf("Test: sudoku_complete_backtracking with 4×4 partial board... ");
     
     SudokuBoard *board = sudoku_board_create_size(2);  // 2×2 subgrids → 4×4 board
-    assert(board != NULL);
+    CHECK(board != NULL);
     
     // Create a valid partial configuration
     // Starting board:
@@ -50,18 +65,18 @@ void test_backtracking_4x4_partial() {
     bool completed = sudoku_complete_backtracking(board);
     
     // Verify success
-    assert(completed == true);
+    CHECK(completed == true);
     
     // Verify all cells are filled with valid numbers
     for(int i = 0; i < 4; i++) {
         for(int j = 0; j < 4; j++) {
             int value = sudoku_board_get_cell(board, i, j);
-            assert(value >= 1 && value <= 4);
+            CHECK(value >= 1 && value <= 4);
         }
     }
     
     // Verify the board is actually valid (no conflicts)
-    assert(sudoku_validate_board(board) == true);
+    CHECK(sudoku_validate_board(board) == true);
     
     sudoku_board_destroy(board);
     printf("✅ PASSED\n");
@@ -79,7 +94,7 @@ void test_backtracking_9x9_empty() {
     printf("Test: sudoku_complete_backtracking with 9×9 empty board... ");
     
     SudokuBoard *board = sudoku_board_create_size(3);  // 3×3 subgrids → 9×9 board
-    assert(board != NULL);
+    CHECK(board != NULL);
     
     // Board starts completely empty (all zeros)
     // This is the maximum challenge for the backtracking algorithm
@@ -87,7 +102,7 @@ void test_backtracking_9x9_empty() {
     bool completed = sudoku_complete_backtracking(board);
     
     // Verify success
-    assert(completed == true);
+    CHECK(completed == true);
     
     // Count filled cells and verify they're all valid
     int filled_count = 0;
@@ -98,15 +113,15 @@ void test_backtracking_9x9_empty() {
                 filled_count++;
             }
             // Every cell should now contain a number 1-9
-            assert(value >= 1 && value <= 9);
+            CHECK(value >= 1 && value <= 9);
         }
     }
     
     // All 81 cells should be filled
-    assert(filled_count == 81);
+    CHECK(filled_count == 81);
     
     // Validate the completed board
-    assert(sudoku_validate_board(board) == true);
+    CHECK(sudoku_validate_board(board) == true);
     
     sudoku_board_destroy(board);
     printf("✅ PASSED\n");
@@ -124,7 +139,7 @@ void test_backtracking_16x16_partial() {
     printf("Test: sudoku_complete_backtracking with 16×16 partial board... ");
     
     SudokuBoard *board = sudoku_board_create_size(4);  // 4×4 subgrids → 16×16 board
-    assert(board != NULL);
+    CHECK(board != NULL);
     
     // Fill the first subgrid completely to reduce search space
     // This makes the test complete in reasonable time
@@ -140,18 +155,18 @@ void test_backtracking_16x16_partial() {
     bool completed = sudoku_complete_backtracking(board);
     
     // Verify success
-    assert(completed == true);
+    CHECK(completed == true);
     
     // Verify all cells contain valid numbers 1-16
     for(int i = 0; i < 16; i++) {
         for(int j = 0; j < 16; j++) {
             int value = sudoku_board_get_cell(board, i, j);
-            assert(value >= 1 && value <= 16);
+            CHECK(value >= 1 && value <= 16);
         }
     }
     
     // Validate correctness
-    assert(sudoku_validate_board(board) == true);
+    CHECK(sudoku_validate_board(board) == true);
     
     sudoku_board_destroy(board);
     printf("✅ PASSED\n");
@@ -168,7 +183,7 @@ void test_backtracking_already_complete() {
     printf("Test: sudoku_complete_backtracking with already complete board... ");
     
     SudokuBoard *board = sudoku_board_create_size(2);  // 4×4 for speed
-    assert(board != NULL);
+    CHECK(board != NULL);
     
     // Fill the entire board with a valid solution
     // This is a valid 4×4 Sudoku:
@@ -195,13 +210,13 @@ void test_backtracking_already_complete() {
     bool completed = sudoku_complete_backtracking(board);
     
     // Should return true immediately (no cells to fill)
-    assert(completed == true);
+    CHECK(completed == true);
     
     // Board should be unchanged and still valid
     for(int i = 0; i < 4; i++) {
         for(int j = 0; j < 4; j++) {
             int value = sudoku_board_get_cell(board, i, j);
-            assert(value == solution[i][j]);
+            CHECK(value == solution[i][j]);
         }
     }
     
@@ -220,7 +235,7 @@ void test_backtracking_impossible() {
     printf("Test: sudoku_complete_backtracking with impossible configuration... ");
     
     SudokuBoard *board = sudoku_board_create_size(2);  // 4×4 board
-    assert(board != NULL);
+    CHECK(board != NULL);
     
     // Create an impossible configuration by placing conflicts
     // Put two 1's in the same row
@@ -233,7 +248,7 @@ void test_backtracking_impossible() {
     // Should return false (cannot complete)
     // Note: Depending on your validation implementation, this might
     // detect the conflict immediately or after attempting placements
-    assert(completed == false);
+    CHECK(completed == false);
     
     sudoku_board_destroy(board);
     printf("✅ PASSED (correctly rejected impossible board)\n");
@@ -253,7 +268,7 @@ void test_backtracking_memory_management() {
     // Run multiple iterations to ensure no cumulative leaks
     for(int iteration = 0; iteration < 10; iteration++) {
         SudokuBoard *board = sudoku_board_create_size(2);  // 4×4 for speed
-        assert(board != NULL);
+        CHECK(board != NULL);
         
         // Partially fill the board
         sudoku_board_set_cell(board, 0, 0, 1);
@@ -261,7 +276,7 @@ void test_backtracking_memory_management() {
         
         // Complete it
         bool completed = sudoku_complete_backtracking(board);
-        assert(completed == true);
+        CHECK(completed == true);
         
         // Clean up
         sudoku_board_destroy(board);
@@ -270,6 +285,101 @@ void test_backtracking_memory_management() {
     printf("✅ PASSED (10 iterations, no leaks detected)\n");
 }
 
+/**
+ * @brief Test the node budget of sudoku_complete_backtracking_budget()
+ * 
+ * A budget far below what a fill needs must stop the search and report
+ * the nodes it spent; an unlimited budget behaves like the classic call.
+ */
+void test_backtracking_node_budget() {
+    printf("Test: sudoku_complete_backtracking_budget node limit... ");
+    
+    SudokuBoard *board = sudoku_board_create();
+    long nodes = -1;
+    
+    // 10 nodes cannot fill 81 empty cells
+    bool completed = sudoku_complete_backtracking_budget(board, 10, &nodes, NULL);
+    CHECK(completed == false);
+    CHECK(nodes >= 10 && nodes <= 11);
+    
+    // Unlimited budget (≤ 0) completes and counts every node
+    sudoku_board_init(board);
+    completed = sudoku_complete_backtracking_budget(board, 0, &nodes, NULL);
+    CHECK(completed == true);
+    CHECK(nodes >= 82);
+    CHECK(sudoku_validate_board(board) == true);
+    
+    sudoku_board_destroy(board);
+    printf("✅ PASSED\n");
+}
+
+/**
+ * @brief Test the restart driver through sudoku_generate_ex()
+ * 
+ * - Stats report fill nodes and restarts consistently
+ * - max_attempts bounds the number of restarts
+ * - Both restart policies produce valid boards
+ */
+void test_fill_restarts() {
+    printf("Test: budgeted fill with restarts in sudoku_generate_ex... ");
+    
+    SudokuGenerationStats stats;
+    SudokuBoard *board = sudoku_board_create_size(2);
+    
+    // 4×4: filled from the table of all grids, one node per attempt
+    for(int i = 0; i < 20; i++) {
+        SudokuGenerationConfig config = { .restart_policy = (i % 2) ? SUDOKU_RESTART_GEOMETRIC
+                                                                    : SUDOKU_RESTART_LUBY };
+        CHECK(sudoku_generate_ex(board, &config, &stats) == true);
+        CHECK(stats.fill_restarts == stats.total_attempts - 1);
+        CHECK(stats.fill_nodes > 0);
+    }
+    
+    // One attempt with a 1-node budget can only fail
+    SudokuGenerationConfig starved = { .max_attempts = 3, .fill_node_budget = 1 };
+    SudokuBoard *nine = sudoku_board_create();
+    CHECK(sudoku_generate_ex(nine, &starved, &stats) == false);
+    CHECK(stats.total_attempts == 3 && stats.fill_restarts == 2);
+    
+    sudoku_board_destroy(nine);
+    sudoku_board_destroy(board);
+    printf("✅ PASSED\n");
+}
+
+/**
+ * @brief Test the pattern filler and its selection in the config
+ * 
+ * - fillPattern() gives a valid full grid at every supported size
+ * - Two fills differ (the pattern is randomised)
+ * - SUDOKU_FILL_PATTERN generates unique puzzles without restarts
+ */
+void test_fill_pattern() {
+    printf("Test: pattern fill for every size and via SudokuGenerationConfig... ");
+    
+    for(int k = 2; k <= 10; k++) {
+        SudokuBoard *board = sudoku_board_create_size(k);
+        SudokuBoard *other = sudoku_board_create_size(k);
+        CHECK(fillPattern(board) && fillPattern(other));
+        CHECK(sudoku_validate_board(board) == true);
+        CHECK(sudoku_board_get_clues(board) == board->total_cells);
+        CHECK(k == 2 || !sudoku_board_equals(board, other));
+        sudoku_board_destroy(other);
+        sudoku_board_destroy(board);
+    }
+    
+    SudokuGenerationConfig config = { .fill_method = SUDOKU_FILL_PATTERN };
+    SudokuGenerationStats stats;
+    SudokuBoard *nine = sudoku_board_create();
+    for(int i = 0; i < 5; i++) {
+        CHECK(sudoku_generate_ex(nine, &config, &stats) == true);
+        CHECK(stats.total_attempts == 1 && stats.fill_nodes == 0);
+        CHECK(countSolutionsExact(nine, 2) == 1);
+    }
+    
+    sudoku_board_destroy(nine);
+    printf("✅ PASSED\n");
+}
+
 int main(void) {
     // Seed random number generator for shuffle_numbers
     srand(time(NULL));
@@ -286,6 +396,9 @@ int main(void) {
     test_backtracking_already_complete();
     test_backtracking_impossible();
     test_backtracking_memory_management();
+    test_backtracking_node_budget();
+    test_fill_restarts();
+    test_fill_pattern();
     
     printf("\n");
     printf("════════════════════════════════════════════════════════════\n");
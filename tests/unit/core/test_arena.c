@@ -0,0 +1,259 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "sudoku/core/board.h"
+#include "sudoku/core/types.h"
+#include "sudoku/core/validation.h"
+#include "sudoku/core/generator.h"
+#include "sudoku/core/arena.h"
+#include "sudoku/algorithms/network.h"
+
+/* ================================================================
+                   FUNCIONES AUXILIARES DE TEST
+   ================================================================ */
+
+typedef struct {
+    int passed;
+    int failed;
+    int total;
+} TestResults;
+
+TestResults results = {0, 0, 0};
+
+#define TEST_ASSERT(condition, message) do { \
+    results.total++; \
+    if(condition) { \
+        printf("  [PASS] %s\n", message); \
+        results.passed++; \
+    } else { \
+        printf("  [FAIL] %s\n", message); \
+        results.failed++; \
+    } \
+} while(0)
+
+/* Puzzle clasico con solucion unica (30 pistas) */
+static const int SEED_PUZZLE[9][9] = {
+    {5,3,0, 0,7,0, 0,0,0},
+    {6,0,0, 1,9,5, 0,0,0},
+    {0,9,8, 0,0,0, 0,6,0},
+    {8,0,0, 0,6,0, 0,0,3},
+    {4,0,0, 8,0,3, 0,0,1},
+    {7,0,0, 0,2,0, 0,0,6},
+    {0,6,0, 0,0,0, 2,8,0},
+    {0,0,0, 4,1,9, 0,0,5},
+    {0,0,0, 0,8,0, 0,7,9}
+};
+
+/* ================================================================
+                        TESTS DE arena.h
+   ================================================================ */
+
+/**
+ * @brief Test 1: bump allocation, marks and coalescing reset
+ */
+void test_arena_basics(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 1: sudoku_arena_alloc() / mark / release / reset\n");
+    printf("===============================================================\n");
+
+    SudokuArena *arena = sudoku_arena_create(1024);
+    TEST_ASSERT(arena != NULL, "Arena created");
+    if(arena == NULL) return;
+
+    bool aligned = true;
+    for(int i = 1; i < 20; i++) {
+        void *p = sudoku_arena_alloc(arena, (size_t)i);
+        aligned = aligned && p != NULL &&
+                  ((uintptr_t)p % _Alignof(max_align_t)) == 0;
+    }
+    TEST_ASSERT(aligned, "Every allocation is max_align_t aligned");
+
+    SudokuArenaMark mark = sudoku_arena_mark(arena);
+    size_t used_before = sudoku_arena_used(arena);
+    sudoku_arena_alloc(arena, 4096);   /* fuerza un bloque nuevo */
+    TEST_ASSERT(sudoku_arena_system_allocs(arena) == 2, "Arena grew into a second block");
+    sudoku_arena_release(arena, mark);
+    TEST_ASSERT(sudoku_arena_used(arena) == used_before, "Release rewinds to the mark");
+
+    size_t capacity = sudoku_arena_capacity(arena);
+    sudoku_arena_reset(arena);
+    TEST_ASSERT(sudoku_arena_used(arena) == 0, "Reset empties the arena");
+    TEST_ASSERT(sudoku_arena_capacity(arena) == capacity, "Reset keeps the capacity");
+
+    size_t allocs = sudoku_arena_system_allocs(arena);
+    void *big = sudoku_arena_alloc(arena, 4096);
+    TEST_ASSERT(big != NULL && sudoku_arena_system_allocs(arena) == allocs,
+                "Coalesced block serves the large request without malloc");
+
+    sudoku_arena_destroy(arena);
+    sudoku_arena_destroy(NULL);
+    TEST_ASSERT(true, "Destroy (and NULL destroy) completed");
+}
+
+/**
+ * @brief Test 2: boards created inside an arena
+ */
+void test_arena_boards(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 2: sudoku_board_create_in_arena()\n");
+    printf("===============================================================\n");
+
+    SudokuArena *arena = sudoku_arena_create(0);
+    SudokuBoard *board = sudoku_board_create_in_arena(arena, 3);
+    TEST_ASSERT(board != NULL && board->arena_owned, "9x9 board created in arena");
+    if(board == NULL) {
+        sudoku_arena_destroy(arena);
+        return;
+    }
+
+    for(int i = 0; i < 9; i++) {
+        for(int j = 0; j < 9; j++) {
+            sudoku_board_set_cell(board, i, j, SEED_PUZZLE[i][j]);
+        }
+    }
+    sudoku_board_update_stats(board);
+
+    TEST_ASSERT(board->clues == 30 && countSolutionsExact(board, 2) == 1,
+                "Arena board behaves like a heap board");
+
+    bool contiguous = true;
+    for(int i = 0; i < 9; i++) {
+        contiguous = contiguous && board->cells[i] == board->cells[0] + i * 9;
+    }
+    TEST_ASSERT(contiguous, "Rows are contiguous");
+
+    sudoku_board_destroy(board);   /* no-op: memoria del arena */
+    TEST_ASSERT(sudoku_board_get_cell(board, 0, 0) == 5,
+                "sudoku_board_destroy() leaves arena boards alone");
+
+    SudokuBoard *heap = sudoku_board_create_size(4);
+    TEST_ASSERT(heap != NULL && !heap->arena_owned &&
+                heap->cells[15] == heap->cells[0] + 15 * 16,
+                "Heap boards use the same contiguous layout");
+    sudoku_board_destroy(heap);
+
+    TEST_ASSERT(sudoku_board_create_in_arena(NULL, 3) == NULL, "NULL arena rejected");
+    TEST_ASSERT(sudoku_board_create_in_arena(arena, 1) == NULL, "Invalid size rejected");
+
+    sudoku_arena_destroy(arena);
+}
+
+/**
+ * @brief Test 3: constraint networks (heap and arena)
+ */
+void test_networks(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 3: constraint_network_create() / _in_arena()\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *board = sudoku_board_create();
+    for(int i = 0; i < 9; i++) {
+        for(int j = 0; j < 9; j++) {
+            sudoku_board_set_cell(board, i, j, SEED_PUZZLE[i][j]);
+        }
+    }
+
+    ConstraintNetwork *net = constraint_network_create(board);
+    TEST_ASSERT(net != NULL, "Heap network created");
+    if(net != NULL) {
+        int count = 0;
+        const SudokuPosition *nb = constraint_network_get_neighbors(net, 4, 4, &count);
+        TEST_ASSERT(count == 20 && nb != NULL, "Each 9x9 cell has 20 neighbours");
+        TEST_ASSERT(constraint_network_domain_size(net, 0, 0) == 1,
+                    "Given cell has a singleton domain");
+        /* (0,2): fila {5,3,7}, columna {8}, caja {5,3,6,9,8} -> {1,2,4} */
+        TEST_ASSERT(constraint_network_domain_size(net, 0, 2) == 3 &&
+                    constraint_network_has_value(net, 0, 2, 1) &&
+                    constraint_network_has_value(net, 0, 2, 2) &&
+                    constraint_network_has_value(net, 0, 2, 4),
+                    "Empty cell domain excludes neighbour values");
+        constraint_network_destroy(net);
+    }
+
+    SudokuArena *arena = sudoku_arena_create(0);
+    SudokuBoard *big = sudoku_board_create_in_arena(arena, 5);
+    ConstraintNetwork *arena_net = constraint_network_create_in_arena(arena, big);
+    int count = 0;
+    if(arena_net != NULL) {
+        constraint_network_get_neighbors(arena_net, 24, 24, &count);
+    }
+    TEST_ASSERT(arena_net != NULL && count == 2 * 24 + 16,
+                "25x25 arena network has 64 neighbours per cell");
+    TEST_ASSERT(arena_net != NULL &&
+                constraint_network_total_possibilities(arena_net) == 625 * 25,
+                "Empty 25x25 board: every domain is full");
+    constraint_network_destroy(arena_net);   /* no-op */
+
+    SudokuBoard *huge = sudoku_board_create_in_arena(arena, 6);
+    TEST_ASSERT(constraint_network_create(huge) == NULL, "36x36 board rejected");
+
+    sudoku_arena_destroy(arena);
+    sudoku_board_destroy(board);
+}
+
+/**
+ * @brief Test 4: steady-state batch generation does not touch malloc
+ */
+void test_steady_state_generation(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 4: Batch generation with a caller arena\n");
+    printf("===============================================================\n");
+
+    SudokuArena *arena = sudoku_arena_create(0);
+    SudokuGenerationConfig config = { .arena = arena };
+
+    /* Calentamiento: el arena alcanza su tamano de trabajo */
+    bool all_ok = true;
+    for(int i = 0; i < 3; i++) {
+        SudokuBoard *board = sudoku_board_create_in_arena(arena, 3);
+        all_ok = all_ok && sudoku_generate_ex(board, &config, NULL);
+        sudoku_arena_reset(arena);
+    }
+
+    size_t allocs = sudoku_arena_system_allocs(arena);
+    for(int i = 0; i < 20; i++) {
+        SudokuBoard *board = sudoku_board_create_in_arena(arena, 3);
+        all_ok = all_ok && board != NULL && sudoku_generate_ex(board, &config, NULL);
+        all_ok = all_ok && countSolutionsExact(board, 2) == 1;
+        sudoku_arena_reset(arena);
+    }
+
+    TEST_ASSERT(all_ok, "20 unique puzzles generated inside the arena");
+    TEST_ASSERT(sudoku_arena_system_allocs(arena) == allocs,
+                "No new arena blocks after warm-up");
+
+    sudoku_arena_destroy(arena);
+}
+
+int main(void) {
+    printf("===============================================================\n");
+    printf("       ARENA MODULE TEST\n");
+    printf("===============================================================\n");
+
+    srand(12345);
+
+    test_arena_basics();
+    test_arena_boards();
+    test_networks();
+    test_steady_state_generation();
+
+    sudoku_arena_thread_cleanup();
+
+    printf("\n===============================================================\n");
+    printf("                    TEST SUMMARY\n");
+    printf("===============================================================\n");
+    printf("  Total tests:  %d\n", results.total);
+    printf("  Passed:       %d\n", results.passed);
+    printf("  Failed:       %d\n", results.failed);
+
+    if(results.failed == 0) {
+        printf("\n  *** ALL TESTS PASSED ***\n");
+    } else {
+        printf("\n  *** SOME TESTS FAILED ***\n");
+    }
+    printf("===============================================================\n");
+
+    return results.failed > 0 ? 1 : 0;
+}
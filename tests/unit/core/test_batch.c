@@ -0,0 +1,203 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "sudoku/core/board.h"
+#include "sudoku/core/types.h"
+#include "sudoku/core/generator.h"
+#include "sudoku/core/validation.h"
+#include "sudoku/core/grader.h"
+#include "sudoku/core/batch.h"
+#include "internal/board_internal.h"
+
+/* ================================================================
+                   FUNCIONES AUXILIARES DE TEST
+   ================================================================ */
+
+typedef struct {
+    int passed;
+    int failed;
+    int total;
+} TestResults;
+
+TestResults results = {0, 0, 0};
+
+#define TEST_ASSERT(condition, message) do { \
+    results.total++; \
+    if(condition) { \
+        printf("  [PASS] %s\n", message); \
+        results.passed++; \
+    } else { \
+        printf("  [FAIL] %s\n", message); \
+        results.failed++; \
+    } \
+} while(0)
+
+#define PACK_SIZE 40
+
+/* La solución respeta todas las pistas del puzzle original */
+static bool keeps_clues(const SudokuBoard *puzzle, const SudokuBoard *solved) {
+    int n = puzzle->board_size;
+    for (int r = 0; r < n; r++) {
+        for (int c = 0; c < n; c++) {
+            int v = puzzle->cells[r][c];
+            if (v != 0 && solved->cells[r][c] != v) return false;
+            if (solved->cells[r][c] == 0) return false;
+        }
+    }
+    return true;
+}
+
+/* ================================================================
+                        TESTS DE batch.h
+   ================================================================ */
+
+/**
+ * @brief Test 1: a pack of generated 9x9 puzzles
+ */
+void test_generated_pack(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 1: Verify and solve a pack of %d generated puzzles\n", PACK_SIZE);
+    printf("===============================================================\n");
+
+    SudokuBoard *pack[PACK_SIZE];
+    SudokuBoard *puzzles[PACK_SIZE];
+    for (int i = 0; i < PACK_SIZE; i++) {
+        pack[i] = sudoku_board_create();
+        sudoku_generate(pack[i], NULL);
+        puzzles[i] = sudoku_board_clone(pack[i]);
+    }
+
+    int solutions[PACK_SIZE];
+    SudokuBatchStats stats;
+    bool ok = sudoku_batch_count_solutions((const SudokuBoard *const *)pack, PACK_SIZE, 2,
+                                           solutions, &stats);
+    bool all_unique = ok;
+    for (int i = 0; i < PACK_SIZE; i++) {
+        all_unique = all_unique && solutions[i] == 1;
+    }
+    TEST_ASSERT(all_unique, "Every generated puzzle reported unique");
+    TEST_ASSERT(stats.boards == PACK_SIZE && stats.batches == 3 &&
+                stats.by_propagation + stats.by_search == PACK_SIZE,
+                "40 puzzles: 3 lane batches, every board accounted for");
+    TEST_ASSERT(stats.by_propagation > 0, "Some puzzles decided by propagation alone");
+    printf("  propagation: %d, search: %d\n", stats.by_propagation, stats.by_search);
+
+    ok = sudoku_batch_solve(pack, PACK_SIZE, solutions, NULL);
+    bool solved = ok;
+    for (int i = 0; i < PACK_SIZE; i++) {
+        solved = solved && solutions[i] == 1 && sudoku_validate_board(pack[i]) &&
+                 keeps_clues(puzzles[i], pack[i]);
+    }
+    TEST_ASSERT(solved, "Every puzzle filled with a valid grid keeping its clues");
+
+    for (int i = 0; i < PACK_SIZE; i++) {
+        sudoku_board_destroy(pack[i]);
+        sudoku_board_destroy(puzzles[i]);
+    }
+}
+
+/**
+ * @brief Test 2: same answers as the grader on awkward boards
+ */
+void test_matches_grader(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 2: Mixed geometries, contradictions, multiple solutions\n");
+    printf("===============================================================\n");
+
+    enum { COUNT = 8 };
+    SudokuBoard *boards[COUNT];
+
+    boards[0] = sudoku_board_create();                 /* único */
+    sudoku_generate(boards[0], NULL);
+    boards[1] = sudoku_board_clone(boards[0]);          /* pistas en conflicto */
+    for (int c = 0; c < 9; c++) {
+        if (boards[1]->cells[0][c] != 0) {
+            boards[1]->cells[0][(c + 1) % 9] = boards[1]->cells[0][c];
+            break;
+        }
+    }
+    boards[2] = sudoku_board_create();                 /* casi vacío: múltiples */
+    boards[2]->cells[0][0] = 5;
+    boards[3] = sudoku_board_create_size(2);           /* 4x4 */
+    sudoku_generate(boards[3], NULL);
+    boards[4] = sudoku_board_create_size(4);           /* 16x16 patrón con huecos */
+    fillPattern(boards[4]);
+    for (int i = 0; i < 40; i++) sudoku_board_set_cell(boards[4], (i * 7) % 16, (i * 5) % 16, 0);
+    boards[5] = sudoku_board_create_size(5);           /* 25x25: camino escalar */
+    fillPattern(boards[5]);
+    sudoku_board_set_cell(boards[5], 3, 4, 0);
+    sudoku_board_set_cell(boards[5], 20, 11, 0);
+    boards[6] = sudoku_board_clone(boards[0]);          /* valor fuera de rango */
+    boards[6]->cells[8][8] = 10;
+    boards[7] = sudoku_board_create();                 /* completo y válido */
+    fillPattern(boards[7]);
+
+    int solutions[COUNT];
+    SudokuBatchStats stats;
+    bool ok = sudoku_batch_count_solutions((const SudokuBoard *const *)boards, COUNT, 2,
+                                           solutions, &stats);
+    TEST_ASSERT(ok, "Batch accepted");
+
+    bool same = true;
+    for (int i = 0; i < COUNT; i++) {
+        if (i == 5 || i == 6) continue;   /* fuera del grader / valor inválido */
+        SudokuGradeResult grade;
+        same = same && sudoku_grade_puzzle(boards[i], &grade) && grade.solutions == solutions[i];
+    }
+    TEST_ASSERT(same, "Solution counts match sudoku_grade_puzzle()");
+    TEST_ASSERT(solutions[0] == 1 && solutions[1] == 0 && solutions[2] == 2 &&
+                solutions[3] == 1 && solutions[5] == 1 && solutions[6] == 0 &&
+                solutions[7] == 1,
+                "Expected counts: unique, conflict, many, 4x4, 25x25, out of range, full");
+    TEST_ASSERT(stats.boards == COUNT && stats.batches >= 4,
+                "Geometry changes split the lanes into several batches");
+
+    int limited[COUNT];
+    sudoku_batch_count_solutions((const SudokuBoard *const *)boards, COUNT, 1, limited, NULL);
+    TEST_ASSERT(limited[2] == 1, "limit caps the count");
+
+    SudokuBoard *before = sudoku_board_clone(boards[2]);
+    sudoku_batch_solve(boards, COUNT, solutions, NULL);
+    TEST_ASSERT(boards[2]->cells[0][0] == 5 && boards[2]->cells[0][1] == before->cells[0][1],
+                "Boards without a unique solution left untouched");
+    TEST_ASSERT(sudoku_validate_board(boards[5]) && boards[5]->cells[3][4] != 0,
+                "25x25 solved through the scalar path");
+    sudoku_board_destroy(before);
+
+    TEST_ASSERT(!sudoku_batch_count_solutions(NULL, 1, 2, solutions, NULL) &&
+                !sudoku_batch_count_solutions((const SudokuBoard *const *)boards, 1, 0,
+                                              solutions, NULL),
+                "Invalid arguments rejected");
+
+    for (int i = 0; i < COUNT; i++) {
+        sudoku_board_destroy(boards[i]);
+    }
+}
+
+int main(void) {
+    printf("===============================================================\n");
+    printf("       BATCH SOLVER TEST\n");
+    printf("===============================================================\n");
+
+    srand(777);
+    sudoku_random_seed(777);   // Rejillas de fillPattern() reproducibles
+
+    test_generated_pack();
+    test_matches_grader();
+
+    printf("\n===============================================================\n");
+    printf("                    TEST SUMMARY\n");
+    printf("===============================================================\n");
+    printf("  Total tests:  %d\n", results.total);
+    printf("  Passed:       %d\n", results.passed);
+    printf("  Failed:       %d\n", results.failed);
+
+    if(results.failed == 0) {
+        printf("\n  *** ALL TESTS PASSED ***\n");
+    } else {
+        printf("\n  *** SOME TESTS FAILED ***\n");
+    }
+    printf("===============================================================\n");
+
+    return results.failed > 0 ? 1 : 0;
+}
@@ -219,6 +219,150 @@ void test_subgrid_fill(void) {
     sudoku_board_destroy(board);
 }
 
+/**
+ * @brief Test 6: clone, copy_into y snapshot/restore
+ */
+void test_board_copy(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 6: Clone / Copy Into / Snapshot / Restore\n");
+    printf("===============================================================\n");
+    
+    SudokuBoard *board = sudoku_board_create();
+    if (board == NULL) {
+        printf("  [FAIL] Could not create board\n");
+        return;
+    }
+    sudoku_board_set_cell(board, 0, 0, 5);
+    sudoku_board_set_cell(board, 4, 4, 7);
+    sudoku_board_set_cell(board, 8, 8, 9);
+    sudoku_board_update_stats(board);
+    
+    /* Clone: copia independiente */
+    SudokuBoard *clone = sudoku_board_clone(board);
+    TEST_ASSERT(clone != NULL && clone != board, "Clone created");
+    TEST_ASSERT(clone != NULL && sudoku_board_get_cell(clone, 4, 4) == 7 &&
+                sudoku_board_get_clues(clone) == 3,
+                "Clone has same cells and stats");
+    if (clone != NULL) {
+        sudoku_board_set_cell(clone, 4, 4, 1);
+    }
+    TEST_ASSERT(sudoku_board_get_cell(board, 4, 4) == 7, "Original unaffected by clone edits");
+    
+    /* Copy into */
+    SudokuBoard *target = sudoku_board_create();
+    SudokuBoard *other_size = sudoku_board_create_size(2);
+    TEST_ASSERT(sudoku_board_copy_into(target, board) &&
+                sudoku_board_get_cell(target, 8, 8) == 9 &&
+                sudoku_board_get_empty(target) == 78,
+                "copy_into copies cells and stats");
+    TEST_ASSERT(!sudoku_board_copy_into(other_size, board), "copy_into rejects other geometry");
+    
+    /* Snapshot / restore */
+    int saved[81 + 2];
+    TEST_ASSERT(sudoku_board_snapshot_size(board) == sizeof(saved), "Snapshot size = (81 + 2) ints");
+    sudoku_board_snapshot(board, saved);
+    sudoku_board_init(board);
+    sudoku_board_restore(board, saved);
+    TEST_ASSERT(sudoku_board_get_cell(board, 0, 0) == 5 &&
+                sudoku_board_get_clues(board) == 3,
+                "Restore brings back cells and stats");
+    
+    sudoku_board_destroy(clone);
+    sudoku_board_destroy(target);
+    sudoku_board_destroy(other_size);
+    sudoku_board_destroy(board);
+}
+
+void test_board_hash(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 7: Zobrist hash and sudoku_board_equals()\n");
+    printf("===============================================================\n");
+    
+    SudokuBoard *a = sudoku_board_create();
+    SudokuBoard *b = sudoku_board_create();
+    SudokuBoard *small = sudoku_board_create_size(2);
+    uint64_t empty_hash = sudoku_board_get_hash(a);
+    
+    TEST_ASSERT(sudoku_board_get_hash(b) == empty_hash, "Empty boards share a hash");
+    TEST_ASSERT(sudoku_board_get_hash(small) != empty_hash, "Geometry is part of the hash");
+    TEST_ASSERT(sudoku_board_equals(a, b), "Empty boards are equal");
+    TEST_ASSERT(!sudoku_board_equals(a, small), "Different sizes are not equal");
+    
+    /* Actualización incremental: poner y quitar vuelve al mismo hash */
+    sudoku_board_set_cell(a, 0, 0, 5);
+    uint64_t one = sudoku_board_get_hash(a);
+    TEST_ASSERT(one != empty_hash, "Setting a cell changes the hash");
+    TEST_ASSERT(!sudoku_board_equals(a, b), "Boards differing in one cell are not equal");
+    sudoku_board_set_cell(a, 0, 0, 0);
+    TEST_ASSERT(sudoku_board_get_hash(a) == empty_hash, "Clearing it restores the hash");
+    
+    /* El orden de escritura no importa; sobrescribir tampoco */
+    sudoku_board_set_cell(a, 2, 3, 4);
+    sudoku_board_set_cell(a, 8, 8, 9);
+    sudoku_board_set_cell(b, 8, 8, 1);
+    sudoku_board_set_cell(b, 8, 8, 9);
+    sudoku_board_set_cell(b, 2, 3, 4);
+    TEST_ASSERT(sudoku_board_get_hash(a) == sudoku_board_get_hash(b),
+                "Same cells in any write order give the same hash");
+    TEST_ASSERT(sudoku_board_equals(a, b), "...and the boards are equal");
+    
+    /* Mismo valor en otra celda, u otro valor en la misma celda */
+    sudoku_board_set_cell(b, 2, 3, 0);
+    sudoku_board_set_cell(b, 3, 2, 4);
+    TEST_ASSERT(sudoku_board_get_hash(a) != sudoku_board_get_hash(b),
+                "Moving a digit changes the hash");
+    
+    /* El hash incremental coincide con el recalculado */
+    uint64_t incremental = sudoku_board_get_hash(b);
+    sudoku_board_update_stats(b);
+    TEST_ASSERT(sudoku_board_get_hash(b) == incremental, "update_stats recomputes the same hash");
+    
+    /* Escrituras directas: update_stats resincroniza */
+    a->cells[5][5] = 7;
+    sudoku_board_update_stats(a);
+    SudokuBoard *c = sudoku_board_create();
+    sudoku_board_set_cell(c, 2, 3, 4);
+    sudoku_board_set_cell(c, 8, 8, 9);
+    sudoku_board_set_cell(c, 5, 5, 7);
+    TEST_ASSERT(sudoku_board_get_hash(a) == sudoku_board_get_hash(c),
+                "Direct writes resynced by update_stats");
+    
+    /* Copias, snapshot y init */
+    SudokuBoard *clone = sudoku_board_clone(a);
+    TEST_ASSERT(clone != NULL && sudoku_board_get_hash(clone) == sudoku_board_get_hash(a) &&
+                sudoku_board_equals(clone, a),
+                "Clone keeps the hash");
+    int saved[81 + 2];
+    sudoku_board_snapshot(a, saved);
+    uint64_t before = sudoku_board_get_hash(a);
+    sudoku_board_init(a);
+    TEST_ASSERT(sudoku_board_get_hash(a) == empty_hash, "Init resets the hash");
+    sudoku_board_restore(a, saved);
+    TEST_ASSERT(sudoku_board_get_hash(a) == before, "Restore brings back the hash");
+    
+    /* Geometría experimental sin tabla de claves */
+    SudokuBoard *big = sudoku_board_create_size(6);
+    SudokuBoard *big2 = sudoku_board_create_size(6);
+    sudoku_board_set_cell(big, 35, 35, 36);
+    sudoku_board_set_cell(big2, 35, 35, 36);
+    uint64_t big_hash = sudoku_board_get_hash(big);
+    sudoku_board_update_stats(big);
+    TEST_ASSERT(big != NULL && sudoku_board_get_hash(big) == big_hash &&
+                sudoku_board_equals(big, big2),
+                "36x36 boards hash without a key table");
+    
+    TEST_ASSERT(sudoku_board_equals(NULL, NULL) && !sudoku_board_equals(a, NULL),
+                "NULL handling");
+    
+    sudoku_board_destroy(big2);
+    sudoku_board_destroy(big);
+    sudoku_board_destroy(clone);
+    sudoku_board_destroy(c);
+    sudoku_board_destroy(small);
+    sudoku_board_destroy(b);
+    sudoku_board_destroy(a);
+}
+
 /* ================================================================
                     MAIN - EJECUTOR DE TESTS
    ================================================================ */
@@ -234,6 +378,8 @@ int main(void) {
     test_subgrid_create();
     test_subgrid_get_position();
     test_subgrid_fill();
+    test_board_copy();
+    test_board_hash();
     
     /* Resumen final */
     printf("\n===============================================================\n");
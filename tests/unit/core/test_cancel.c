@@ -0,0 +1,229 @@
+#define _POSIX_C_SOURCE 200809L  /* nanosleep() */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <limits.h>
+#include <pthread.h>
+#include <time.h>
+#include "sudoku/core/board.h"
+#include "sudoku/core/types.h"
+#include "sudoku/core/generator.h"
+#include "sudoku/core/validation.h"
+#include "sudoku/core/cancel.h"
+
+/* ================================================================
+                   FUNCIONES AUXILIARES DE TEST
+   ================================================================ */
+
+typedef struct {
+    int passed;
+    int failed;
+    int total;
+} TestResults;
+
+TestResults results = {0, 0, 0};
+
+#define TEST_ASSERT(condition, message) do { \
+    results.total++; \
+    if(condition) { \
+        printf("  [PASS] %s\n", message); \
+        results.passed++; \
+    } else { \
+        printf("  [FAIL] %s\n", message); \
+        results.failed++; \
+    } \
+} while(0)
+
+static double elapsed_ms(uint64_t start) {
+    return (sudoku_clock_ns() - start) / 1e6;
+}
+
+/* ================================================================
+                        TESTS DE cancel.h
+   ================================================================ */
+
+/**
+ * @brief Test 1: token state and sudoku_interrupt_check()
+ */
+void test_token_and_check(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 1: Tokens, deadlines and sudoku_interrupt_check()\n");
+    printf("===============================================================\n");
+
+    SudokuCancelToken *token = sudoku_cancel_token_create();
+    TEST_ASSERT(token != NULL && !sudoku_cancel_token_is_cancelled(token),
+                "New token is not cancelled");
+
+    SudokuInterrupt interrupt = { token, 0 };
+    TEST_ASSERT(sudoku_interrupt_check(&interrupt) == SUDOKU_STATUS_OK &&
+                sudoku_interrupt_check(NULL) == SUDOKU_STATUS_OK,
+                "Nothing set: OK");
+
+    sudoku_cancel_token_cancel(token);
+    TEST_ASSERT(sudoku_interrupt_check(&interrupt) == SUDOKU_STATUS_CANCELLED,
+                "Cancelled token reported");
+
+    sudoku_cancel_token_reset(token);
+    interrupt.deadline_ns = sudoku_clock_ns() - 1;
+    TEST_ASSERT(sudoku_interrupt_check(&interrupt) == SUDOKU_STATUS_DEADLINE_EXCEEDED,
+                "Reset token, past deadline reported");
+
+    interrupt.deadline_ns = sudoku_deadline_in_ms(60000);
+    TEST_ASSERT(sudoku_interrupt_check(&interrupt) == SUDOKU_STATUS_OK,
+                "Future deadline: OK");
+
+    TEST_ASSERT(!sudoku_cancel_token_is_cancelled(NULL), "NULL token never cancelled");
+    sudoku_cancel_token_destroy(token);
+    sudoku_cancel_token_destroy(NULL);
+}
+
+/**
+ * @brief Test 2: countSolutionsExactEx() stops at the deadline
+ */
+void test_count_deadline(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 2: countSolutionsExactEx() with a deadline\n");
+    printf("===============================================================\n");
+
+    /* Tablero vacío: contar todas las soluciones no termina nunca */
+    SudokuBoard *board = sudoku_board_create();
+    SudokuInterrupt interrupt = { NULL, sudoku_deadline_in_ms(50) };
+    SudokuStatus status = SUDOKU_STATUS_OK;
+
+    uint64_t start = sudoku_clock_ns();
+    countSolutionsExactEx(board, INT_MAX, &interrupt, &status);
+    double ms = elapsed_ms(start);
+
+    TEST_ASSERT(status == SUDOKU_STATUS_DEADLINE_EXCEEDED, "Status is DEADLINE_EXCEEDED");
+    TEST_ASSERT(ms < 1000.0, "Returned shortly after the 50 ms deadline");
+    sudoku_board_update_stats(board);
+    TEST_ASSERT(sudoku_board_get_clues(board) == 0, "Board restored (still empty)");
+
+    /* Sin interrupción: mismo resultado que countSolutionsExact() */
+    sudoku_generate(board, NULL);
+    int plain = countSolutionsExact(board, 2);
+    int ex = countSolutionsExactEx(board, 2, NULL, &status);
+    TEST_ASSERT(plain == 1 && ex == 1 && status == SUDOKU_STATUS_OK,
+                "NULL interrupt matches countSolutionsExact()");
+
+    sudoku_board_destroy(board);
+}
+
+/* ================================================================
+                  CANCELACIÓN DESDE OTRO HILO
+   ================================================================ */
+
+static void *cancel_later(void *arg) {
+    struct timespec delay = { 0, 30 * 1000000L };
+    nanosleep(&delay, NULL);
+    sudoku_cancel_token_cancel((SudokuCancelToken*)arg);
+    return NULL;
+}
+
+/**
+ * @brief Test 3: a token cancelled by another thread stops the search
+ */
+void test_count_cancel_thread(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 3: Cancellation from another thread\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *board = sudoku_board_create_size(4);
+    SudokuCancelToken *token = sudoku_cancel_token_create();
+    SudokuInterrupt interrupt = { token, 0 };
+    SudokuStatus status = SUDOKU_STATUS_OK;
+
+    pthread_t canceller;
+    pthread_create(&canceller, NULL, cancel_later, token);
+    uint64_t start = sudoku_clock_ns();
+    countSolutionsExactEx(board, INT_MAX, &interrupt, &status);
+    double ms = elapsed_ms(start);
+    pthread_join(canceller, NULL);
+
+    TEST_ASSERT(status == SUDOKU_STATUS_CANCELLED, "Status is CANCELLED");
+    TEST_ASSERT(ms < 2000.0, "16x16 count stopped shortly after cancel");
+
+    sudoku_cancel_token_destroy(token);
+    sudoku_board_destroy(board);
+}
+
+/**
+ * @brief Test 4: interrupted generations report a distinct status
+ */
+void test_generation_status(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 4: sudoku_generate_with_status()\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *board = sudoku_board_create();
+    SudokuGenerationStats stats;
+    SudokuCancelToken *token = sudoku_cancel_token_create();
+
+    /* Sin límites alcanzados: generación normal */
+    SudokuGenerationConfig config = {
+        .cancel = token,
+        .deadline_ns = sudoku_deadline_in_ms(60000)
+    };
+    TEST_ASSERT(sudoku_generate_with_status(board, &config, &stats) == SUDOKU_STATUS_OK &&
+                stats.status == SUDOKU_STATUS_OK,
+                "Far deadline: generation OK");
+
+    sudoku_cancel_token_cancel(token);
+    TEST_ASSERT(sudoku_generate_with_status(board, &config, &stats) == SUDOKU_STATUS_CANCELLED &&
+                stats.status == SUDOKU_STATUS_CANCELLED,
+                "Cancelled token: CANCELLED");
+    TEST_ASSERT(stats.total_attempts == 0 && stats.fill_restarts == 0,
+                "Cancelled before the first fill: no attempts, no restarts");
+    TEST_ASSERT(!sudoku_generate_ex(board, &config, NULL),
+                "sudoku_generate_ex() returns false when cancelled");
+
+    config.cancel = NULL;
+    config.deadline_ns = sudoku_clock_ns();
+    TEST_ASSERT(sudoku_generate_with_status(board, &config, &stats) == SUDOKU_STATUS_DEADLINE_EXCEEDED,
+                "Expired deadline: DEADLINE_EXCEEDED");
+
+    /* 16x16 con 20 ms: se interrumpe en pleno relleno o en la Fase 3 */
+    SudokuBoard *large = sudoku_board_create_size(4);
+    config.deadline_ns = sudoku_deadline_in_ms(20);
+    uint64_t start = sudoku_clock_ns();
+    SudokuStatus status = sudoku_generate_with_status(large, &config, &stats);
+    double ms = elapsed_ms(start);
+    TEST_ASSERT(status == SUDOKU_STATUS_DEADLINE_EXCEEDED || status == SUDOKU_STATUS_OK,
+                "16x16 with 20 ms budget: OK or DEADLINE_EXCEEDED");
+    TEST_ASSERT(ms < 2000.0, "16x16 generation honoured the deadline");
+
+    sudoku_board_destroy(large);
+    sudoku_cancel_token_destroy(token);
+    sudoku_board_destroy(board);
+}
+
+int main(void) {
+    printf("===============================================================\n");
+    printf("       CANCELLATION / DEADLINE TEST\n");
+    printf("===============================================================\n");
+
+    srand(12345);
+
+    test_token_and_check();
+    test_count_deadline();
+    test_count_cancel_thread();
+    test_generation_status();
+
+    printf("\n===============================================================\n");
+    printf("                    TEST SUMMARY\n");
+    printf("===============================================================\n");
+    printf("  Total tests:  %d\n", results.total);
+    printf("  Passed:       %d\n", results.passed);
+    printf("  Failed:       %d\n", results.failed);
+
+    if(results.failed == 0) {
+        printf("\n  *** ALL TESTS PASSED ***\n");
+    } else {
+        printf("\n  *** SOME TESTS FAILED ***\n");
+    }
+    printf("===============================================================\n");
+
+    return results.failed > 0 ? 1 : 0;
+}
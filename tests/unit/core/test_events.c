@@ -0,0 +1,208 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "sudoku/core/board.h"
+#include "sudoku/core/types.h"
+#include "sudoku/core/generator.h"
+#include "sudoku/core/arena.h"
+
+/* ================================================================
+                   FUNCIONES AUXILIARES DE TEST
+   ================================================================ */
+
+typedef struct {
+    int passed;
+    int failed;
+    int total;
+} TestResults;
+
+TestResults results = {0, 0, 0};
+
+#define TEST_ASSERT(condition, message) do { \
+    results.total++; \
+    if(condition) { \
+        printf("  [PASS] %s\n", message); \
+        results.passed++; \
+    } else { \
+        printf("  [FAIL] %s\n", message); \
+        results.failed++; \
+    } \
+} while(0)
+
+/* Conteo de eventos recibidos por tipo */
+typedef struct {
+    int count[64];
+    int total;
+    uint64_t seen;      /* bit por tipo recibido */
+} EventCounter;
+
+static void counting_callback(const SudokuEventData *event, void *user_data) {
+    EventCounter *counter = (EventCounter*)user_data;
+    counter->count[event->type]++;
+    counter->total++;
+    counter->seen |= SUDOKU_EVENT_BIT(event->type);
+}
+
+static bool generate_with_mask(uint64_t mask, EventCounter *counter) {
+    SudokuBoard *board = sudoku_board_create();
+    SudokuGenerationConfig config = {
+        .callback = counting_callback,
+        .user_data = counter,
+        .event_mask = mask
+    };
+    bool ok = sudoku_generate_ex(board, &config, NULL);
+    sudoku_board_destroy(board);
+    return ok;
+}
+
+/* ================================================================
+                        TESTS DE event_mask
+   ================================================================ */
+
+/**
+ * @brief Test 1: mask 0 keeps the historical "every event" behaviour
+ */
+void test_default_mask(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 1: event_mask = 0 delivers every event\n");
+    printf("===============================================================\n");
+
+    EventCounter counter = {{0}, 0, 0};
+    TEST_ASSERT(generate_with_mask(0, &counter), "Generation succeeded");
+    TEST_ASSERT(counter.count[SUDOKU_EVENT_PHASE1_CELL_SELECTED] > 0,
+                "Phase 1 cell events delivered");
+    TEST_ASSERT(counter.count[SUDOKU_EVENT_PHASE3_CELL_KEPT] > 0,
+                "Phase 3 cell events delivered");
+    TEST_ASSERT(counter.count[SUDOKU_EVENT_GENERATION_COMPLETE] == 1,
+                "Lifecycle events delivered");
+}
+
+/**
+ * @brief Test 2: only subscribed types reach the callback
+ */
+void test_phase_complete_only(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 2: Subscription to PHASE*_COMPLETE only\n");
+    printf("===============================================================\n");
+
+    uint64_t mask = SUDOKU_EVENT_BIT(SUDOKU_EVENT_PHASE1_COMPLETE) |
+                    SUDOKU_EVENT_BIT(SUDOKU_EVENT_PHASE2_COMPLETE) |
+                    SUDOKU_EVENT_BIT(SUDOKU_EVENT_PHASE3_COMPLETE);
+
+    EventCounter counter = {{0}, 0, 0};
+    TEST_ASSERT(generate_with_mask(mask, &counter), "Generation succeeded");
+    TEST_ASSERT((counter.seen & ~mask) == 0, "No unsubscribed event delivered");
+    TEST_ASSERT(counter.count[SUDOKU_EVENT_PHASE1_COMPLETE] == 1 &&
+                counter.count[SUDOKU_EVENT_PHASE3_COMPLETE] >= 1,
+                "Phase 1 and Phase 3 completions delivered");
+}
+
+/**
+ * @brief Test 3: SUDOKU_EVENT_MASK_PHASES drops every per-cell event
+ */
+void test_phases_mask(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 3: SUDOKU_EVENT_MASK_PHASES\n");
+    printf("===============================================================\n");
+
+    EventCounter counter = {{0}, 0, 0};
+    TEST_ASSERT(generate_with_mask(SUDOKU_EVENT_MASK_PHASES, &counter),
+                "Generation succeeded");
+    TEST_ASSERT((counter.seen & SUDOKU_EVENT_MASK_CELLS) == 0,
+                "No per-cell events delivered");
+    TEST_ASSERT(counter.count[SUDOKU_EVENT_PHASE1_START] == 1 &&
+                counter.count[SUDOKU_EVENT_GENERATION_START] == 1,
+                "Start events still delivered");
+}
+
+/* Cada hilo genera con su propio callback (o sin ninguno) */
+#define THREAD_GENERATIONS 4
+
+typedef struct {
+    uint64_t mask;
+    bool with_callback;
+    EventCounter counter;
+    int generated;
+} ThreadJob;
+
+static void* generate_in_thread(void *arg) {
+    ThreadJob *job = arg;
+    SudokuBoard *board = sudoku_board_create();
+    SudokuGenerationConfig config = {
+        .callback = job->with_callback ? counting_callback : NULL,
+        .user_data = &job->counter,
+        .event_mask = job->mask
+    };
+    for (int i = 0; i < THREAD_GENERATIONS; i++) {
+        if (sudoku_generate_ex(board, &config, NULL)) job->generated++;
+    }
+    sudoku_board_destroy(board);
+    sudoku_arena_thread_cleanup();
+    return NULL;
+}
+
+/**
+ * @brief Test 4: concurrent generations keep their own subscriptions
+ */
+void test_threads(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 4: Concurrent generations on 3 threads\n");
+    printf("===============================================================\n");
+
+    ThreadJob jobs[3] = {
+        { .mask = 0, .with_callback = true },
+        { .mask = SUDOKU_EVENT_MASK_PHASES, .with_callback = true },
+        { .mask = 0, .with_callback = false }
+    };
+    pthread_t threads[3];
+    for (int i = 0; i < 3; i++) {
+        pthread_create(&threads[i], NULL, generate_in_thread, &jobs[i]);
+    }
+    for (int i = 0; i < 3; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    bool all_generated = true;
+    for (int i = 0; i < 3; i++) {
+        all_generated = all_generated && jobs[i].generated == THREAD_GENERATIONS;
+    }
+    TEST_ASSERT(all_generated, "Every generation succeeded");
+    TEST_ASSERT(jobs[0].counter.count[SUDOKU_EVENT_GENERATION_COMPLETE] == THREAD_GENERATIONS &&
+                jobs[1].counter.count[SUDOKU_EVENT_GENERATION_COMPLETE] == THREAD_GENERATIONS,
+                "Each callback saw exactly its own thread's generations");
+    TEST_ASSERT((jobs[1].counter.seen & SUDOKU_EVENT_MASK_CELLS) == 0 &&
+                jobs[0].counter.count[SUDOKU_EVENT_PHASE3_CELL_KEPT] > 0,
+                "Masks stay per thread");
+    TEST_ASSERT(jobs[2].counter.total == 0, "A thread without callback receives nothing");
+}
+
+int main(void) {
+    printf("===============================================================\n");
+    printf("       EVENT MASK TEST\n");
+    printf("===============================================================\n");
+
+    srand(12345);
+
+    test_default_mask();
+    test_phase_complete_only();
+    test_phases_mask();
+    test_threads();
+
+    printf("\n===============================================================\n");
+    printf("                    TEST SUMMARY\n");
+    printf("===============================================================\n");
+    printf("  Total tests:  %d\n", results.total);
+    printf("  Passed:       %d\n", results.passed);
+    printf("  Failed:       %d\n", results.failed);
+
+    if(results.failed == 0) {
+        printf("\n  *** ALL TESTS PASSED ***\n");
+    } else {
+        printf("\n  *** SOME TESTS FAILED ***\n");
+    }
+    printf("===============================================================\n");
+
+    return results.failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,199 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+#include "sudoku/core/board.h"
+#include "sudoku/core/types.h"
+#include "sudoku/core/generator.h"
+#include "sudoku/core/grader.h"
+
+/* ================================================================
+                   FUNCIONES AUXILIARES DE TEST
+   ================================================================ */
+
+typedef struct {
+    int passed;
+    int failed;
+    int total;
+} TestResults;
+
+TestResults results = {0, 0, 0};
+
+#define TEST_ASSERT(condition, message) do { \
+    results.total++; \
+    if(condition) { \
+        printf("  [PASS] %s\n", message); \
+        results.passed++; \
+    } else { \
+        printf("  [FAIL] %s\n", message); \
+        results.failed++; \
+    } \
+} while(0)
+
+/* Puzzle clasico: se resuelve solo con singles */
+static const char *EASY_PUZZLE =
+    "53..7...." "6..195..." ".98....6." "8...6...3" "4..8.3..1"
+    "7...2...6" ".6....28." "...419..5" "....8..79";
+
+/* "AI Escargot": la logica basica se estanca, requiere busqueda */
+static const char *ESCARGOT =
+    "1....7.9." ".3..2...8" "..96..5.." "..53..9.." ".1..8...2"
+    "6....4..." "3......1." ".4......7" "..7...3..";
+
+static SudokuBoard *board_from_string(const char *text) {
+    SudokuBoard *board = sudoku_board_create();
+    if(board == NULL) return NULL;
+    for(int i = 0; i < 81; i++) {
+        int v = (text[i] >= '1' && text[i] <= '9') ? text[i] - '0' : 0;
+        sudoku_board_set_cell(board, i / 9, i % 9, v);
+    }
+    sudoku_board_update_stats(board);
+    return board;
+}
+
+/* ================================================================
+                        TESTS DE grader.h
+   ================================================================ */
+
+/**
+ * @brief Test 1: singles-only puzzle is EASY and solved by logic
+ */
+void test_easy_puzzle(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 1: sudoku_grade_puzzle() - Singles Only\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *board = board_from_string(EASY_PUZZLE);
+    SudokuGradeResult grade;
+
+    TEST_ASSERT(sudoku_grade_puzzle(board, &grade), "Puzzle graded");
+    TEST_ASSERT(grade.solved_by_logic, "Solved without guessing");
+    TEST_ASSERT(grade.solutions == 1, "Unique solution reported");
+    TEST_ASSERT(grade.hardest <= SUDOKU_TECH_HIDDEN_SINGLE, "Hardest technique is a single");
+    TEST_ASSERT(grade.difficulty == SUDOKU_EASY, "Graded EASY");
+    TEST_ASSERT(grade.technique_uses[SUDOKU_TECH_NAKED_SINGLE] +
+                grade.technique_uses[SUDOKU_TECH_HIDDEN_SINGLE] == 51,
+                "One single per empty cell (51)");
+    TEST_ASSERT(sudoku_evaluate_difficulty(board) == SUDOKU_EASY,
+                "sudoku_evaluate_difficulty() agrees");
+
+    printf("  Hardest: %s | Score: %d\n",
+           sudoku_technique_to_string(grade.hardest), grade.score);
+    sudoku_board_destroy(board);
+}
+
+/**
+ * @brief Test 2: a puzzle beyond basic logic needs backtracking
+ */
+void test_expert_puzzle(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 2: sudoku_grade_puzzle() - Backtracking Required\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *board = board_from_string(ESCARGOT);
+    SudokuGradeResult grade;
+
+    TEST_ASSERT(sudoku_grade_puzzle(board, &grade), "Puzzle graded");
+    TEST_ASSERT(!grade.solved_by_logic, "Logic alone is not enough");
+    TEST_ASSERT(grade.hardest == SUDOKU_TECH_BACKTRACKING, "Hardest is backtracking");
+    TEST_ASSERT(grade.solutions == 1, "Search confirms a unique solution");
+    TEST_ASSERT(grade.difficulty == SUDOKU_EXPERT, "Graded EXPERT");
+    TEST_ASSERT(sudoku_board_get_clues(board) == 23, "Input board not modified");
+
+    printf("  Hardest: %s | Score: %d\n",
+           sudoku_technique_to_string(grade.hardest), grade.score);
+    sudoku_board_destroy(board);
+}
+
+/**
+ * @brief Test 3: invalid inputs
+ */
+void test_invalid_inputs(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 3: sudoku_grade_puzzle() - Invalid Puzzles\n");
+    printf("===============================================================\n");
+
+    SudokuGradeResult grade;
+    SudokuBoard *board = sudoku_board_create();
+
+    TEST_ASSERT(sudoku_grade_puzzle(board, &grade) && grade.solutions == 2,
+                "Empty board has multiple solutions");
+    TEST_ASSERT(grade.difficulty == SUDOKU_INVALID, "Multiple solutions -> INVALID");
+
+    sudoku_board_set_cell(board, 0, 0, 5);
+    sudoku_board_set_cell(board, 0, 8, 5);
+    sudoku_board_update_stats(board);
+    TEST_ASSERT(sudoku_grade_puzzle(board, &grade) && grade.solutions == 0,
+                "Conflicting givens have no solution");
+    TEST_ASSERT(grade.difficulty == SUDOKU_INVALID, "No solution -> INVALID");
+
+    TEST_ASSERT(!sudoku_grade_puzzle(NULL, &grade), "NULL board rejected");
+    TEST_ASSERT(!sudoku_grade_puzzle(board, NULL), "NULL result rejected");
+
+    sudoku_board_destroy(board);
+}
+
+/**
+ * @brief Test 4: generated puzzles always get a valid grade, quickly
+ */
+void test_generated_puzzles(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 4: sudoku_grade_puzzle() - Generated Puzzles\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *board = sudoku_board_create();
+    bool all_graded = true;
+    int buckets[SUDOKU_INVALID + 1] = {0};
+
+    for(int i = 0; i < 3; i++) {
+        SudokuGradeResult grade;
+        sudoku_generate(board, NULL);
+        all_graded = all_graded && sudoku_grade_puzzle(board, &grade);
+        all_graded = all_graded && grade.solutions == 1;
+        buckets[grade.difficulty]++;
+    }
+    TEST_ASSERT(all_graded, "Every generated puzzle graded with a unique solution");
+    printf("  EASY %d | MEDIUM %d | HARD %d | EXPERT %d\n",
+           buckets[SUDOKU_EASY], buckets[SUDOKU_MEDIUM],
+           buckets[SUDOKU_HARD], buckets[SUDOKU_EXPERT]);
+
+    const int reps = 1000;
+    SudokuGradeResult grade;
+    clock_t start = clock();
+    for(int i = 0; i < reps; i++) {
+        sudoku_grade_puzzle(board, &grade);
+    }
+    double us = (double)(clock() - start) * 1e6 / CLOCKS_PER_SEC / reps;
+    printf("  Average grading time: %.1f us\n", us);
+
+    sudoku_board_destroy(board);
+}
+
+int main(void) {
+    printf("===============================================================\n");
+    printf("       GRADER MODULE TEST\n");
+    printf("===============================================================\n");
+
+    srand(2024);
+
+    test_easy_puzzle();
+    test_expert_puzzle();
+    test_invalid_inputs();
+    test_generated_puzzles();
+
+    printf("\n===============================================================\n");
+    printf("                    TEST SUMMARY\n");
+    printf("===============================================================\n");
+    printf("  Total tests:  %d\n", results.total);
+    printf("  Passed:       %d\n", results.passed);
+    printf("  Failed:       %d\n", results.failed);
+
+    if(results.failed == 0) {
+        printf("\n  *** ALL TESTS PASSED ***\n");
+    } else {
+        printf("\n  *** SOME TESTS FAILED ***\n");
+    }
+    printf("===============================================================\n");
+
+    return results.failed > 0 ? 1 : 0;
+}
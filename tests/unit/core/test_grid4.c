@@ -0,0 +1,233 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "sudoku/core/board.h"
+#include "sudoku/core/generator.h"
+#include "sudoku/core/validation.h"
+#include "internal/grid4_internal.h"
+
+/* ================================================================
+                   FUNCIONES AUXILIARES DE TEST
+   ================================================================ */
+
+typedef struct {
+    int passed;
+    int failed;
+    int total;
+} TestResults;
+
+TestResults results = {0, 0, 0};
+
+#define TEST_ASSERT(condition, message) do { \
+    results.total++; \
+    if(condition) { \
+        printf("  [PASS] %s\n", message); \
+        results.passed++; \
+    } else { \
+        printf("  [FAIL] %s\n", message); \
+        results.failed++; \
+    } \
+} while(0)
+
+/* ¿Puede ir `v` en la celda i de un 4x4 plano? */
+static bool ref_safe(const int *cells, int i, int v) {
+    int r = i / 4, c = i % 4;
+    for (int j = 0; j < 4; j++) {
+        if (cells[r * 4 + j] == v || cells[j * 4 + c] == v) return false;
+    }
+    int br = r / 2 * 2, bc = c / 2 * 2;
+    for (int rr = br; rr < br + 2; rr++) {
+        for (int cc = bc; cc < bc + 2; cc++) {
+            if (cells[rr * 4 + cc] == v) return false;
+        }
+    }
+    return true;
+}
+
+/* Contador de referencia: backtracking directo, sin tabla */
+static int ref_count(int *cells, int i) {
+    while (i < 16 && cells[i] != 0) i++;
+    if (i == 16) return 1;
+    int total = 0;
+    for (int v = 1; v <= 4; v++) {
+        if (ref_safe(cells, i, v)) {
+            cells[i] = v;
+            total += ref_count(cells, i + 1);
+            cells[i] = 0;
+        }
+    }
+    return total;
+}
+
+/* ¿Las pistas dadas son coherentes entre sí? */
+static bool ref_consistent(int *cells) {
+    for (int i = 0; i < 16; i++) {
+        int v = cells[i];
+        if (v == 0) continue;
+        cells[i] = 0;
+        bool ok = ref_safe(cells, i, v);
+        cells[i] = v;
+        if (!ok) return false;
+    }
+    return true;
+}
+
+static void load(SudokuBoard *board, const int *cells) {
+    for (int i = 0; i < 16; i++) {
+        board->cells[i / 4][i % 4] = cells[i];
+    }
+    sudoku_board_update_stats(board);
+}
+
+/* ================================================================
+                         TESTS
+   ================================================================ */
+
+void test_table_contents(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 1: The table holds the 288 distinct valid grids\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *board = sudoku_board_create_size(2);
+    int cells[16];
+    int valid = 0, distinct = 0;
+
+    for (int g = 0; g < GRID4_COUNT; g++) {
+        grid4_unpack(g, cells);
+        load(board, cells);
+        if (sudoku_validate_board(board) && board->clues == 16) valid++;
+        bool repeated = false;
+        for (int h = 0; h < g && !repeated; h++) repeated = grid4_table[h] == grid4_table[g];
+        if (!repeated) distinct++;
+    }
+
+    int empty[16] = {0};
+    TEST_ASSERT(valid == GRID4_COUNT, "Every entry is a complete valid grid");
+    TEST_ASSERT(distinct == GRID4_COUNT, "No entry appears twice");
+    TEST_ASSERT(ref_count(empty, 0) == GRID4_COUNT, "Backtracking also finds 288 grids");
+
+    sudoku_board_destroy(board);
+}
+
+void test_counting_matches_search(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 2: Table counts equal backtracking counts\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *board = sudoku_board_create_size(2);
+    int cells[16];
+    int mismatches = 0, exact_mismatches = 0;
+
+    for (int trial = 0; trial < 2000; trial++) {
+        /* Pistas al azar (a menudo contradictorias) */
+        for (int i = 0; i < 16; i++) {
+            cells[i] = (rand() % 3 == 0) ? rand() % 4 + 1 : 0;
+        }
+        int expected = ref_consistent(cells) ? ref_count(cells, 0) : 0;
+
+        if (grid4_count_solutions(cells, 1000, NULL) != expected) mismatches++;
+
+        load(board, cells);
+        int limited = expected < 2 ? expected : 2;
+        if (countSolutionsExact(board, 2) != limited) exact_mismatches++;
+    }
+
+    int empty[16] = {0};
+    load(board, empty);
+    TEST_ASSERT(mismatches == 0, "grid4_count_solutions() agrees on 2000 random boards");
+    TEST_ASSERT(exact_mismatches == 0, "countSolutionsExact(limit 2) agrees on 4x4");
+    TEST_ASSERT(countSolutionsExact(board, 1000) == 288, "Empty 4x4 board has 288 solutions");
+
+    sudoku_board_destroy(board);
+}
+
+void test_completion(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 3: Completion respects the givens and covers the table\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *board = sudoku_board_create_size(2);
+    int empty[16] = {0};
+    int solution[16];
+    bool seen[GRID4_COUNT] = {false};
+    int different = 0;
+
+    /* Desde el tablero vacío: sorteo uniforme, deberían salir casi todos */
+    for (int draw = 0; draw < 5000; draw++) {
+        grid4_random_completion(empty, solution);
+        for (int g = 0; g < GRID4_COUNT; g++) {
+            int cells[16];
+            grid4_unpack(g, cells);
+            bool same = true;
+            for (int i = 0; i < 16 && same; i++) same = cells[i] == solution[i];
+            if (same && !seen[g]) { seen[g] = true; different++; }
+        }
+    }
+    TEST_ASSERT(different == GRID4_COUNT, "5000 draws reach all 288 grids");
+
+    /* Pistas de una solución conocida: la completación las conserva */
+    int givens[16];
+    grid4_unpack(100, givens);
+    for (int i = 0; i < 16; i += 3) givens[i] = 0;
+    bool kept = grid4_random_completion(givens, solution);
+    for (int i = 0; i < 16; i++) {
+        if (givens[i] != 0 && givens[i] != solution[i]) kept = false;
+    }
+    load(board, solution);
+    TEST_ASSERT(kept && sudoku_validate_board(board), "Completion keeps the givens and is valid");
+
+    int clash[16] = {1, 1};
+    TEST_ASSERT(!grid4_random_completion(clash, solution), "Contradictory givens have no completion");
+
+    sudoku_board_destroy(board);
+}
+
+void test_generation(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 4: 4x4 generation fills from the table\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *board = sudoku_board_create_size(2);
+    int ok = 0, restarts = 0;
+
+    for (int i = 0; i < 50; i++) {
+        SudokuGenerationStats stats;
+        if (sudoku_generate(board, &stats) && countSolutionsExact(board, 2) == 1) ok++;
+        restarts += stats.fill_restarts;
+    }
+
+    TEST_ASSERT(ok == 50, "50 4x4 puzzles with a unique solution");
+    TEST_ASSERT(restarts == 0, "The fill never restarts");
+
+    sudoku_board_destroy(board);
+}
+
+int main(void) {
+    printf("===============================================================\n");
+    printf("       4x4 GRID TABLE TEST\n");
+    printf("===============================================================\n");
+
+    srand(2046);
+    sudoku_random_seed(2046);
+
+    test_table_contents();
+    test_counting_matches_search();
+    test_completion();
+    test_generation();
+
+    printf("\n===============================================================\n");
+    printf("                    TEST SUMMARY\n");
+    printf("===============================================================\n");
+    printf("  Total tests:  %d\n", results.total);
+    printf("  Passed:       %d\n", results.passed);
+    printf("  Failed:       %d\n", results.failed);
+
+    if(results.failed == 0) {
+        printf("\n  *** ALL TESTS PASSED ***\n");
+    } else {
+        printf("\n  *** SOME TESTS FAILED ***\n");
+    }
+    printf("===============================================================\n");
+
+    return results.failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,263 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "sudoku/core/board.h"
+#include "sudoku/core/types.h"
+#include "sudoku/core/generator.h"
+#include "sudoku/core/validation.h"
+#include "internal/board_internal.h"
+#include "internal/kernels_internal.h"
+#include "internal/elimination_internal.h"
+
+/* ================================================================
+                   FUNCIONES AUXILIARES DE TEST
+   ================================================================ */
+
+typedef struct {
+    int passed;
+    int failed;
+    int total;
+} TestResults;
+
+TestResults results = {0, 0, 0};
+
+#define TEST_ASSERT(condition, message) do { \
+    results.total++; \
+    if(condition) { \
+        printf("  [PASS] %s\n", message); \
+        results.passed++; \
+    } else { \
+        printf("  [FAIL] %s\n", message); \
+        results.failed++; \
+    } \
+} while(0)
+
+static void blank_random(SudokuBoard *board, int count) {
+    int n = board->board_size;
+    for (int i = 0; i < count; i++) {
+        sudoku_board_set_cell(board, rand() % n, rand() % n, 0);
+    }
+}
+
+/* Versiones de referencia, escritas sin ninguna especialización */
+
+static bool reference_is_safe(const SudokuBoard *b, int row, int col, int num) {
+    int n = b->board_size, k = b->subgrid_size;
+    for (int x = 0; x < n; x++) {
+        if (b->cells[row][x] == num || b->cells[x][col] == num) return false;
+    }
+    for (int r = row / k * k; r < row / k * k + k; r++) {
+        for (int c = col / k * k; c < col / k * k + k; c++) {
+            if (b->cells[r][c] == num) return false;
+        }
+    }
+    return true;
+}
+
+static bool reference_validate(const SudokuBoard *b) {
+    int n = b->board_size, k = b->subgrid_size;
+    for (int r = 0; r < n; r++) {
+        for (int c = 0; c < n; c++) {
+            int v = b->cells[r][c];
+            if (v == 0) continue;
+            if (v < 0 || v > n) return false;
+            for (int r2 = 0; r2 < n; r2++) {
+                for (int c2 = 0; c2 < n; c2++) {
+                    bool peer = r2 == r || c2 == c || (r2 / k == r / k && c2 / k == c / k);
+                    if ((r2 != r || c2 != c) && peer && b->cells[r2][c2] == v) return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+static int reference_count(SudokuBoard *b, int limit) {
+    int n = b->board_size;
+    for (int r = 0; r < n; r++) {
+        for (int c = 0; c < n; c++) {
+            if (b->cells[r][c] != 0) continue;
+            int total = 0;
+            for (int v = 1; v <= n && total < limit; v++) {
+                if (reference_is_safe(b, r, c, v)) {
+                    b->cells[r][c] = v;
+                    total += reference_count(b, limit);
+                    b->cells[r][c] = 0;
+                }
+            }
+            return total;
+        }
+    }
+    return 1;
+}
+
+/* ================================================================
+                        TESTS DE kernels.c
+   ================================================================ */
+
+/**
+ * @brief Test 1: dispatcher covers exactly the shipped geometries
+ */
+void test_dispatcher(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 1: sudoku_kernels_for()\n");
+    printf("===============================================================\n");
+
+    bool covered = true;
+    for (int k = 2; k <= 5; k++) {
+        const SudokuKernels *kernels = sudoku_kernels_for(k);
+        covered = covered && kernels != NULL && kernels->subgrid_size == k;
+    }
+    TEST_ASSERT(covered, "Kernels for subgrid sizes 2, 3, 4 and 5");
+    TEST_ASSERT(sudoku_kernels_for(1) == NULL && sudoku_kernels_for(6) == NULL,
+                "Other sizes fall back to the generic code");
+}
+
+/**
+ * @brief Test 2: is_safe / find_empty / validate match the references
+ */
+void test_primitives_match(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 2: Primitives match the generic definitions\n");
+    printf("===============================================================\n");
+
+    for (int k = 2; k <= 5; k++) {
+        SudokuBoard *board = sudoku_board_create_size(k);
+        int n = board->board_size;
+        bool safe_ok = true, empty_ok = true, valid_ok = true;
+
+        for (int round = 0; round < 30; round++) {
+            fillPattern(board);
+            blank_random(board, round * n / 4);
+            /* Una de cada tres rondas: valor repetido o fuera de rango */
+            if (round % 3 == 1) sudoku_board_set_cell(board, rand() % n, rand() % n, rand() % n + 1);
+            if (round % 3 == 2) board->cells[rand() % n][rand() % n] = n + 1;   // El setter lo rechaza
+
+            for (int i = 0; i < 50; i++) {
+                SudokuPosition pos = { rand() % n, rand() % n };
+                int num = rand() % n + 1;
+                safe_ok = safe_ok && sudoku_is_safe_position(board, &pos, num) ==
+                                     reference_is_safe(board, pos.row, pos.col, num);
+            }
+
+            SudokuPosition pos;
+            bool found = sudoku_find_empty_cell(board, &pos);
+            int first = -1;
+            for (int i = 0; i < n * n && first < 0; i++) {
+                if (board->cells[i / n][i % n] == 0) first = i;
+            }
+            empty_ok = empty_ok && found == (first >= 0) &&
+                       (!found || pos.row * n + pos.col == first);
+
+            valid_ok = valid_ok && sudoku_validate_board(board) == reference_validate(board);
+        }
+
+        char message[80];
+        snprintf(message, sizeof(message), "%dx%d: is_safe matches reference", n, n);
+        TEST_ASSERT(safe_ok, message);
+        snprintf(message, sizeof(message), "%dx%d: find_empty matches reference", n, n);
+        TEST_ASSERT(empty_ok, message);
+        snprintf(message, sizeof(message), "%dx%d: validate matches reference", n, n);
+        TEST_ASSERT(valid_ok, message);
+        sudoku_board_destroy(board);
+    }
+}
+
+/**
+ * @brief Test 3: countSolutionsExact and hasAlternative
+ */
+void test_search_match(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 3: Counting and hasAlternative() match\n");
+    printf("===============================================================\n");
+
+    static const int blanks[] = { 0, 0, 12, 40, 60, 0 };  /* indexado por k */
+    static const int limits[] = { 1, 2, 7 };
+    for (int k = 2; k <= 4; k++) {
+        SudokuBoard *board = sudoku_board_create_size(k);
+        int n = board->board_size;
+        bool count_ok = true, restored = true, alt_ok = true;
+
+        for (int round = 0; round < 10; round++) {
+            fillPattern(board);
+            blank_random(board, blanks[k]);
+            SudokuBoard *before = sudoku_board_clone(board);
+
+            for (int l = 0; l < 3; l++) {
+                int fast = countSolutionsExact(board, limits[l]);
+                count_ok = count_ok && fast == reference_count(board, limits[l]);
+            }
+            for (int i = 0; i < n * n; i++) {
+                restored = restored && board->cells[i / n][i % n] == before->cells[i / n][i % n];
+            }
+
+            for (int i = 0; i < n * n; i++) {
+                SudokuPosition pos = { i / n, i % n };
+                int v = board->cells[pos.row][pos.col];
+                if (v == 0) continue;
+
+                /* Referencia: vaciar la celda y buscar otro sitio en sus unidades */
+                board->cells[pos.row][pos.col] = 0;
+                bool expected = false;
+                for (int j = 0; j < n * n && !expected; j++) {
+                    int r = j / n, c = j % n;
+                    bool peer = r == pos.row || c == pos.col ||
+                                (r / k == pos.row / k && c / k == pos.col / k);
+                    expected = j != i && peer && board->cells[r][c] == 0 &&
+                               reference_is_safe(board, r, c, v);
+                }
+                board->cells[pos.row][pos.col] = v;
+
+                alt_ok = alt_ok && hasAlternative(board, &pos, v) == expected &&
+                         board->cells[pos.row][pos.col] == v;
+            }
+            sudoku_board_destroy(before);
+        }
+
+        char message[80];
+        snprintf(message, sizeof(message), "%dx%d: countSolutionsExact matches reference", n, n);
+        TEST_ASSERT(count_ok, message);
+        snprintf(message, sizeof(message), "%dx%d: board untouched by counting", n, n);
+        TEST_ASSERT(restored, message);
+        snprintf(message, sizeof(message), "%dx%d: hasAlternative matches reference", n, n);
+        TEST_ASSERT(alt_ok, message);
+        sudoku_board_destroy(board);
+    }
+
+    /* 36×36: sin kernel, sigue funcionando el camino genérico */
+    SudokuBoard *large = sudoku_board_create_size(6);
+    fillPattern(large);
+    sudoku_board_set_cell(large, 7, 11, 0);
+    TEST_ASSERT(countSolutionsExact(large, 2) == 1 && sudoku_validate_board(large),
+                "36x36: generic path still used and correct");
+    sudoku_board_destroy(large);
+}
+
+int main(void) {
+    printf("===============================================================\n");
+    printf("       GEOMETRY KERNELS TEST\n");
+    printf("===============================================================\n");
+
+    srand(4242);
+    sudoku_random_seed(4242);   // Rejillas de fillPattern() reproducibles
+
+    test_dispatcher();
+    test_primitives_match();
+    test_search_match();
+
+    printf("\n===============================================================\n");
+    printf("                    TEST SUMMARY\n");
+    printf("===============================================================\n");
+    printf("  Total tests:  %d\n", results.total);
+    printf("  Passed:       %d\n", results.passed);
+    printf("  Failed:       %d\n", results.failed);
+
+    if(results.failed == 0) {
+        printf("\n  *** ALL TESTS PASSED ***\n");
+    } else {
+        printf("\n  *** SOME TESTS FAILED ***\n");
+    }
+    printf("===============================================================\n");
+
+    return results.failed > 0 ? 1 : 0;
+}
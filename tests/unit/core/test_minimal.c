@@ -0,0 +1,183 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "sudoku/core/board.h"
+#include "sudoku/core/types.h"
+#include "sudoku/core/generator.h"
+#include "sudoku/core/validation.h"
+#include "internal/algorithms_internal.h"
+
+/* ================================================================
+                   FUNCIONES AUXILIARES DE TEST
+   ================================================================ */
+
+typedef struct {
+    int passed;
+    int failed;
+    int total;
+} TestResults;
+
+TestResults results = {0, 0, 0};
+
+#define TEST_ASSERT(condition, message) do { \
+    results.total++; \
+    if(condition) { \
+        printf("  [PASS] %s\n", message); \
+        results.passed++; \
+    } else { \
+        printf("  [FAIL] %s\n", message); \
+        results.failed++; \
+    } \
+} while(0)
+
+#define MAX_CELLS 81
+
+/* Referencia secuencial: una sonda por pista, en orden de filas */
+static int reference_redundant(SudokuBoard *puzzle, SudokuPosition *out) {
+    int n = puzzle->board_size, found = 0;
+    for (int r = 0; r < n; r++) {
+        for (int c = 0; c < n; c++) {
+            int v = puzzle->cells[r][c];
+            if (v == 0) continue;
+            puzzle->cells[r][c] = 0;
+            if (countSolutionsExact(puzzle, 2) == 1) {
+                out[found].row = r;
+                out[found].col = c;
+                found++;
+            }
+            puzzle->cells[r][c] = v;
+        }
+    }
+    return found;
+}
+
+/* Quita pistas redundantes una a una hasta que no quede ninguna */
+static void reduce_to_minimal(SudokuBoard *puzzle) {
+    SudokuPosition redundant[MAX_CELLS];
+    while (reference_redundant(puzzle, redundant) > 0) {
+        puzzle->cells[redundant[0].row][redundant[0].col] = 0;
+    }
+    sudoku_board_update_stats(puzzle);
+}
+
+/* ================================================================
+                         TESTS
+   ================================================================ */
+
+void test_minimal_puzzle(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 1: A minimal puzzle is reported minimal\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *puzzle = sudoku_board_create();
+    sudoku_generate(puzzle, NULL);
+    reduce_to_minimal(puzzle);
+    SudokuBoard *before = sudoku_board_clone(puzzle);
+
+    TEST_ASSERT(sudoku_is_minimal(puzzle, 1), "Minimal with 1 thread");
+    TEST_ASSERT(sudoku_is_minimal(puzzle, 4), "Minimal with 4 threads");
+    TEST_ASSERT(sudoku_find_redundant_clues(puzzle, 4, NULL, 0) == 0, "No redundant clues listed");
+    TEST_ASSERT(sudoku_board_equals(puzzle, before), "Puzzle left untouched");
+
+    sudoku_board_destroy(before);
+    sudoku_board_destroy(puzzle);
+}
+
+void test_redundant_clues(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 2: Redundant clues match the sequential reference\n");
+    printf("===============================================================\n");
+
+    bool all_match = true, all_flagged = true;
+    for (int round = 0; round < 5; round++) {
+        SudokuBoard *puzzle = sudoku_board_create();
+        sudoku_generate(puzzle, NULL);
+        SudokuBoard *solved = sudoku_board_clone(puzzle);
+        sudoku_complete_backtracking(solved);
+
+        // Pistas de más: copia tres celdas de la solución
+        int added = 0;
+        for (int cell = round * 7; cell < 81 && added < 3; cell++) {
+            if (puzzle->cells[cell / 9][cell % 9] == 0) {
+                puzzle->cells[cell / 9][cell % 9] = solved->cells[cell / 9][cell % 9];
+                added++;
+            }
+        }
+        sudoku_board_update_stats(puzzle);
+
+        SudokuPosition expected[MAX_CELLS], single[MAX_CELLS], parallel[MAX_CELLS];
+        int n_expected = reference_redundant(puzzle, expected);
+        int n_single = sudoku_find_redundant_clues(puzzle, 1, single, MAX_CELLS);
+        int n_parallel = sudoku_find_redundant_clues(puzzle, 8, parallel, MAX_CELLS);
+
+        all_match = all_match && n_single == n_expected && n_parallel == n_expected;
+        for (int i = 0; all_match && i < n_expected; i++) {
+            all_match = single[i].row == expected[i].row && single[i].col == expected[i].col &&
+                        parallel[i].row == expected[i].row && parallel[i].col == expected[i].col;
+        }
+        all_flagged = all_flagged && n_expected >= 1 &&
+                      !sudoku_is_minimal(puzzle, 1) && !sudoku_is_minimal(puzzle, 8);
+
+        sudoku_board_destroy(solved);
+        sudoku_board_destroy(puzzle);
+    }
+
+    TEST_ASSERT(all_match, "Same positions, in row-major order, for 1 and 8 threads");
+    TEST_ASSERT(all_flagged, "Puzzles with added clues are not minimal");
+}
+
+void test_capacity_and_errors(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 3: Capacity, non-unique puzzles and NULL\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *puzzle = sudoku_board_create();
+    sudoku_generate(puzzle, NULL);
+    SudokuBoard *solved = sudoku_board_clone(puzzle);
+    sudoku_complete_backtracking(solved);
+
+    // El tablero resuelto: cada pista es redundante por sí sola
+    SudokuPosition first[2];
+    int count = sudoku_find_redundant_clues(solved, 4, first, 2);
+    TEST_ASSERT(count == 81, "Every clue of a solved grid is redundant");
+    TEST_ASSERT(first[0].row == 0 && first[0].col == 0 && first[1].row == 0 && first[1].col == 1,
+                "Only the first 'capacity' positions are written");
+
+    SudokuBoard *empty = sudoku_board_create();
+    TEST_ASSERT(!sudoku_is_minimal(empty, 4), "Non-unique puzzle is not minimal");
+    TEST_ASSERT(sudoku_find_redundant_clues(empty, 4, NULL, 0) == -1, "Non-unique puzzle → -1");
+    TEST_ASSERT(!sudoku_is_minimal(NULL, 4) &&
+                sudoku_find_redundant_clues(NULL, 4, NULL, 0) == -1, "NULL handling");
+
+    sudoku_board_destroy(empty);
+    sudoku_board_destroy(solved);
+    sudoku_board_destroy(puzzle);
+}
+
+int main(void) {
+    printf("===============================================================\n");
+    printf("       MINIMALITY CHECK TEST\n");
+    printf("===============================================================\n");
+
+    srand(2043);
+
+    test_minimal_puzzle();
+    test_redundant_clues();
+    test_capacity_and_errors();
+
+    printf("\n===============================================================\n");
+    printf("                    TEST SUMMARY\n");
+    printf("===============================================================\n");
+    printf("  Total tests:  %d\n", results.total);
+    printf("  Passed:       %d\n", results.passed);
+    printf("  Failed:       %d\n", results.failed);
+
+    if(results.failed == 0) {
+        printf("\n  *** ALL TESTS PASSED ***\n");
+    } else {
+        printf("\n  *** SOME TESTS FAILED ***\n");
+    }
+    printf("===============================================================\n");
+
+    return results.failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,189 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "sudoku/core/board.h"
+#include "sudoku/core/types.h"
+#include "sudoku/core/generator.h"
+#include "sudoku/core/arena.h"
+
+/* ================================================================
+                   FUNCIONES AUXILIARES DE TEST
+   ================================================================ */
+
+typedef struct {
+    int passed;
+    int failed;
+    int total;
+} TestResults;
+
+TestResults results = {0, 0, 0};
+
+#define TEST_ASSERT(condition, message) do { \
+    results.total++; \
+    if(condition) { \
+        printf("  [PASS] %s\n", message); \
+        results.passed++; \
+    } else { \
+        printf("  [FAIL] %s\n", message); \
+        results.failed++; \
+    } \
+} while(0)
+
+/* Puzzle de un ID en un tablero nuevo */
+static SudokuBoard* from_id(int subgrid_size, uint64_t id, SudokuDifficulty difficulty) {
+    SudokuBoard *board = sudoku_board_create_size(subgrid_size);
+    if (board != NULL && !sudoku_generate_from_id(board, id, difficulty, NULL)) {
+        sudoku_board_destroy(board);
+        return NULL;
+    }
+    return board;
+}
+
+typedef struct {
+    uint64_t id;
+    uint64_t hash;
+} ThreadJob;
+
+static void* generate_in_thread(void *arg) {
+    ThreadJob *job = arg;
+    SudokuBoard *board = from_id(3, job->id, SUDOKU_EASY);
+    job->hash = board != NULL ? sudoku_board_get_hash(board) : 0;
+    sudoku_board_destroy(board);
+    sudoku_arena_thread_cleanup();
+    return NULL;
+}
+
+/* ================================================================
+                         TESTS
+   ================================================================ */
+
+void test_same_id_same_puzzle(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 1: An ID always rebuilds the same puzzle\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *a = from_id(3, 12345, SUDOKU_EASY);
+    SudokuBoard *noise = sudoku_board_create();
+    sudoku_generate(noise, NULL);                   // consume the thread's stream
+    SudokuBoard *b = from_id(3, 12345, SUDOKU_EASY);
+    SudokuBoard *other = from_id(3, 12346, SUDOKU_EASY);
+
+    TEST_ASSERT(a != NULL && b != NULL && other != NULL, "Three puzzles generated");
+    TEST_ASSERT(sudoku_board_equals(a, b), "Same ID → same puzzle, whatever ran in between");
+    TEST_ASSERT(!sudoku_board_equals(a, other), "Neighbouring ID → different puzzle");
+    TEST_ASSERT(sudoku_evaluate_difficulty(a) == SUDOKU_EASY, "Requested difficulty honoured");
+
+    /* Valor fijado: si cambia, hay que subir SUDOKU_GENERATION_ID_VERSION.
+       La versión 2 solo cambió los 4x4 (tabla de grids), el 9x9 sigue igual */
+    TEST_ASSERT(SUDOKU_GENERATION_ID_VERSION == 2 && a != NULL &&
+                sudoku_board_get_hash(a) == 0xf9c4dda7fa7b4e6aULL,
+                "ID 12345 (EASY, 9x9) is the pinned puzzle (unchanged since version 1)");
+
+    SudokuBoard *medium = from_id(3, 12345, SUDOKU_MEDIUM);
+    SudokuBoard *medium2 = from_id(3, 12345, SUDOKU_MEDIUM);
+    TEST_ASSERT(medium != NULL && sudoku_board_equals(medium, medium2) &&
+                sudoku_evaluate_difficulty(medium) == SUDOKU_MEDIUM,
+                "MEDIUM puzzles are reproducible too");
+
+    SudokuBoard *mini = from_id(2, 99, SUDOKU_EASY);
+    SudokuBoard *mini2 = from_id(2, 99, SUDOKU_EASY);
+    TEST_ASSERT(mini != NULL && sudoku_board_equals(mini, mini2), "4x4 puzzles are reproducible");
+
+    sudoku_board_destroy(mini2);
+    sudoku_board_destroy(mini);
+    sudoku_board_destroy(medium2);
+    sudoku_board_destroy(medium);
+    sudoku_board_destroy(other);
+    sudoku_board_destroy(b);
+    sudoku_board_destroy(noise);
+    sudoku_board_destroy(a);
+}
+
+void test_caller_stream_untouched(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 2: The caller's stream survives an ID-based call\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *plain = sudoku_board_create();
+    SudokuBoard *interleaved = sudoku_board_create();
+    SudokuBoard *by_id = sudoku_board_create();
+
+    sudoku_random_seed(777);
+    sudoku_generate(plain, NULL);
+
+    sudoku_random_seed(777);
+    sudoku_generate_from_id(by_id, 1, SUDOKU_EASY, NULL);
+    sudoku_generate(interleaved, NULL);
+
+    TEST_ASSERT(sudoku_board_equals(plain, interleaved),
+                "sudoku_random_seed() + generate is reproducible across an ID call");
+
+    sudoku_board_destroy(by_id);
+    sudoku_board_destroy(interleaved);
+    sudoku_board_destroy(plain);
+}
+
+void test_threads(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 3: Same puzzle from any thread\n");
+    printf("===============================================================\n");
+
+    ThreadJob jobs[4];
+    pthread_t threads[4];
+    for (int i = 0; i < 4; i++) {
+        jobs[i].id = 4242;
+        jobs[i].hash = 0;
+        pthread_create(&threads[i], NULL, generate_in_thread, &jobs[i]);
+    }
+    for (int i = 0; i < 4; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    SudokuBoard *local = from_id(3, 4242, SUDOKU_EASY);
+    bool same = local != NULL;
+    for (int i = 0; i < 4; i++) {
+        same = same && jobs[i].hash == sudoku_board_get_hash(local);
+    }
+    TEST_ASSERT(same, "4 concurrent threads and the main thread agree");
+
+    sudoku_board_destroy(local);
+}
+
+void test_invalid_arguments(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 4: Invalid arguments\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *board = sudoku_board_create();
+    TEST_ASSERT(!sudoku_generate_from_id(NULL, 1, SUDOKU_EASY, NULL), "NULL board rejected");
+    TEST_ASSERT(!sudoku_generate_from_id(board, 1, SUDOKU_INVALID, NULL), "Invalid difficulty rejected");
+    sudoku_board_destroy(board);
+}
+
+int main(void) {
+    printf("===============================================================\n");
+    printf("       REPRODUCIBLE GENERATION TEST\n");
+    printf("===============================================================\n");
+
+    test_same_id_same_puzzle();
+    test_caller_stream_untouched();
+    test_threads();
+    test_invalid_arguments();
+
+    printf("\n===============================================================\n");
+    printf("                    TEST SUMMARY\n");
+    printf("===============================================================\n");
+    printf("  Total tests:  %d\n", results.total);
+    printf("  Passed:       %d\n", results.passed);
+    printf("  Failed:       %d\n", results.failed);
+
+    if(results.failed == 0) {
+        printf("\n  *** ALL TESTS PASSED ***\n");
+    } else {
+        printf("\n  *** SOME TESTS FAILED ***\n");
+    }
+    printf("===============================================================\n");
+
+    return results.failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,211 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "sudoku/core/board.h"
+#include "sudoku/core/generator.h"
+#include "sudoku/core/validation.h"
+#include "internal/board_internal.h"
+#include "internal/solution_cache_internal.h"
+
+/* ================================================================
+                   FUNCIONES AUXILIARES DE TEST
+   ================================================================ */
+
+typedef struct {
+    int passed;
+    int failed;
+    int total;
+} TestResults;
+
+TestResults results = {0, 0, 0};
+
+#define TEST_ASSERT(condition, message) do { \
+    results.total++; \
+    if(condition) { \
+        printf("  [PASS] %s\n", message); \
+        results.passed++; \
+    } else { \
+        printf("  [FAIL] %s\n", message); \
+        results.failed++; \
+    } \
+} while(0)
+
+/* Vacía exactamente `count` celdas distintas */
+static void blank_cells(SudokuBoard *board, int count) {
+    int n = board->board_size;
+    while (count > 0) {
+        int i = rand() % (n * n);
+        if (board->cells[i / n][i % n] != 0) {
+            sudoku_board_set_cell(board, i / n, i % n, 0);
+            count--;
+        }
+    }
+}
+
+/* Sondeo estilo Fase 3: quita cada pista y cuenta (límite 2) */
+static long probe_all(SudokuBoard *board, int rounds) {
+    int n = board->board_size;
+    long sum = 0;
+    for (int round = 0; round < rounds; round++) {
+        for (int i = 0; i < n * n; i++) {
+            int v = board->cells[i / n][i % n];
+            if (v == 0) continue;
+            board_set_cell_fast(board, i / n, i % n, 0);
+            sum += countSolutionsExact(board, 2);
+            board_set_cell_fast(board, i / n, i % n, v);
+        }
+    }
+    return sum;
+}
+
+/* ================================================================
+                         TESTS
+   ================================================================ */
+
+void test_entry_semantics(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 1: EXACT and BOUND entries\n");
+    printf("===============================================================\n");
+
+    solution_cache_set_enabled(true);
+    solution_cache_clear();
+
+    int count = -1;
+    uint64_t exact_key = zobrist_key(4, 10, 3);
+    uint64_t bound_key = zobrist_key(4, 11, 4);
+
+    TEST_ASSERT(!solution_cache_lookup(exact_key, 2, &count), "Empty table misses");
+
+    solution_cache_store(exact_key, 1, 2, true, 100);
+    TEST_ASSERT(solution_cache_lookup(exact_key, 2, &count) && count == 1,
+                "EXACT entry hits under the same limit");
+    TEST_ASSERT(solution_cache_lookup(exact_key, 5, &count) && count == 1,
+                "EXACT entry hits under a larger limit");
+    TEST_ASSERT(!solution_cache_lookup(exact_key, 1, &count),
+                "EXACT entry misses when its count reaches the limit");
+
+    solution_cache_store(bound_key, 2, 2, false, 100);
+    TEST_ASSERT(solution_cache_lookup(bound_key, 2, &count) && count == 2,
+                "BOUND entry hits under its own limit");
+    TEST_ASSERT(!solution_cache_lookup(bound_key, 3, &count),
+                "BOUND entry misses under another limit");
+
+    solution_cache_clear();
+    TEST_ASSERT(!solution_cache_lookup(exact_key, 2, &count), "Clear forgets entries");
+
+    solution_cache_set_enabled(false);
+    solution_cache_store(exact_key, 0, 2, true, 100);
+    solution_cache_set_enabled(true);
+    TEST_ASSERT(!solution_cache_lookup(exact_key, 2, &count),
+                "Stores are ignored while the table is off");
+}
+
+void test_probes_16x16(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 2: 16x16 probes with and without the table\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *board = sudoku_board_create_size(4);
+    fillPattern(board);
+    blank_cells(board, 40);
+
+    solution_cache_set_enabled(false);
+    solution_cache_clear();
+    long plain = probe_all(board, 2);
+    SolutionCacheStats off = solution_cache_stats();
+
+    solution_cache_set_enabled(true);
+    solution_cache_clear();
+    long cached = probe_all(board, 2);
+    SolutionCacheStats on = solution_cache_stats();
+
+    printf("  nodes: %llu without, %llu with (%llu hits)\n",
+           (unsigned long long)off.nodes, (unsigned long long)on.nodes,
+           (unsigned long long)on.hits);
+
+    TEST_ASSERT(plain == cached, "Same counts with and without the table");
+    TEST_ASSERT(off.hits == 0, "No hits while the table is off");
+    TEST_ASSERT(on.hits > 0, "Repeated probes hit the table");
+    TEST_ASSERT(on.nodes < off.nodes, "The table saves search nodes");
+
+    // Un tablero completo sigue teniendo una única solución
+    fillPattern(board);
+    TEST_ASSERT(countSolutionsExact(board, 2) == 1, "Complete board still counts 1");
+
+    sudoku_board_destroy(board);
+}
+
+void test_direct_writes(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 3: Cells written directly between counts\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *board = sudoku_board_create_size(4);
+    fillPattern(board);
+    int n = board->board_size;
+
+    solution_cache_set_enabled(true);
+    solution_cache_clear();
+    bool same = true;
+    // Sin sudoku_board_update_stats(): board->hash se queda atrás
+    for (int row = 0; row < 2; row++) {
+        for (int c = 0; c < n; c++) board->cells[row][c] = 0;
+        int cached = countSolutionsExact(board, 2);
+        solution_cache_set_enabled(false);
+        int plain = countSolutionsExact(board, 2);
+        solution_cache_set_enabled(true);
+        same = same && cached == plain;
+    }
+    TEST_ASSERT(same, "Stale board->hash does not change the counts");
+
+    sudoku_board_destroy(board);
+}
+
+void test_small_boards_untouched(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 4: 9x9 counting does not use the table\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *board = sudoku_board_create();
+    fillPattern(board);
+    blank_cells(board, 30);
+
+    solution_cache_set_enabled(true);
+    solution_cache_clear();
+    probe_all(board, 1);
+    SolutionCacheStats s = solution_cache_stats();
+
+    TEST_ASSERT(s.probes == 0 && s.nodes == 0, "9x9 searches skip the table");
+
+    sudoku_board_destroy(board);
+}
+
+int main(void) {
+    printf("===============================================================\n");
+    printf("       SOLUTION CACHE TEST\n");
+    printf("===============================================================\n");
+
+    srand(2041);
+    sudoku_random_seed(2041);   // Rejillas de fillPattern() reproducibles
+
+    test_entry_semantics();
+    test_probes_16x16();
+    test_direct_writes();
+    test_small_boards_untouched();
+
+    printf("\n===============================================================\n");
+    printf("                    TEST SUMMARY\n");
+    printf("===============================================================\n");
+    printf("  Total tests:  %d\n", results.total);
+    printf("  Passed:       %d\n", results.passed);
+    printf("  Failed:       %d\n", results.failed);
+
+    if(results.failed == 0) {
+        printf("\n  *** ALL TESTS PASSED ***\n");
+    } else {
+        printf("\n  *** SOME TESTS FAILED ***\n");
+    }
+    printf("===============================================================\n");
+
+    return results.failed > 0 ? 1 : 0;
+}
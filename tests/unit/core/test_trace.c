@@ -0,0 +1,263 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <sched.h>
+#include "sudoku/core/board.h"
+#include "sudoku/core/types.h"
+#include "sudoku/core/generator.h"
+#include "sudoku/core/trace.h"
+
+/* ================================================================
+                   FUNCIONES AUXILIARES DE TEST
+   ================================================================ */
+
+typedef struct {
+    int passed;
+    int failed;
+    int total;
+} TestResults;
+
+TestResults results = {0, 0, 0};
+
+#define TEST_ASSERT(condition, message) do { \
+    results.total++; \
+    if(condition) { \
+        printf("  [PASS] %s\n", message); \
+        results.passed++; \
+    } else { \
+        printf("  [FAIL] %s\n", message); \
+        results.failed++; \
+    } \
+} while(0)
+
+static SudokuEventData cell_event(int i) {
+    SudokuEventData event = {
+        .type = SUDOKU_EVENT_PHASE3_CELL_REMOVED,
+        .board = NULL,
+        .phase_number = 3,
+        .cells_removed_total = i,
+        .round_number = 0,
+        .row = i % 9,
+        .col = i / 9,
+        .value = 1 + i % 9
+    };
+    return event;
+}
+
+/* ================================================================
+                        TESTS DE trace.h
+   ================================================================ */
+
+/**
+ * @brief Test 1: push/drain in order, wrap-around and record contents
+ */
+void test_push_drain(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 1: sudoku_trace_push() / sudoku_trace_drain()\n");
+    printf("===============================================================\n");
+
+    SudokuTraceBuffer *trace = sudoku_trace_create(10, SUDOKU_TRACE_DROP_NEWEST);
+    TEST_ASSERT(trace != NULL, "Trace buffer created");
+    if(trace == NULL) return;
+
+    SudokuTraceStats stats;
+    sudoku_trace_get_stats(trace, &stats);
+    TEST_ASSERT(stats.capacity == 16, "Capacity rounded up to a power of two");
+
+    /* Varias vueltas al anillo, drenando en trozos de 5 */
+    SudokuTraceRecord out[16];
+    bool in_order = true;
+    int next = 0;
+    for(int i = 0; i < 100; i++) {
+        SudokuEventData event = cell_event(i);
+        sudoku_trace_push(trace, &event);
+        if(i % 7 == 6) {
+            size_t got;
+            while((got = sudoku_trace_drain(trace, out, 5)) > 0) {
+                for(size_t j = 0; j < got; j++) {
+                    in_order = in_order && out[j].cells_removed_total == next &&
+                               out[j].sequence == (uint32_t)next;
+                    next++;
+                }
+            }
+        }
+    }
+    size_t got = sudoku_trace_drain(trace, out, 16);
+    for(size_t j = 0; j < got; j++) {
+        in_order = in_order && out[j].cells_removed_total == next++;
+    }
+    TEST_ASSERT(in_order && next == 100, "100 records drained in push order across wrap-around");
+
+    TEST_ASSERT(got > 0 && out[got - 1].type == SUDOKU_EVENT_PHASE3_CELL_REMOVED &&
+                out[got - 1].row == 99 % 9 && out[got - 1].col == 99 / 9 &&
+                out[got - 1].value == 1 + 99 % 9 && out[got - 1].timestamp_ns > 0,
+                "Record keeps type, cell and timestamp");
+    TEST_ASSERT(sudoku_trace_pending(trace) == 0, "Nothing pending after drain");
+
+    sudoku_trace_destroy(trace);
+    sudoku_trace_destroy(NULL);
+}
+
+/**
+ * @brief Test 2: DROP_NEWEST overflow policy and counters
+ */
+void test_overflow(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 2: Overflow with SUDOKU_TRACE_DROP_NEWEST\n");
+    printf("===============================================================\n");
+
+    SudokuTraceBuffer *trace = sudoku_trace_create(8, SUDOKU_TRACE_DROP_NEWEST);
+    int stored = 0;
+    for(int i = 0; i < 20; i++) {
+        SudokuEventData event = cell_event(i);
+        stored += sudoku_trace_push(trace, &event) ? 1 : 0;
+    }
+    TEST_ASSERT(stored == 8, "Only 8 records fit");
+
+    SudokuTraceStats stats;
+    sudoku_trace_get_stats(trace, &stats);
+    TEST_ASSERT(stats.pushed == 8 && stats.dropped == 12 && stats.high_water == 8,
+                "pushed/dropped/high_water counters");
+
+    SudokuTraceRecord out[8];
+    size_t got = sudoku_trace_drain(trace, out, 8);
+    SudokuEventData event = cell_event(20);
+    sudoku_trace_push(trace, &event);
+    sudoku_trace_drain(trace, out + 0, 1);
+    TEST_ASSERT(got == 8 && out[0].sequence == 20,
+                "Sequence numbers reveal dropped records");
+
+    sudoku_trace_get_stats(trace, &stats);
+    TEST_ASSERT(stats.drained == 9, "drained counter");
+    sudoku_trace_destroy(trace);
+}
+
+/**
+ * @brief Test 3: trace buffer as the generation callback
+ */
+void test_generation_trace(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 3: sudoku_trace_callback() during generation\n");
+    printf("===============================================================\n");
+
+    SudokuTraceBuffer *trace = sudoku_trace_create(0, SUDOKU_TRACE_DROP_NEWEST);
+    SudokuBoard *board = sudoku_board_create();
+    SudokuGenerationConfig config = {
+        .callback = sudoku_trace_callback,
+        .user_data = trace
+    };
+    TEST_ASSERT(sudoku_generate_ex(board, &config, NULL), "Generation succeeded");
+
+    SudokuTraceRecord out[64];
+    size_t got, total = 0;
+    bool monotonic = true;
+    bool saw_start = false, saw_complete = false;
+    uint64_t last = 0;
+    while((got = sudoku_trace_drain(trace, out, 64)) > 0) {
+        for(size_t j = 0; j < got; j++) {
+            monotonic = monotonic && out[j].timestamp_ns >= last;
+            last = out[j].timestamp_ns;
+            saw_start = saw_start || out[j].type == SUDOKU_EVENT_GENERATION_START;
+            saw_complete = saw_complete || out[j].type == SUDOKU_EVENT_GENERATION_COMPLETE;
+        }
+        total += got;
+    }
+    TEST_ASSERT(total > 50 && saw_start && saw_complete,
+                "Whole generation recorded (start to complete)");
+    TEST_ASSERT(monotonic, "Timestamps never go backwards");
+
+    sudoku_board_destroy(board);
+    sudoku_trace_destroy(trace);
+}
+
+/* ================================================================
+                  PRODUCTOR / CONSUMIDOR CONCURRENTES
+   ================================================================ */
+
+#define SPSC_EVENTS 200000
+
+typedef struct {
+    SudokuTraceBuffer *trace;
+    bool in_order;
+    long received;
+} ConsumerState;
+
+static void *consumer_thread(void *arg) {
+    ConsumerState *state = (ConsumerState*)arg;
+    SudokuTraceRecord out[32];
+    long expected = 0;
+    while(expected < SPSC_EVENTS) {
+        size_t got = sudoku_trace_drain(state->trace, out, 32);
+        if(got == 0) {
+            sched_yield();   /* vacio: deja correr al productor */
+        }
+        for(size_t j = 0; j < got; j++) {
+            state->in_order = state->in_order && out[j].cells_removed_total == expected;
+            expected++;
+        }
+    }
+    state->received = expected;
+    return NULL;
+}
+
+/**
+ * @brief Test 4: BLOCK policy with a real consumer thread loses nothing
+ */
+void test_spsc_threads(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 4: Concurrent producer/consumer (SUDOKU_TRACE_BLOCK)\n");
+    printf("===============================================================\n");
+
+    ConsumerState state = { sudoku_trace_create(64, SUDOKU_TRACE_BLOCK), true, 0 };
+    pthread_t consumer;
+    pthread_create(&consumer, NULL, consumer_thread, &state);
+
+    for(int i = 0; i < SPSC_EVENTS; i++) {
+        SudokuEventData event = cell_event(i);
+        sudoku_trace_push(state.trace, &event);
+    }
+    pthread_join(consumer, NULL);
+
+    SudokuTraceStats stats;
+    sudoku_trace_get_stats(state.trace, &stats);
+    TEST_ASSERT(state.received == SPSC_EVENTS && state.in_order,
+                "200000 records received in order");
+    TEST_ASSERT(stats.dropped == 0 && stats.pushed == SPSC_EVENTS &&
+                stats.high_water <= 64,
+                "No drops and occupancy bounded by capacity");
+
+    sudoku_trace_destroy(state.trace);
+}
+
+int main(void) {
+    printf("===============================================================\n");
+    printf("       TRACE BUFFER TEST\n");
+    printf("===============================================================\n");
+
+    srand(12345);
+
+    test_push_drain();
+    test_overflow();
+#ifndef SUDOKU_DISABLE_EVENTS
+    test_generation_trace();    /* Sin eventos la generación no deja trazas */
+#endif
+    test_spsc_threads();
+
+    printf("\n===============================================================\n");
+    printf("                    TEST SUMMARY\n");
+    printf("===============================================================\n");
+    printf("  Total tests:  %d\n", results.total);
+    printf("  Passed:       %d\n", results.passed);
+    printf("  Failed:       %d\n", results.failed);
+
+    if(results.failed == 0) {
+        printf("\n  *** ALL TESTS PASSED ***\n");
+    } else {
+        printf("\n  *** SOME TESTS FAILED ***\n");
+    }
+    printf("===============================================================\n");
+
+    return results.failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,225 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "sudoku/core/board.h"
+#include "sudoku/core/types.h"
+#include "sudoku/core/validation.h"
+#include "sudoku/core/transform.h"
+
+/* ================================================================
+                   FUNCIONES AUXILIARES DE TEST
+   ================================================================ */
+
+typedef struct {
+    int passed;
+    int failed;
+    int total;
+} TestResults;
+
+TestResults results = {0, 0, 0};
+
+#define TEST_ASSERT(condition, message) do { \
+    results.total++; \
+    if(condition) { \
+        printf("  [PASS] %s\n", message); \
+        results.passed++; \
+    } else { \
+        printf("  [FAIL] %s\n", message); \
+        results.failed++; \
+    } \
+} while(0)
+
+/* Puzzle clasico con solucion unica (30 pistas) */
+static const int SEED_PUZZLE[9][9] = {
+    {5,3,0, 0,7,0, 0,0,0},
+    {6,0,0, 1,9,5, 0,0,0},
+    {0,9,8, 0,0,0, 0,6,0},
+    {8,0,0, 0,6,0, 0,0,3},
+    {4,0,0, 8,0,3, 0,0,1},
+    {7,0,0, 0,2,0, 0,0,6},
+    {0,6,0, 0,0,0, 2,8,0},
+    {0,0,0, 4,1,9, 0,0,5},
+    {0,0,0, 0,8,0, 0,7,9}
+};
+
+static SudokuBoard *load_seed(void) {
+    SudokuBoard *board = sudoku_board_create();
+    if(board == NULL) return NULL;
+    for(int i = 0; i < 9; i++) {
+        for(int j = 0; j < 9; j++) {
+            sudoku_board_set_cell(board, i, j, SEED_PUZZLE[i][j]);
+        }
+    }
+    sudoku_board_update_stats(board);
+    return board;
+}
+
+static bool matches_seed(const SudokuBoard *board) {
+    for(int i = 0; i < 9; i++) {
+        for(int j = 0; j < 9; j++) {
+            if(board->cells[i][j] != SEED_PUZZLE[i][j]) return false;
+        }
+    }
+    return true;
+}
+
+/* ================================================================
+                        TESTS DE transform.h
+   ================================================================ */
+
+/**
+ * @brief Test 1: every single family keeps the puzzle valid and unique
+ */
+void test_each_family(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 1: sudoku_board_transform() - Individual Families\n");
+    printf("===============================================================\n");
+
+    const unsigned int families[] = {
+        SUDOKU_TRANSFORM_DIGITS, SUDOKU_TRANSFORM_BANDS,
+        SUDOKU_TRANSFORM_ROWS, SUDOKU_TRANSFORM_STACKS,
+        SUDOKU_TRANSFORM_COLUMNS, SUDOKU_TRANSFORM_TRANSPOSE,
+        SUDOKU_TRANSFORM_ROTATE
+    };
+    bool all_ok = true;
+
+    for(size_t f = 0; f < sizeof(families) / sizeof(families[0]); f++) {
+        for(int rep = 0; rep < 5; rep++) {
+            SudokuBoard *board = load_seed();
+            if(board == NULL || !sudoku_board_transform(board, families[f])) {
+                all_ok = false;
+            } else if(sudoku_board_get_clues(board) != 30 ||
+                      !sudoku_validate_board(board) ||
+                      countSolutionsExact(board, 2) != 1) {
+                all_ok = false;
+            }
+            sudoku_board_destroy(board);
+        }
+    }
+
+    TEST_ASSERT(all_ok, "Each family preserves clues, validity and uniqueness");
+}
+
+/**
+ * @brief Test 2: the full composition changes the board but not its nature
+ */
+void test_all_families(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 2: sudoku_board_transform() - SUDOKU_TRANSFORM_ALL\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *seed = load_seed();
+    SudokuBoard *board = load_seed();
+    if(seed == NULL || board == NULL) {
+        printf("  [FAIL] Could not create board\n");
+        sudoku_board_destroy(seed);
+        sudoku_board_destroy(board);
+        return;
+    }
+
+    bool changed = false;
+    bool all_ok = true;
+    for(int rep = 0; rep < 20; rep++) {
+        all_ok = all_ok && sudoku_board_transform(board, SUDOKU_TRANSFORM_ALL);
+        all_ok = all_ok && sudoku_validate_board(board);
+        all_ok = all_ok && countSolutionsExact(board, 2) == 1;
+        if(!matches_seed(board)) changed = true;
+    }
+
+    TEST_ASSERT(all_ok, "Repeated full transforms stay valid and unique");
+    TEST_ASSERT(sudoku_board_get_clues(board) == 30, "Clue count preserved (30)");
+    TEST_ASSERT(changed, "Board actually changes");
+    TEST_ASSERT(sudoku_board_transform(seed, SUDOKU_TRANSFORM_NONE) &&
+                matches_seed(seed),
+                "SUDOKU_TRANSFORM_NONE is the identity");
+    TEST_ASSERT(!sudoku_board_transform(NULL, SUDOKU_TRANSFORM_ALL),
+                "NULL board rejected");
+
+    sudoku_board_destroy(seed);
+    sudoku_board_destroy(board);
+}
+
+/**
+ * @brief Test 3: a full 16×16 grid stays a full valid grid
+ */
+void test_large_board(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 3: sudoku_board_transform() - 16x16 Complete Grid\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *board = sudoku_board_create_size(4);
+    if(board == NULL) {
+        printf("  [FAIL] Could not create board\n");
+        return;
+    }
+
+    /* Patron canonico: siempre es una solucion valida */
+    for(int r = 0; r < 16; r++) {
+        for(int c = 0; c < 16; c++) {
+            board->cells[r][c] = ((4 * (r % 4) + r / 4 + c) % 16) + 1;
+        }
+    }
+    sudoku_board_update_stats(board);
+
+    TEST_ASSERT(sudoku_validate_board(board), "Pattern grid is valid");
+    TEST_ASSERT(sudoku_board_transform(board, SUDOKU_TRANSFORM_ALL), "Transform succeeds");
+    TEST_ASSERT(sudoku_validate_board(board), "Transformed grid is valid");
+    TEST_ASSERT(sudoku_board_get_empty(board) == 0, "Grid still complete");
+
+    sudoku_board_destroy(board);
+}
+
+/**
+ * @brief Test 4: batch expansion
+ */
+void test_batch(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 4: sudoku_board_transform_batch() - Seed Expansion\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *seed = load_seed();
+    SudokuBoard *variants[8];
+    int made = sudoku_board_transform_batch(seed, variants, 8, SUDOKU_TRANSFORM_ALL);
+
+    TEST_ASSERT(made == 8, "Produced 8 variants");
+
+    bool all_ok = true;
+    for(int i = 0; i < made; i++) {
+        all_ok = all_ok && variants[i]->clues == 30;
+        all_ok = all_ok && countSolutionsExact(variants[i], 2) == 1;
+        sudoku_board_destroy(variants[i]);
+    }
+    TEST_ASSERT(all_ok, "Every variant keeps 30 clues and a unique solution");
+    TEST_ASSERT(matches_seed(seed), "Seed left untouched");
+
+    sudoku_board_destroy(seed);
+}
+
+int main(void) {
+    printf("===============================================================\n");
+    printf("       TRANSFORM MODULE TEST\n");
+    printf("===============================================================\n");
+
+    srand(12345);
+
+    test_each_family();
+    test_all_families();
+    test_large_board();
+    test_batch();
+
+    printf("\n===============================================================\n");
+    printf("                    TEST SUMMARY\n");
+    printf("===============================================================\n");
+    printf("  Total tests:  %d\n", results.total);
+    printf("  Passed:       %d\n", results.passed);
+    printf("  Failed:       %d\n", results.failed);
+
+    if(results.failed == 0) {
+        printf("\n  *** ALL TESTS PASSED ***\n");
+    } else {
+        printf("\n  *** SOME TESTS FAILED ***\n");
+    }
+    printf("===============================================================\n");
+
+    return results.failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,188 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "sudoku/core/board.h"
+#include "sudoku/core/generator.h"
+#include "sudoku/core/batch.h"
+#include "sudoku/core/validation.h"
+
+/* ================================================================
+                   FUNCIONES AUXILIARES DE TEST
+   ================================================================ */
+
+typedef struct {
+    int passed;
+    int failed;
+    int total;
+} TestResults;
+
+TestResults results = {0, 0, 0};
+
+#define TEST_ASSERT(condition, message) do { \
+    results.total++; \
+    if(condition) { \
+        printf("  [PASS] %s\n", message); \
+        results.passed++; \
+    } else { \
+        printf("  [FAIL] %s\n", message); \
+        results.failed++; \
+    } \
+} while(0)
+
+#define VARIANTS 6
+
+static void create_all(SudokuBoard **boards, int count, int k) {
+    for (int i = 0; i < count; i++) boards[i] = sudoku_board_create_size(k);
+}
+
+static void destroy_all(SudokuBoard **boards, int count) {
+    for (int i = 0; i < count; i++) sudoku_board_destroy(boards[i]);
+}
+
+/* ¿Todos únicos, distintos entre sí y con la misma solución? */
+static void check_variants(SudokuBoard **puzzles, int count,
+                           bool *distinct, bool *unique, bool *shared) {
+    *distinct = true;
+    for (int i = 0; i < count; i++) {
+        for (int j = 0; j < i; j++) {
+            if (sudoku_board_equals(puzzles[i], puzzles[j])) *distinct = false;
+        }
+    }
+
+    SudokuBoard *solved[VARIANTS] = { NULL };
+    int solutions[VARIANTS] = { 0 };
+    for (int i = 0; i < count; i++) solved[i] = sudoku_board_clone(puzzles[i]);
+    sudoku_batch_solve(solved, count, solutions, NULL);
+
+    *unique = true;
+    *shared = true;
+    for (int i = 0; i < count; i++) {
+        if (solutions[i] != 1) *unique = false;
+        if (!sudoku_board_equals(solved[i], solved[0])) *shared = false;
+    }
+    destroy_all(solved, count);
+}
+
+/* ================================================================
+                         TESTS
+   ================================================================ */
+
+void test_variants_share_solution(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 1: One grid, several distinct puzzles\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *puzzles[VARIANTS];
+    create_all(puzzles, VARIANTS, 3);
+
+    SudokuGenerationStats stats;
+    int made = sudoku_generate_variants(puzzles, VARIANTS, NULL, &stats);
+    bool distinct, unique, shared;
+    check_variants(puzzles, made, &distinct, &unique, &shared);
+
+    TEST_ASSERT(made == VARIANTS, "Every variant generated");
+    TEST_ASSERT(distinct, "Variants are pairwise distinct");
+    TEST_ASSERT(unique, "Every variant has a unique solution");
+    TEST_ASSERT(shared, "All variants have the same solution");
+    TEST_ASSERT(stats.status == SUDOKU_STATUS_OK && stats.total_attempts >= 1,
+                "Stats report the single fill");
+
+    destroy_all(puzzles, VARIANTS);
+}
+
+void test_variants_difficulty(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 2: The difficulty target applies to every variant\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *puzzles[VARIANTS];
+    create_all(puzzles, VARIANTS, 3);
+
+    SudokuGenerationConfig config = {
+        .use_target_difficulty = true,
+        .target_difficulty = SUDOKU_MEDIUM
+    };
+    int made = sudoku_generate_variants(puzzles, VARIANTS, &config, NULL);
+    bool distinct, unique, shared;
+    check_variants(puzzles, made, &distinct, &unique, &shared);
+
+    int medium = 0;
+    for (int i = 0; i < made; i++) {
+        if (sudoku_evaluate_difficulty(puzzles[i]) == SUDOKU_MEDIUM) medium++;
+    }
+
+    TEST_ASSERT(made == VARIANTS && medium == made, "Every variant is MEDIUM");
+    TEST_ASSERT(distinct && unique && shared, "Distinct, unique and sharing the solution");
+
+    destroy_all(puzzles, VARIANTS);
+}
+
+void test_variants_counterexamples(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 3: Second solutions of earlier carves reject removals\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *puzzles[VARIANTS];
+    create_all(puzzles, VARIANTS, 3);
+
+    /* Los puzzles mínimos rechazan muchas eliminaciones: la caché
+       tiene que ahorrar sondas y no cambiar la minimalidad */
+    SudokuGenerationConfig config = { .minimal_puzzle = true };
+    SudokuGenerationStats stats;
+    int made = sudoku_generate_variants(puzzles, VARIANTS, &config, &stats);
+    bool distinct, unique, shared;
+    check_variants(puzzles, made, &distinct, &unique, &shared);
+
+    int minimal = 0;
+    for (int i = 0; i < made; i++) {
+        if (sudoku_is_minimal(puzzles[i], 1)) minimal++;
+    }
+
+    TEST_ASSERT(made == VARIANTS && stats.phase3_probes_refuted > 0,
+                "Later carves skip probes thanks to cached counterexamples");
+    TEST_ASSERT(distinct && unique && shared, "Distinct, unique and sharing the solution");
+    TEST_ASSERT(minimal == made, "Every variant is still minimal");
+
+    destroy_all(puzzles, VARIANTS);
+}
+
+void test_variants_arguments(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 4: Invalid arguments\n");
+    printf("===============================================================\n");
+
+    SudokuBoard *mixed[2] = { sudoku_board_create_size(3), sudoku_board_create_size(2) };
+    TEST_ASSERT(sudoku_generate_variants(mixed, 2, NULL, NULL) == 0, "Mixed sizes are rejected");
+    TEST_ASSERT(sudoku_generate_variants(NULL, 2, NULL, NULL) == 0, "NULL array is rejected");
+    TEST_ASSERT(sudoku_generate_variants(mixed, 0, NULL, NULL) == 0, "Zero count is rejected");
+    destroy_all(mixed, 2);
+}
+
+int main(void) {
+    printf("===============================================================\n");
+    printf("       SHARED-SOLUTION VARIANTS TEST\n");
+    printf("===============================================================\n");
+
+    sudoku_random_seed(2048);
+
+    test_variants_share_solution();
+    test_variants_difficulty();
+    test_variants_counterexamples();
+    test_variants_arguments();
+
+    printf("\n===============================================================\n");
+    printf("                    TEST SUMMARY\n");
+    printf("===============================================================\n");
+    printf("  Total tests:  %d\n", results.total);
+    printf("  Passed:       %d\n", results.passed);
+    printf("  Failed:       %d\n", results.failed);
+
+    if(results.failed == 0) {
+        printf("\n  *** ALL TESTS PASSED ***\n");
+    } else {
+        printf("\n  *** SOME TESTS FAILED ***\n");
+    }
+    printf("===============================================================\n");
+
+    return results.failed > 0 ? 1 : 0;
+}
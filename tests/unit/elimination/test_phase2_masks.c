@@ -0,0 +1,196 @@
+/**
+ * @file test_phase2_masks.c
+ * @brief Equivalence test for the mask-based Phase 2
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * WHAT WE'RE TESTING:
+ * - phase2Elimination() (incremental position masks) removes exactly
+ *   the same cells as the original hasAlternative() loop, round after
+ *   round, from 4×4 up to the 64×64 mask limit
+ * - Larger boards still run (hasAlternative() fallback)
+ *
+ * RUN:
+ *   ./bin/test_elimination_phase2_masks
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "sudoku/core/board.h"
+#include "sudoku/core/validation.h"
+#include "sudoku/core/transform.h"
+#include "internal/elimination_internal.h"
+#include "internal/algorithms_internal.h"
+
+// ═══════════════════════════════════════════════════════════════════
+//                    TEST FRAMEWORK UTILITIES
+// ═══════════════════════════════════════════════════════════════════
+
+typedef struct {
+    int passed;
+    int failed;
+    int total;
+} TestResults;
+
+#define TEST_START() TestResults results = {0, 0, 0}
+#define TEST_END() return results
+
+#define TEST_CASE(name) \
+    printf("\n═══════════════════════════════════════════════════════════\n"); \
+    printf("TEST: %s\n", name); \
+    printf("═══════════════════════════════════════════════════════════\n"); \
+    results.total++
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✅ PASS: %s\n", message); \
+            results.passed++; \
+        } else { \
+            printf("  ❌ FAIL: %s\n", message); \
+            results.failed++; \
+        } \
+    } while(0)
+
+/**
+ * @brief Random complete grid: canonical pattern + random transform
+ */
+static SudokuBoard *random_solution(int k) {
+    SudokuBoard *board = sudoku_board_create_size(k);
+    int n = k * k;
+    for (int r = 0; r < n; r++) {
+        for (int c = 0; c < n; c++) {
+            board->cells[r][c] = ((k * (r % k) + r / k + c) % n) + 1;
+        }
+    }
+    sudoku_board_transform(board, SUDOKU_TRANSFORM_ALL);
+    return board;
+}
+
+/**
+ * @brief Reference round: the original hasAlternative() driver
+ */
+static int reference_round(SudokuBoard *board, const int *index, int count) {
+    int n = board->board_size;
+    int removed = 0;
+    for (int idx = 0; idx < count; idx++) {
+        SudokuSubGrid sg = sudoku_subgrid_create(index[idx], board->subgrid_size);
+        for (int i = 0; i < n; i++) {
+            SudokuPosition pos = sudoku_subgrid_get_position(&sg, i);
+            int num = board->cells[pos.row][pos.col];
+            if (num != 0 && !hasAlternative(board, &pos, num)) {
+                board->cells[pos.row][pos.col] = 0;
+                removed++;
+                break;
+            }
+        }
+    }
+    return removed;
+}
+
+static bool same_cells(const SudokuBoard *a, const SudokuBoard *b) {
+    for (int r = 0; r < a->board_size; r++) {
+        for (int c = 0; c < a->board_size; c++) {
+            if (a->cells[r][c] != b->cells[r][c]) return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Run Phase 1 then Phase 2 to convergence on both paths
+ *
+ * @return true if every round removed the same cells
+ */
+static bool compare_paths(int k, int *total_removed) {
+    int n = k * k;
+    SudokuBoard *fast = random_solution(k);
+    int *index = malloc(n * sizeof(int));
+    for (int i = 0; i < n; i++) index[i] = i;
+
+    sudoku_generate_permutation(index, n, 0);
+    phase1Elimination(fast, index, n);
+    SudokuBoard *slow = sudoku_board_clone(fast);
+
+    bool same = true;
+    int removed_fast, removed_slow;
+    *total_removed = 0;
+    do {
+        sudoku_generate_permutation(index, n, 0);
+        removed_fast = phase2Elimination(fast, index, n);
+        removed_slow = reference_round(slow, index, n);
+        *total_removed += removed_fast;
+        same = same && removed_fast == removed_slow && same_cells(fast, slow);
+    } while (same && removed_fast > 0);
+
+    sudoku_board_destroy(fast);
+    sudoku_board_destroy(slow);
+    free(index);
+    return same;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    TESTS
+// ═══════════════════════════════════════════════════════════════════
+
+TestResults test_equivalence(void) {
+    TEST_START();
+    TEST_CASE("Mask Phase 2 matches hasAlternative() Phase 2");
+
+    const int sizes[] = {2, 3, 4, 5, 8};
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        int k = sizes[s];
+        int trials = (k <= 3) ? 50 : (k <= 5 ? 10 : 2);
+        bool all_same = true;
+        int removed = 0, total = 0;
+        for (int t = 0; t < trials; t++) {
+            all_same = all_same && compare_paths(k, &removed);
+            total += removed;
+        }
+        char message[96];
+        snprintf(message, sizeof(message),
+                 "%dx%d: %d boards identical (%d Phase 2 removals)",
+                 k * k, k * k, trials, total);
+        ASSERT_TRUE(all_same && total > 0, message);
+    }
+
+    TEST_END();
+}
+
+TestResults test_fallback(void) {
+    TEST_START();
+    TEST_CASE("Boards above 64x64 use the hasAlternative() fallback");
+
+    int removed = 0;
+    bool same = compare_paths(9, &removed);
+    ASSERT_TRUE(same && removed > 0, "81x81: fallback path removes cells");
+
+    TEST_END();
+}
+
+int main(void) {
+    srand(2026);
+    
+    TestResults total = {0, 0, 0};
+    TestResults (*tests[])(void) = {
+        test_equivalence, test_fallback
+    };
+    
+    for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+        TestResults result = tests[i]();
+        total.passed += result.passed;
+        total.failed += result.failed;
+        total.total += result.total;
+    }
+    
+    printf("\n");
+    printf("╔═══════════════════════════════════════════════════════════╗\n");
+    printf("║                     TEST SUMMARY                          ║\n");
+    printf("╠═══════════════════════════════════════════════════════════╣\n");
+    printf("║ Passed:       %-3d  ✅                                    ║\n", total.passed);
+    printf("║ Failed:       %-3d  ❌                                    ║\n", total.failed);
+    printf("╚═══════════════════════════════════════════════════════════╝\n");
+    
+    return total.failed == 0 ? 0 : 1;
+}
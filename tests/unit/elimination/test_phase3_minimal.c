@@ -0,0 +1,317 @@
+/**
+ * @file test_phase3_minimal.c
+ * @brief Test suite for minimal-puzzle Phase 3 and probe saving
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * WHAT WE'RE TESTING:
+ * - With minimal_puzzle, every clue of the result is necessary
+ *   (removing any one of them gives a second solution)
+ * - Probes saved by the single certificates are reported, and
+ *   probes + saved equals the number of clues decided
+ * - The classic (non-minimal) Phase 3 still honours its target and
+ *   also saves probes
+ * - A removal that is no single in its own cell, but whose puzzle
+ *   singles still solve, is certified without a probe; a removal
+ *   that stalls the singles still reaches the solver
+ *
+ * RUN:
+ *   ./bin/test_elimination_phase3_minimal
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "sudoku/core/board.h"
+#include "sudoku/core/generator.h"
+#include "sudoku/core/validation.h"
+#include "sudoku/core/grader.h"
+#include "internal/elimination_internal.h"
+
+// ═══════════════════════════════════════════════════════════════════
+//                    TEST FRAMEWORK UTILITIES
+// ═══════════════════════════════════════════════════════════════════
+
+typedef struct {
+    int passed;
+    int failed;
+    int total;
+} TestResults;
+
+#define TEST_START() TestResults results = {0, 0, 0}
+#define TEST_END() return results
+
+#define TEST_CASE(name) \
+    printf("\n═══════════════════════════════════════════════════════════\n"); \
+    printf("TEST: %s\n", name); \
+    printf("═══════════════════════════════════════════════════════════\n"); \
+    results.total++
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✅ PASS: %s\n", message); \
+            results.passed++; \
+        } else { \
+            printf("  ❌ FAIL: %s\n", message); \
+            results.failed++; \
+        } \
+    } while(0)
+
+/**
+ * @brief Solution count capped at 2
+ * 
+ * Minimal puzzles are too sparse for countSolutionsExact() to be quick,
+ * so the grader's mask solver does the counting here.
+ */
+static int solutions_of(const SudokuBoard *board) {
+    SudokuGradeResult grade;
+    if (!sudoku_grade_puzzle(board, &grade) || grade.solutions < 0) {
+        return countSolutionsExact((SudokuBoard *)board, 2);
+    }
+    return grade.solutions;
+}
+
+/**
+ * @brief true if no clue can be removed without losing uniqueness
+ */
+static bool is_minimal(SudokuBoard *board) {
+    int n = board->board_size;
+    for (int r = 0; r < n; r++) {
+        for (int c = 0; c < n; c++) {
+            int value = board->cells[r][c];
+            if (value == 0) continue;
+            board->cells[r][c] = 0;
+            int solutions = solutions_of(board);
+            board->cells[r][c] = value;
+            if (solutions == 1) return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Minimal 9x9 puzzle (every clue necessary) that singles solve
+ */
+static const int SINGLES_MINIMAL[9][9] = {
+    {0, 0, 0, 3, 0, 7, 0, 0, 0},
+    {0, 0, 4, 0, 8, 2, 0, 0, 0},
+    {0, 0, 0, 0, 9, 0, 8, 5, 3},
+    {0, 0, 0, 0, 1, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 5, 0, 0, 1},
+    {0, 0, 6, 0, 2, 0, 0, 0, 0},
+    {1, 0, 0, 0, 0, 0, 0, 8, 0},
+    {8, 0, 2, 0, 0, 0, 3, 0, 5},
+    {0, 0, 0, 9, 3, 0, 7, 0, 0},
+};
+
+/**
+ * @brief Extra clue for SINGLES_MINIMAL: neither a naked nor a hidden
+ *        single in its cell, and every other clue stays necessary
+ */
+#define EXTRA_ROW   0
+#define EXTRA_COL   2
+#define EXTRA_VALUE 1
+
+static SudokuBoard *board_from(const int cells[9][9]) {
+    SudokuBoard *board = sudoku_board_create();
+    for (int r = 0; r < 9; r++) {
+        for (int c = 0; c < 9; c++) {
+            sudoku_board_set_cell(board, r, c, cells[r][c]);
+        }
+    }
+    sudoku_board_update_stats(board);
+    return board;
+}
+
+/**
+ * @brief Would @p value be a naked or hidden single in the empty cell?
+ */
+static bool single_in_cell(const SudokuBoard *board, int row, int col, int value) {
+    int candidates = 0;
+    for (int d = 1; d <= 9; d++) {
+        SudokuPosition pos = { row, col };
+        if (sudoku_is_safe_position(board, &pos, d)) candidates++;
+    }
+    if (candidates == 1) return true;
+
+    // Other cells of each unit where value still fits
+    int in_row = 0, in_col = 0, in_box = 0;
+    for (int i = 0; i < 9; i++) {
+        SudokuPosition r = { row, i };
+        SudokuPosition c = { i, col };
+        SudokuPosition b = { row / 3 * 3 + i / 3, col / 3 * 3 + i % 3 };
+        if (i != col && board->cells[r.row][r.col] == 0 &&
+            sudoku_is_safe_position(board, &r, value)) in_row++;
+        if (i != row && board->cells[c.row][c.col] == 0 &&
+            sudoku_is_safe_position(board, &c, value)) in_col++;
+        if ((b.row != row || b.col != col) && board->cells[b.row][b.col] == 0 &&
+            sudoku_is_safe_position(board, &b, value)) in_box++;
+    }
+    return in_row == 0 || in_col == 0 || in_box == 0;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    TESTS
+// ═══════════════════════════════════════════════════════════════════
+
+TestResults test_minimal_generation(void) {
+    TEST_START();
+    TEST_CASE("minimal_puzzle produces minimal unique puzzles");
+
+    SudokuGenerationConfig config = { .minimal_puzzle = true };
+    bool all_ok = true;
+    int saved = 0, probes = 0, clues = 0;
+    const int puzzles = 10;
+
+    for (int i = 0; i < puzzles; i++) {
+        SudokuBoard *board = sudoku_board_create();
+        SudokuGenerationStats stats;
+        all_ok = all_ok && sudoku_generate_ex(board, &config, &stats);
+        all_ok = all_ok && solutions_of(board) == 1 && is_minimal(board);
+        saved += stats.phase3_probes_saved;
+        probes += stats.phase3_probes;
+        clues += sudoku_board_get_clues(board);
+        sudoku_board_destroy(board);
+    }
+
+    char message[128];
+    snprintf(message, sizeof(message),
+             "%d 9x9 puzzles minimal (avg %.1f clues, %d probes, %d saved)",
+             puzzles, clues / (double)puzzles, probes, saved);
+    ASSERT_TRUE(all_ok, message);
+    ASSERT_TRUE(saved > 0, "Single certificates saved probes");
+
+    SudokuBoard *small = sudoku_board_create_size(2);
+    bool ok = sudoku_generate_ex(small, &config, NULL);
+    ASSERT_TRUE(ok && solutions_of(small) == 1 && is_minimal(small),
+                "4x4 puzzle minimal");
+    sudoku_board_destroy(small);
+
+    TEST_END();
+}
+
+TestResults test_probe_accounting(void) {
+    TEST_START();
+    TEST_CASE("Every clue decided exactly once in minimal mode");
+
+    SudokuBoard *board = sudoku_board_create();
+    sudoku_generate(board, NULL);
+    sudoku_board_update_stats(board);
+    int before = sudoku_board_get_clues(board);
+
+    Phase3Probes probes = { 0 };
+    Phase3Config config = { .max_removals = 1, .minimal = true, .probes = &probes };
+    int removed = phase3EliminationEx(board, &config, NULL);
+    sudoku_board_update_stats(board);
+
+    ASSERT_TRUE(removed >= 0 && sudoku_board_get_clues(board) == before - removed,
+                "max_removals ignored, clue count consistent");
+    ASSERT_TRUE(probes.probes + probes.probes_saved == before,
+                "probes + saved == clues decided");
+    ASSERT_TRUE(is_minimal(board), "Result is minimal");
+
+    sudoku_board_destroy(board);
+    TEST_END();
+}
+
+TestResults test_classic_saves_probes(void) {
+    TEST_START();
+    TEST_CASE("Classic Phase 3 keeps its target and reports probes");
+
+    SudokuGenerationConfig config = { 0 };
+    SudokuGenerationStats stats;
+    SudokuBoard *board = sudoku_board_create();
+    bool ok = sudoku_generate_ex(board, &config, &stats);
+
+    ASSERT_TRUE(ok && stats.phase3_removed <= 25, "At most 25 Phase 3 removals on 9x9");
+    ASSERT_TRUE(stats.phase3_probes + stats.phase3_probes_saved >= stats.phase3_removed,
+                "Every removal was probed or certified");
+    ASSERT_TRUE(solutions_of(board) == 1, "Still unique");
+
+    sudoku_board_destroy(board);
+    TEST_END();
+}
+
+TestResults test_singles_certificate(void) {
+    TEST_START();
+    TEST_CASE("Removal solved by singles skips the probe");
+
+    SudokuBoard *board = board_from(SINGLES_MINIMAL);
+    ASSERT_TRUE(!single_in_cell(board, EXTRA_ROW, EXTRA_COL, EXTRA_VALUE),
+                "Extra clue is no single in its own cell");
+
+    // Whatever the shuffle, only the extra clue can go: the others are
+    // necessary with or without it. Both keep paths must certify it.
+    for (int minimal = 0; minimal <= 1; minimal++) {
+        sudoku_board_set_cell(board, EXTRA_ROW, EXTRA_COL, EXTRA_VALUE);
+        sudoku_board_update_stats(board);
+        int before = sudoku_board_get_clues(board);
+
+        Phase3Probes probes = { 0 };
+        Phase3Config config = { .max_removals = before, .minimal = minimal,
+                                .probes = &probes };
+        int removed = phase3EliminationEx(board, &config, NULL);
+
+        char message[128];
+        snprintf(message, sizeof(message), "%s: only the extra clue removed",
+                 minimal ? "Minimal" : "Classic");
+        ASSERT_TRUE(removed == 1 && board->cells[EXTRA_ROW][EXTRA_COL] == 0, message);
+        snprintf(message, sizeof(message), "%s: saved %d (expected 1), probes %d (expected %d)",
+                 minimal ? "Minimal" : "Classic", probes.probes_saved, probes.probes, before - 1);
+        ASSERT_TRUE(probes.probes_saved == 1 && probes.probes == before - 1, message);
+        ASSERT_TRUE(solutions_of(board) == 1, "Carved puzzle still has one solution");
+    }
+
+    sudoku_board_destroy(board);
+    TEST_END();
+}
+
+TestResults test_stalled_removals_probe(void) {
+    TEST_START();
+    TEST_CASE("Removals the singles cannot finish reach the solver");
+
+    // Minimal puzzle: no removal is forced or solved by singles (either
+    // would prove it unique), so every decision is a probe
+    SudokuBoard *board = board_from(SINGLES_MINIMAL);
+    int before = sudoku_board_get_clues(board);
+
+    Phase3Probes probes = { 0 };
+    Phase3Config config = { .max_removals = before, .minimal = true, .probes = &probes };
+    int removed = phase3EliminationEx(board, &config, NULL);
+
+    ASSERT_TRUE(removed == 0, "No clue removed from a minimal puzzle");
+    ASSERT_TRUE(probes.probes == before && probes.probes_saved == 0,
+                "Every clue probed, none certified by singles");
+    ASSERT_TRUE(solutions_of(board) == 1, "Still unique");
+
+    sudoku_board_destroy(board);
+    TEST_END();
+}
+
+int main(void) {
+    srand(4242);
+
+    TestResults total = {0, 0, 0};
+    TestResults (*tests[])(void) = {
+        test_minimal_generation, test_probe_accounting, test_classic_saves_probes,
+        test_singles_certificate, test_stalled_removals_probe
+    };
+
+    for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+        TestResults result = tests[i]();
+        total.passed += result.passed;
+        total.failed += result.failed;
+        total.total += result.total;
+    }
+
+    printf("\n");
+    printf("╔═══════════════════════════════════════════════════════════╗\n");
+    printf("║                     TEST SUMMARY                          ║\n");
+    printf("╠═══════════════════════════════════════════════════════════╣\n");
+    printf("║ Passed:       %-3d  ✅                                    ║\n", total.passed);
+    printf("║ Failed:       %-3d  ❌                                    ║\n", total.failed);
+    printf("╚═══════════════════════════════════════════════════════════╝\n");
+
+    return total.failed == 0 ? 0 : 1;
+}
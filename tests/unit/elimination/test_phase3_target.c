@@ -0,0 +1,191 @@
+/**
+ * @file test_phase3_target.c
+ * @brief Test suite for difficulty-targeted Phase 3 elimination
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ * 
+ * WHAT WE'RE TESTING:
+ * - sudoku_generate_with_difficulty() returns puzzles in the requested
+ *   bucket (as graded by sudoku_evaluate_difficulty()), and reports a
+ *   bucket it cannot reach instead of returning another one
+ * - phase3EliminationEx() aborts immediately on a puzzle that is
+ *   already harder than the target, leaving it untouched
+ * - Without targeting, phase3EliminationEx() honours max_removals
+ * 
+ * RUN:
+ *   ./bin/test_elimination_phase3_target
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "sudoku/core/board.h"
+#include "sudoku/core/generator.h"
+#include "sudoku/core/validation.h"
+#include "internal/elimination_internal.h"
+
+// ═══════════════════════════════════════════════════════════════════
+//                    TEST FRAMEWORK UTILITIES
+// ═══════════════════════════════════════════════════════════════════
+
+typedef struct {
+    int passed;
+    int failed;
+    int total;
+} TestResults;
+
+#define TEST_START() TestResults results = {0, 0, 0}
+#define TEST_END() return results
+
+#define TEST_CASE(name) \
+    printf("\n═══════════════════════════════════════════════════════════\n"); \
+    printf("TEST: %s\n", name); \
+    printf("═══════════════════════════════════════════════════════════\n"); \
+    results.total++
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✅ PASS: %s\n", message); \
+            results.passed++; \
+        } else { \
+            printf("  ❌ FAIL: %s\n", message); \
+            results.failed++; \
+        } \
+    } while(0)
+
+/* "AI Escargot": graded EXPERT (logic stalls) */
+static const char *ESCARGOT =
+    "1....7.9." ".3..2...8" "..96..5.." "..53..9.." ".1..8...2"
+    "6....4..." "3......1." ".4......7" "..7...3..";
+
+static SudokuBoard *board_from_string(const char *text) {
+    SudokuBoard *board = sudoku_board_create();
+    for (int i = 0; i < 81; i++) {
+        int v = (text[i] >= '1' && text[i] <= '9') ? text[i] - '0' : 0;
+        sudoku_board_set_cell(board, i / 9, i % 9, v);
+    }
+    sudoku_board_update_stats(board);
+    return board;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    TESTS
+// ═══════════════════════════════════════════════════════════════════
+
+TestResults test_every_bucket(void) {
+    TEST_START();
+    TEST_CASE("sudoku_generate_with_difficulty() hits every bucket");
+    
+    for (int d = SUDOKU_EASY; d <= SUDOKU_EXPERT; d++) {
+        SudokuBoard *board = sudoku_board_create();
+        SudokuGenerationStats stats;
+        char message[128];
+        
+        bool ok = sudoku_generate_with_difficulty(board, (SudokuDifficulty)d, &stats);
+        SudokuDifficulty got = sudoku_evaluate_difficulty(board);
+        
+        snprintf(message, sizeof(message),
+                 "%s requested -> %s (%d clues, %d aborted attempts)",
+                 sudoku_difficulty_to_string((SudokuDifficulty)d),
+                 sudoku_difficulty_to_string(got),
+                 sudoku_board_get_clues(board), stats.difficulty_aborts);
+        ASSERT_TRUE(ok && got == (SudokuDifficulty)d, message);
+        ASSERT_TRUE(countSolutionsExact(board, 2) == 1, "Unique solution");
+        
+        sudoku_board_destroy(board);
+    }
+    
+    ASSERT_TRUE(!sudoku_generate_with_difficulty(NULL, SUDOKU_EASY, NULL),
+                "NULL board rejected");
+    
+    // 4x4 grids never need a search: EXPERT is out of reach
+    SudokuBoard *small = sudoku_board_create_size(2);
+    SudokuGenerationStats stats;
+    bool ok = sudoku_generate_with_difficulty(small, SUDOKU_EXPERT, &stats);
+    sudoku_board_update_stats(small);
+    ASSERT_TRUE(!ok && stats.status == SUDOKU_STATUS_FAILED,
+                "Unreachable bucket reported as FAILED");
+    ASSERT_TRUE(sudoku_board_get_clues(small) == 0,
+                "No puzzle of another difficulty left on the board");
+    sudoku_board_destroy(small);
+    
+    TEST_END();
+}
+
+TestResults test_early_abort(void) {
+    TEST_START();
+    TEST_CASE("phase3EliminationEx() abandons a puzzle already too hard");
+    
+    SudokuBoard *board = board_from_string(ESCARGOT);
+    Phase3Config config = {
+        .max_removals = 81,
+        .use_target_difficulty = true,
+        .target_difficulty = SUDOKU_EASY
+    };
+    Phase3Outcome outcome = PHASE3_COMPLETED;
+    
+    int removed = phase3EliminationEx(board, &config, &outcome);
+    sudoku_board_update_stats(board);
+    
+    ASSERT_TRUE(outcome == PHASE3_TARGET_UNREACHABLE, "Outcome is UNREACHABLE");
+    ASSERT_TRUE(removed == 0, "No cell probed or removed");
+    ASSERT_TRUE(sudoku_board_get_clues(board) == 23, "Board untouched (23 clues)");
+    
+    sudoku_board_destroy(board);
+    TEST_END();
+}
+
+TestResults test_classic_limit(void) {
+    TEST_START();
+    TEST_CASE("phase3EliminationEx() without targeting honours max_removals");
+    
+    // Start from a regular generated puzzle and try a few more removals
+    SudokuBoard *solved = sudoku_board_create();
+    sudoku_generate(solved, NULL);
+    
+    Phase3Config config = { .max_removals = 3 };
+    Phase3Outcome outcome = PHASE3_TARGET_REACHED;
+    int before = sudoku_board_get_clues(solved);
+    int removed = phase3EliminationEx(solved, &config, &outcome);
+    sudoku_board_update_stats(solved);
+    
+    ASSERT_TRUE(removed <= 3, "At most 3 removals");
+    ASSERT_TRUE(outcome == PHASE3_COMPLETED, "Outcome is COMPLETED");
+    ASSERT_TRUE(sudoku_board_get_clues(solved) == before - removed, "Clue count consistent");
+    ASSERT_TRUE(countSolutionsExact(solved, 2) == 1, "Still unique");
+    
+    sudoku_board_destroy(solved);
+    TEST_END();
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    MAIN
+// ═══════════════════════════════════════════════════════════════════
+
+int main(void) {
+    srand(31337);
+    sudoku_random_seed(31337);  // HARD can exhaust its retries on an unlucky stream
+    
+    TestResults total = {0, 0, 0};
+    TestResults (*tests[])(void) = {
+        test_every_bucket, test_early_abort, test_classic_limit
+    };
+    
+    for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+        TestResults result = tests[i]();
+        total.passed += result.passed;
+        total.failed += result.failed;
+        total.total += result.total;
+    }
+    
+    printf("\n");
+    printf("╔═══════════════════════════════════════════════════════════╗\n");
+    printf("║                     TEST SUMMARY                          ║\n");
+    printf("╠═══════════════════════════════════════════════════════════╣\n");
+    printf("║ Passed:       %-3d  ✅                                    ║\n", total.passed);
+    printf("║ Failed:       %-3d  ❌                                    ║\n", total.failed);
+    printf("╚═══════════════════════════════════════════════════════════╝\n");
+    
+    return total.failed == 0 ? 0 : 1;
+}
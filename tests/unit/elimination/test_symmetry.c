@@ -0,0 +1,228 @@
+/**
+ * @file test_symmetry.c
+ * @brief Test suite for symmetric clue-pattern generation
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * WHAT WE'RE TESTING:
+ * - Orbits of every SudokuSymmetry (sizes, fixed cells, one
+ *   representative per orbit)
+ * - Phases 1 and 2 only remove whole orbits
+ * - Generated puzzles have a symmetric clue pattern and a unique
+ *   solution for every symmetry
+ * - Phase 3 makes at most one probe per orbit
+ *
+ * RUN:
+ *   ./bin/test_elimination_symmetry
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "sudoku/core/board.h"
+#include "sudoku/core/generator.h"
+#include "sudoku/core/grader.h"
+#include "internal/elimination_internal.h"
+#include "internal/algorithms_internal.h"
+
+// ═══════════════════════════════════════════════════════════════════
+//                    TEST FRAMEWORK UTILITIES
+// ═══════════════════════════════════════════════════════════════════
+
+typedef struct {
+    int passed;
+    int failed;
+    int total;
+} TestResults;
+
+#define TEST_START() TestResults results = {0, 0, 0}
+#define TEST_END() return results
+
+#define TEST_CASE(name) \
+    printf("\n═══════════════════════════════════════════════════════════\n"); \
+    printf("TEST: %s\n", name); \
+    printf("═══════════════════════════════════════════════════════════\n"); \
+    results.total++
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (condition) { \
+            printf("  ✅ PASS: %s\n", message); \
+            results.passed++; \
+        } else { \
+            printf("  ❌ FAIL: %s\n", message); \
+            results.failed++; \
+        } \
+    } while(0)
+
+static const SudokuSymmetry ALL_SYMMETRIES[] = {
+    SUDOKU_SYMMETRY_ROTATE_180, SUDOKU_SYMMETRY_ROTATE_90, SUDOKU_SYMMETRY_DIAGONAL,
+    SUDOKU_SYMMETRY_MIRROR_HORIZONTAL, SUDOKU_SYMMETRY_MIRROR_VERTICAL
+};
+#define SYMMETRY_COUNT (int)(sizeof(ALL_SYMMETRIES) / sizeof(ALL_SYMMETRIES[0]))
+
+/**
+ * @brief true if every orbit is entirely filled or entirely empty
+ */
+static bool pattern_is_symmetric(const SudokuBoard *board, SudokuSymmetry symmetry) {
+    int n = board->board_size;
+    for (int r = 0; r < n; r++) {
+        for (int c = 0; c < n; c++) {
+            SudokuPosition orbit[SYMMETRY_ORBIT_MAX];
+            int size = symmetry_orbit(n, symmetry, r, c, orbit);
+            for (int k = 1; k < size; k++) {
+                if ((board->cells[r][c] == 0) != (board->cells[orbit[k].row][orbit[k].col] == 0)) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+static int solutions_of(const SudokuBoard *board) {
+    SudokuGradeResult grade;
+    if (!sudoku_grade_puzzle(board, &grade)) {
+        return -1;
+    }
+    return grade.solutions;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    TESTS
+// ═══════════════════════════════════════════════════════════════════
+
+TestResults test_orbits(void) {
+    TEST_START();
+    TEST_CASE("Orbit sizes and representatives (9x9)");
+
+    SudokuPosition orbit[SYMMETRY_ORBIT_MAX];
+    ASSERT_TRUE(symmetry_orbit(9, SUDOKU_SYMMETRY_NONE, 2, 5, orbit) == 1,
+                "NONE: orbit of size 1");
+    ASSERT_TRUE(symmetry_orbit(9, SUDOKU_SYMMETRY_ROTATE_180, 0, 1, orbit) == 2 &&
+                orbit[1].row == 8 && orbit[1].col == 7,
+                "ROTATE_180: (0,1) <-> (8,7)");
+    ASSERT_TRUE(symmetry_orbit(9, SUDOKU_SYMMETRY_ROTATE_180, 4, 4, orbit) == 1,
+                "ROTATE_180: centre is fixed");
+    ASSERT_TRUE(symmetry_orbit(9, SUDOKU_SYMMETRY_ROTATE_90, 0, 1, orbit) == 4,
+                "ROTATE_90: orbits of 4 cells");
+    ASSERT_TRUE(symmetry_orbit(9, SUDOKU_SYMMETRY_DIAGONAL, 3, 3, orbit) == 1 &&
+                symmetry_orbit(9, SUDOKU_SYMMETRY_DIAGONAL, 3, 6, orbit) == 2,
+                "DIAGONAL: diagonal fixed, (3,6) <-> (6,3)");
+
+    // Each cell belongs to exactly one orbit with exactly one representative
+    bool partition = true;
+    for (int s = 0; s < SYMMETRY_COUNT; s++) {
+        int covered = 0;
+        for (int r = 0; r < 9; r++) {
+            for (int c = 0; c < 9; c++) {
+                if (symmetry_is_representative(9, ALL_SYMMETRIES[s], r, c)) {
+                    covered += symmetry_orbit(9, ALL_SYMMETRIES[s], r, c, orbit);
+                }
+            }
+        }
+        partition = partition && covered == 81;
+    }
+    ASSERT_TRUE(partition, "Representatives' orbits cover the 81 cells exactly once");
+
+    TEST_END();
+}
+
+TestResults test_phases_keep_symmetry(void) {
+    TEST_START();
+    TEST_CASE("Phases 1 and 2 remove whole orbits");
+
+    bool symmetric = true;
+    bool removed_any = true;
+    bool unique = true;
+    int indices[9] = { 0, 1, 2, 3, 4, 5, 6, 7, 8 };
+    for (int s = 0; s < SYMMETRY_COUNT; s++) {
+        SudokuBoard *board = sudoku_board_create();
+        sudoku_complete_backtracking(board);
+
+        int removed = phase1EliminationEx(board, indices, 9, ALL_SYMMETRIES[s]);
+        symmetric = symmetric && pattern_is_symmetric(board, ALL_SYMMETRIES[s]);
+        int round;
+        while ((round = phase2EliminationEx(board, indices, 9, ALL_SYMMETRIES[s])) > 0) {
+            removed += round;
+            symmetric = symmetric && pattern_is_symmetric(board, ALL_SYMMETRIES[s]);
+        }
+
+        removed_any = removed_any && removed > 0;
+        unique = unique && solutions_of(board) == 1;
+        sudoku_board_destroy(board);
+    }
+    ASSERT_TRUE(removed_any, "Phases 1-2 still remove cells");
+    ASSERT_TRUE(symmetric, "Pattern symmetric after every phase and round");
+    ASSERT_TRUE(unique, "Solution still unique (forced removals only)");
+
+    TEST_END();
+}
+
+TestResults test_symmetric_generation(void) {
+    TEST_START();
+    TEST_CASE("Symmetric puzzles are unique, one probe per orbit");
+
+    const int puzzles = 4;
+    bool all_ok = true;
+    bool probe_bound = true;
+    for (int s = 0; s < SYMMETRY_COUNT; s++) {
+        SudokuGenerationConfig config = { .symmetry = ALL_SYMMETRIES[s] };
+        for (int i = 0; i < puzzles; i++) {
+            SudokuBoard *board = sudoku_board_create();
+            SudokuGenerationStats stats;
+            bool ok = sudoku_generate_ex(board, &config, &stats);
+            all_ok = all_ok && ok && pattern_is_symmetric(board, ALL_SYMMETRIES[s]) &&
+                     solutions_of(board) == 1;
+
+            // Every decision covers one orbit, and there are fewer orbits than cells
+            int orbits = 0;
+            for (int r = 0; r < 9; r++) {
+                for (int c = 0; c < 9; c++) {
+                    orbits += symmetry_is_representative(9, ALL_SYMMETRIES[s], r, c);
+                }
+            }
+            probe_bound = probe_bound &&
+                          stats.phase3_probes + stats.phase3_probes_saved <= orbits;
+            sudoku_board_destroy(board);
+        }
+    }
+    ASSERT_TRUE(all_ok, "20 symmetric 9x9 puzzles with a unique solution");
+    ASSERT_TRUE(probe_bound, "Phase 3 decisions bounded by the number of orbits");
+
+    SudokuBoard *small = sudoku_board_create_size(2);
+    SudokuGenerationConfig config = { .symmetry = SUDOKU_SYMMETRY_ROTATE_90 };
+    bool ok = sudoku_generate_ex(small, &config, NULL);
+    ASSERT_TRUE(ok && pattern_is_symmetric(small, SUDOKU_SYMMETRY_ROTATE_90) &&
+                solutions_of(small) == 1,
+                "4x4 quarter-turn puzzle");
+    sudoku_board_destroy(small);
+
+    TEST_END();
+}
+
+int main(void) {
+    srand(2024);
+
+    TestResults total = {0, 0, 0};
+    TestResults (*tests[])(void) = {
+        test_orbits, test_phases_keep_symmetry, test_symmetric_generation
+    };
+
+    for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++) {
+        TestResults result = tests[i]();
+        total.passed += result.passed;
+        total.failed += result.failed;
+        total.total += result.total;
+    }
+
+    printf("\n");
+    printf("╔═══════════════════════════════════════════════════════════╗\n");
+    printf("║                     TEST SUMMARY                          ║\n");
+    printf("╠═══════════════════════════════════════════════════════════╣\n");
+    printf("║ Passed:       %-3d  ✅                                    ║\n", total.passed);
+    printf("║ Failed:       %-3d  ❌                                    ║\n", total.failed);
+    printf("╚═══════════════════════════════════════════════════════════╝\n");
+
+    return total.failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,211 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include "sudoku/core/board.h"
+#include "sudoku/core/validation.h"
+#include "sudokud_protocol.h"
+#include "pool.h"
+#include "server.h"
+
+/* ================================================================
+                   FUNCIONES AUXILIARES DE TEST
+   ================================================================ */
+
+typedef struct {
+    int passed;
+    int failed;
+    int total;
+} TestResults;
+
+TestResults results = {0, 0, 0};
+
+#define TEST_ASSERT(condition, message) do { \
+    results.total++; \
+    if(condition) { \
+        printf("  [PASS] %s\n", message); \
+        results.passed++; \
+    } else { \
+        printf("  [FAIL] %s\n", message); \
+        results.failed++; \
+    } \
+} while(0)
+
+/* Un SudokudServer ocupa decenas de KB: fuera de la pila */
+static SudokudServer server;
+
+/* Respuesta recibida: cabecera y copia del payload */
+typedef struct {
+    SudokudReplyHeader header;
+    uint8_t *payload;
+} Reply;
+
+static void send_request(int fd, uint8_t type, uint8_t k, uint8_t difficulty, uint32_t count) {
+    SudokudRequest req = { type, k, difficulty, count };
+    uint8_t bytes[SUDOKUD_REQUEST_SIZE];
+    sudokud_encode_request(bytes, &req);
+    ssize_t written = write(fd, bytes, sizeof(bytes));
+    (void)written;
+}
+
+/*
+ * Hace girar el bucle del servidor y lee del otro extremo hasta tener
+ * @p wanted respuestas completas o agotar @p seconds
+ */
+static int collect_replies(int fd, Reply *replies, int wanted, int seconds) {
+    static uint8_t buffer[1 << 16];
+    size_t used = 0;
+    int parsed = 0;
+    time_t limit = time(NULL) + seconds;
+
+    while (parsed < wanted && time(NULL) < limit) {
+        server_poll(&server, 20);
+        ssize_t n = recv(fd, buffer + used, sizeof(buffer) - used, MSG_DONTWAIT);
+        if (n > 0) {
+            used += (size_t)n;
+        }
+        for (;;) {
+            if (used < SUDOKUD_REPLY_HEADER_SIZE) break;
+            SudokudReplyHeader h;
+            sudokud_decode_reply(buffer, &h);
+            size_t size = SUDOKUD_REPLY_HEADER_SIZE + h.payload_size;
+            if (used < size) break;
+            replies[parsed].header = h;
+            replies[parsed].payload = malloc(h.payload_size + 1);
+            memcpy(replies[parsed].payload, buffer + SUDOKUD_REPLY_HEADER_SIZE, h.payload_size);
+            replies[parsed].payload[h.payload_size] = 0;
+            parsed++;
+            memmove(buffer, buffer + size, used - size);
+            used -= size;
+        }
+    }
+    return parsed;
+}
+
+/* ¿Son @p count puzzles 4x4 válidos y de solución única? */
+static bool puzzles_valid(const uint8_t *payload, int count) {
+    SudokuBoard *board = sudoku_board_create_size(2);
+    bool ok = board != NULL;
+    for (int p = 0; p < count && ok; p++) {
+        sudoku_board_init(board);
+        for (int i = 0; i < 16; i++) {
+            if (payload[p * 16 + i] > 4) ok = false;
+            sudoku_board_set_cell(board, i / 4, i % 4, payload[p * 16 + i]);
+        }
+        ok = ok && countSolutionsExact(board, 2) == 1;
+    }
+    sudoku_board_destroy(board);
+    return ok;
+}
+
+/* ================================================================
+                         TESTS
+   ================================================================ */
+
+void test_protocol_round_trip(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 1: Request and reply encode/decode round trip\n");
+    printf("===============================================================\n");
+
+    uint8_t bytes[SUDOKUD_REPLY_HEADER_SIZE];
+    SudokudRequest req = { SUDOKUD_REQ_GET, 4, SUDOKU_HARD, 0x01020304u };
+    SudokudRequest back;
+    sudokud_encode_request(bytes, &req);
+    sudokud_decode_request(bytes, &back);
+
+    TEST_ASSERT(back.type == req.type && back.subgrid_size == 4 &&
+                back.difficulty == SUDOKU_HARD && back.count == req.count,
+                "Request survives encode/decode");
+    TEST_ASSERT(bytes[3] == 0 && bytes[4] == 0x04 && bytes[7] == 0x01,
+                "Reserved byte is zero and count is little-endian");
+
+    SudokudReplyHeader h = { SUDOKUD_REQ_STATS, SUDOKUD_FAILED, 3, SUDOKU_EASY,
+                             0xdeadbeefu, 0x00c0ffeeu };
+    SudokudReplyHeader h2;
+    sudokud_encode_reply(bytes, &h);
+    sudokud_decode_reply(bytes, &h2);
+    TEST_ASSERT(memcmp(&h, &h2, sizeof(h)) == 0, "Reply header survives encode/decode");
+    TEST_ASSERT(bytes[8] == 0xee && bytes[11] == 0x00, "Payload size is little-endian");
+}
+
+void test_pipelined_exchange(void) {
+    printf("\n===============================================================\n");
+    printf("TEST 2: Pipelined GET/STATS/PING over a socketpair\n");
+    printf("===============================================================\n");
+
+    /* Pools de 4 puzzles: un GET de 10 tiene que esperar a los hilos */
+    int sizes[1] = { 2 };
+    PoolSet pools;
+    int fds[2];
+    bool started = poolset_start(&pools, sizes, 1, 4, 1);
+    TEST_ASSERT(started, "Pools started");
+    if (!started) return;
+    TEST_ASSERT(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0, "Socketpair created");
+
+    server_init(&server, &pools, -1);
+    TEST_ASSERT(server_add_client(&server, fds[0]), "Client added");
+
+    /* Todo enviado antes de leer nada */
+    send_request(fds[1], SUDOKUD_REQ_PING, 0, 0, 0);
+    send_request(fds[1], SUDOKUD_REQ_GET, 2, SUDOKU_EASY, 10);
+    send_request(fds[1], SUDOKUD_REQ_STATS, 0, 0, 0);
+    send_request(fds[1], SUDOKUD_REQ_GET, 3, SUDOKU_EASY, 1);      // 9x9 no servido
+    send_request(fds[1], SUDOKUD_REQ_GET, 2, SUDOKU_EXPERT, 1);    // inalcanzable en 4x4
+    send_request(fds[1], SUDOKUD_REQ_PING, 0, 0, 0);
+
+    Reply replies[6];
+    int got = collect_replies(fds[1], replies, 6, 30);
+    TEST_ASSERT(got == 6, "Six replies received");
+
+    if (got == 6) {
+        TEST_ASSERT(replies[0].header.type == SUDOKUD_REQ_PING &&
+                    replies[1].header.type == SUDOKUD_REQ_GET &&
+                    replies[2].header.type == SUDOKUD_REQ_STATS &&
+                    replies[5].header.type == SUDOKUD_REQ_PING,
+                    "Replies come back in request order");
+        TEST_ASSERT(replies[1].header.status == SUDOKUD_OK &&
+                    replies[1].header.count == 10 &&
+                    replies[1].header.payload_size == 10 * 16,
+                    "GET larger than the pool is completed once the workers refill it");
+        TEST_ASSERT(puzzles_valid(replies[1].payload, 10), "Served puzzles have a unique solution");
+        TEST_ASSERT(replies[2].header.status == SUDOKUD_OK &&
+                    strstr((char *)replies[2].payload, "pool 4x4") != NULL,
+                    "STATS lists the pools");
+        TEST_ASSERT(replies[3].header.status == SUDOKUD_BAD_REQUEST, "Unserved size rejected");
+        TEST_ASSERT(replies[4].header.status == SUDOKUD_FAILED && replies[4].header.count == 0,
+                    "Unreachable pool answers FAILED instead of blocking");
+    }
+    for (int i = 0; i < got; i++) free(replies[i].payload);
+
+    server_close(&server);
+    close(fds[1]);
+    poolset_stop(&pools);
+}
+
+int main(void) {
+    printf("===============================================================\n");
+    printf("       SUDOKUD PROTOCOL AND SERVER TEST\n");
+    printf("===============================================================\n");
+
+    test_protocol_round_trip();
+    test_pipelined_exchange();
+
+    printf("\n===============================================================\n");
+    printf("                    TEST SUMMARY\n");
+    printf("===============================================================\n");
+    printf("  Total tests:  %d\n", results.total);
+    printf("  Passed:       %d\n", results.passed);
+    printf("  Failed:       %d\n", results.failed);
+
+    if(results.failed == 0) {
+        printf("\n  *** ALL TESTS PASSED ***\n");
+    } else {
+        printf("\n  *** SOME TESTS FAILED ***\n");
+    }
+    printf("===============================================================\n");
+
+    return results.failed > 0 ? 1 : 0;
+}
@@ -12,7 +12,6 @@
 
 #include <stdio.h>
 #include <stdlib.h>
-#include <time.h>
 
 // Include ONLY public headers from the library
 #include "sudoku/core/board.h"
@@ -186,8 +185,7 @@ int main(int argc, char *argv[]) {
         system("chcp 65001 > nul");
     #endif
     
-    // Initialize random number generator
-    srand((unsigned int)time(NULL));
+    // No srand(): the library seeds its own per-thread generator
     
     // Default verbosity level (1 = compact mode)
     int verbosity_level = 1;
@@ -241,11 +239,15 @@ int main(int argc, char *argv[]) {
             printf("🚀 ATTEMPT #%d:\n", attempt);
         }
         
-        // Configure generation with callback
+        // Configure generation with callback. Only subscribe to what
+        // this verbosity level prints: per-cell events are not even
+        // built by the library unless we show them (level 2).
         SudokuGenerationConfig config = {
-            .callback = generation_callback,
+            .callback = (verbosity_level > 0) ? generation_callback : NULL,
             .user_data = &verbosity_level,  // Pass verbosity to callback
-            .max_attempts = 0
+            .max_attempts = 0,
+            .event_mask = (verbosity_level == 2) ? SUDOKU_EVENT_MASK_ALL
+                                                 : SUDOKU_EVENT_MASK_PHASES
         };
         
         // Call the library's generation function WITH CALLBACK SUPPORT
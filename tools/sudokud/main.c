@@ -0,0 +1,190 @@
+/**
+ * @file main.c
+ * @brief sudokud - serve pre-generated puzzles over a Unix domain socket
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * Generating a HARD or EXPERT puzzle can take hundreds of attempts, so
+ * a service that generates per request has long and unpredictable tail
+ * latency. sudokud keeps one warm pool per (size, difficulty), refilled
+ * in the background (pool.c), and answers requests by copying puzzles
+ * out of memory.
+ *
+ * The poll() loop that serves the clients lives in server.c; this file
+ * parses the command line, opens the socket and runs the loop until
+ * SIGINT or SIGTERM. The wire format is documented in
+ * sudokud_protocol.h.
+ *
+ * USAGE:
+ *   sudokud [-S socket] [-s sizes] [-p capacity] [-j threads]
+ *
+ *   -S  socket path (default /tmp/sudokud.sock)
+ *   -s  comma-separated subgrid sizes to serve (default 2,3)
+ *   -p  puzzles kept per pool (default 64)
+ *   -j  generator threads (default 1)
+ */
+
+#define _GNU_SOURCE     // SOCK_NONBLOCK, SOCK_CLOEXEC
+
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "pool.h"
+#include "server.h"
+#include "sudokud_protocol.h"
+
+static volatile sig_atomic_t stop_requested = 0;
+
+static void on_signal(int signo) {
+    (void)signo;
+    stop_requested = 1;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    LISTENER
+// ═══════════════════════════════════════════════════════════════════
+
+static int open_listener(const char *path) {
+    struct sockaddr_un addr;
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "sudokud: socket path too long: %s\n", path);
+        return -1;
+    }
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        perror("sudokud: socket");
+        return -1;
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    unlink(path);       // Stale socket from a previous run
+
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(fd, 64) < 0) {
+        fprintf(stderr, "sudokud: cannot listen on %s: %s\n", path, strerror(errno));
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    COMMAND LINE
+// ═══════════════════════════════════════════════════════════════════
+
+static void print_usage(const char *prog) {
+    fprintf(stderr,
+            "Usage: %s [-S socket] [-s sizes] [-p capacity] [-j threads]\n"
+            "  -S  socket path (default %s)\n"
+            "  -s  comma-separated subgrid sizes, 2..5 (default 2,3)\n"
+            "  -p  puzzles kept per pool (default 64)\n"
+            "  -j  generator threads (default 1)\n",
+            prog, SUDOKUD_DEFAULT_SOCKET);
+}
+
+/**
+ * @brief Parse "2,3,4" into @p sizes
+ *
+ * @return Number of sizes, or -1 if the list is invalid
+ */
+static int parse_sizes(const char *text, int *sizes, int capacity) {
+    int count = 0;
+    const char *p = text;
+    while (*p != '\0') {
+        char *end;
+        long k = strtol(p, &end, 10);
+        if (end == p || k < 2 || k > 5 || count == capacity) {
+            return -1;
+        }
+        sizes[count++] = (int)k;
+        p = (*end == ',') ? end + 1 : end;
+        if (*end != ',' && *end != '\0') {
+            return -1;
+        }
+    }
+    return count;
+}
+
+int main(int argc, char *argv[]) {
+    const char *socket_path = SUDOKUD_DEFAULT_SOCKET;
+    int sizes[4] = { 2, 3 };
+    int size_count = 2;
+    int capacity = 64;
+    int threads = 1;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "S:s:p:j:h")) != -1) {
+        switch (opt) {
+            case 'S':
+                socket_path = optarg;
+                break;
+            case 's':
+                size_count = parse_sizes(optarg, sizes, 4);
+                if (size_count <= 0) {
+                    fprintf(stderr, "sudokud: invalid size list: %s\n", optarg);
+                    return 1;
+                }
+                break;
+            case 'p':
+                capacity = atoi(optarg);
+                break;
+            case 'j':
+                threads = atoi(optarg);
+                break;
+            default:
+                print_usage(argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (capacity <= 0 || threads <= 0) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = on_signal;
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    int listener = open_listener(socket_path);
+    if (listener < 0) {
+        return 1;
+    }
+
+    PoolSet pools;
+    if (!poolset_start(&pools, sizes, size_count, capacity, threads)) {
+        fprintf(stderr, "sudokud: could not start the puzzle pools\n");
+        close(listener);
+        unlink(socket_path);
+        return 1;
+    }
+
+    fprintf(stderr, "sudokud: listening on %s (%d pools × %d puzzles, %d threads)\n",
+            socket_path, pools.pool_count, capacity, pools.worker_count);
+    SudokudServer *server = malloc(sizeof(SudokudServer));
+    if (server != NULL) {
+        server_init(server, &pools, listener);
+        while (!stop_requested && server_poll(server, -1)) {
+        }
+        server_close(server);
+        free(server);
+    } else {
+        fprintf(stderr, "sudokud: out of memory\n");
+    }
+
+    fprintf(stderr, "sudokud: shutting down\n");
+    close(listener);
+    unlink(socket_path);
+    poolset_stop(&pools);
+    return 0;
+}
@@ -0,0 +1,374 @@
+/**
+ * @file pool.c
+ * @brief Warm puzzle pools and their generator threads
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * See pool.h.
+ */
+
+#define _POSIX_C_SOURCE 200809L    // clock_gettime(), pthread_condattr_setclock()
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "pool.h"
+#include "sudoku/core/board.h"
+#include "sudoku/core/generator.h"
+#include "sudoku/core/cancel.h"
+#include "sudoku/core/arena.h"
+
+/** @brief Difficulty-targeted attempts before a generation counts as failed */
+#define POOL_MAX_GENERATIONS 200
+
+/** @brief Wait before retrying a pool whose round failed, doubled per failure */
+#define POOL_RETRY_MIN_MS 1000
+#define POOL_RETRY_MAX_MS 60000
+
+static const SudokuDifficulty pool_difficulties[] = {
+    SUDOKU_EASY, SUDOKU_MEDIUM, SUDOKU_HARD, SUDOKU_EXPERT
+};
+#define POOL_DIFFICULTIES ((int)(sizeof(pool_difficulties) / sizeof(pool_difficulties[0])))
+
+// ═══════════════════════════════════════════════════════════════════
+//                    GENERATION
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Generate one puzzle of the pool's kind into @p out
+ *
+ * Same retry loop as sudoku_generate_with_difficulty(), but every
+ * attempt watches @p cancel so that shutdown does not wait for it.
+ */
+static bool pool_generate(const PuzzlePool *pool, SudokuBoard *board,
+                          SudokuCancelToken *cancel, uint8_t *out) {
+    SudokuGenerationConfig config = {
+        .use_target_difficulty = true,
+        .target_difficulty = pool->difficulty,
+        .cancel = cancel
+    };
+
+    for (int attempt = 0; attempt < POOL_MAX_GENERATIONS; attempt++) {
+        SudokuStatus status = sudoku_generate_with_status(board, &config, NULL);
+        if (status == SUDOKU_STATUS_OK) {
+            const int *cells = board->cells[0];
+            for (int i = 0; i < pool->cells; i++) {
+                out[i] = (uint8_t)cells[i];
+            }
+            return true;
+        }
+        if (status != SUDOKU_STATUS_FAILED) {
+            return false;       // Cancelled: the daemon is stopping
+        }
+    }
+    return false;
+}
+
+static uint64_t monotonic_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Tell the server loop that a pool with waiters changed
+ *
+ * The pipe is non-blocking: when it is full a wake-up is already
+ * pending, so a failed write loses nothing.
+ *
+ * @pre set->lock held
+ */
+static void pool_wake(PoolSet *set, const PuzzlePool *pool) {
+    if (pool->waiters > 0) {
+        ssize_t written = write(set->wake_pipe[1], "w", 1);
+        (void)written;
+    }
+}
+
+/**
+ * @brief Pool that most needs a puzzle (lowest fill ratio), or NULL if all are full
+ *
+ * Pools waiting out a retry delay are skipped; the earliest retry time
+ * among them goes to @p next_retry_ns (0 if none).
+ *
+ * @pre set->lock held
+ */
+static PuzzlePool* neediest_pool(PoolSet *set, uint64_t now, uint64_t *next_retry_ns) {
+    PuzzlePool *best = NULL;
+    *next_retry_ns = 0;
+    for (int i = 0; i < set->pool_count; i++) {
+        PuzzlePool *p = &set->pools[i];
+        int level = p->count + p->in_flight;
+        if (level >= p->capacity) {
+            continue;
+        }
+        if (p->unreachable && p->retry_at_ns > now) {
+            if (*next_retry_ns == 0 || p->retry_at_ns < *next_retry_ns) {
+                *next_retry_ns = p->retry_at_ns;
+            }
+            continue;
+        }
+        // level / p->capacity < best level / best->capacity
+        if (best == NULL || (long)level * best->capacity <
+                            (long)(best->count + best->in_flight) * p->capacity) {
+            best = p;
+        }
+    }
+    return best;
+}
+
+static void pool_push(PuzzlePool *pool, const uint8_t *puzzle) {
+    int tail = (pool->head + pool->count) % pool->capacity;
+    memcpy(pool->slots + (size_t)tail * pool->cells, puzzle, pool->cells);
+    pool->count++;
+    pool->generated++;
+}
+
+/**
+ * @brief Generator thread: refill the emptiest pool, sleep when all are full
+ *
+ * With failed pools pending a retry, the sleep ends at the earliest
+ * retry time.
+ */
+static void* pool_worker(void *arg) {
+    PoolSet *set = arg;
+    uint8_t *puzzle = NULL;
+    SudokuBoard *boards[6] = { NULL };      // One board per subgrid size, on demand
+
+    pthread_mutex_lock(&set->lock);
+    while (!set->stopping) {
+        uint64_t next_retry_ns;
+        PuzzlePool *pool = neediest_pool(set, monotonic_ns(), &next_retry_ns);
+        if (pool == NULL) {
+            if (next_retry_ns == 0) {
+                pthread_cond_wait(&set->need_work, &set->lock);
+            } else {
+                struct timespec until = {
+                    .tv_sec = (time_t)(next_retry_ns / 1000000000u),
+                    .tv_nsec = (long)(next_retry_ns % 1000000000u)
+                };
+                pthread_cond_timedwait(&set->need_work, &set->lock, &until);
+            }
+            continue;
+        }
+
+        // Reserve the slot so other workers pick another pool meanwhile
+        pool->in_flight++;
+        pthread_mutex_unlock(&set->lock);
+
+        int k = pool->subgrid_size;
+        if (boards[k] == NULL) {
+            boards[k] = sudoku_board_create_size(k);
+        }
+        uint8_t *grown = realloc(puzzle, pool->cells);
+        bool ok = boards[k] != NULL && grown != NULL;
+        puzzle = (grown != NULL) ? grown : puzzle;
+        ok = ok && pool_generate(pool, boards[k], set->cancel, puzzle);
+
+        pthread_mutex_lock(&set->lock);
+        pool->in_flight--;
+        if (ok) {
+            pool_push(pool, puzzle);
+            pool->unreachable = false;
+            pool->retry_delay_ms = POOL_RETRY_MIN_MS;
+            pool_wake(set, pool);
+        } else if (!set->stopping) {
+            pool->failures++;
+            pool->unreachable = true;
+            pool->retry_at_ns = monotonic_ns() + (uint64_t)pool->retry_delay_ms * 1000000u;
+            pool->retry_delay_ms = (pool->retry_delay_ms * 2 < POOL_RETRY_MAX_MS)
+                                 ? pool->retry_delay_ms * 2 : POOL_RETRY_MAX_MS;
+            pool_wake(set, pool);   // Parked GETs fail now
+        }
+    }
+    pthread_mutex_unlock(&set->lock);
+
+    for (int k = 0; k < 6; k++) {
+        sudoku_board_destroy(boards[k]);
+    }
+    free(puzzle);
+    sudoku_arena_thread_cleanup();
+    return NULL;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    LIFECYCLE
+// ═══════════════════════════════════════════════════════════════════
+
+bool poolset_start(PoolSet *set, const int *sizes, int size_count,
+                   int capacity, int workers) {
+    memset(set, 0, sizeof(*set));
+    set->wake_pipe[0] = set->wake_pipe[1] = -1;
+    if (size_count <= 0 || capacity <= 0 || workers <= 0) {
+        return false;
+    }
+
+    if (pipe(set->wake_pipe) < 0) {
+        set->wake_pipe[0] = set->wake_pipe[1] = -1;
+        return false;
+    }
+    for (int i = 0; i < 2; i++) {
+        fcntl(set->wake_pipe[i], F_SETFL, O_NONBLOCK);
+        fcntl(set->wake_pipe[i], F_SETFD, FD_CLOEXEC);
+    }
+
+    set->pools = calloc((size_t)size_count * POOL_DIFFICULTIES, sizeof(PuzzlePool));
+    set->workers = calloc((size_t)workers, sizeof(pthread_t));
+    set->cancel = sudoku_cancel_token_create();
+    if (set->pools == NULL || set->workers == NULL || set->cancel == NULL) {
+        poolset_stop(set);
+        return false;
+    }
+
+    for (int s = 0; s < size_count; s++) {
+        int n = sizes[s] * sizes[s];
+        for (int d = 0; d < POOL_DIFFICULTIES; d++) {
+            PuzzlePool *p = &set->pools[set->pool_count++];
+            p->subgrid_size = sizes[s];
+            p->difficulty = pool_difficulties[d];
+            p->cells = n * n;
+            p->capacity = capacity;
+            p->retry_delay_ms = POOL_RETRY_MIN_MS;
+            p->slots = malloc((size_t)capacity * p->cells);
+            if (p->slots == NULL) {
+                poolset_stop(set);
+                return false;
+            }
+        }
+    }
+
+    // Retry deadlines are CLOCK_MONOTONIC times
+    pthread_condattr_t cond_attr;
+    pthread_condattr_init(&cond_attr);
+    pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+    pthread_mutex_init(&set->lock, NULL);
+    pthread_cond_init(&set->need_work, &cond_attr);
+    pthread_condattr_destroy(&cond_attr);
+    for (int i = 0; i < workers; i++) {
+        if (pthread_create(&set->workers[i], NULL, pool_worker, set) != 0) {
+            fprintf(stderr, "sudokud: could not start generator thread %d\n", i);
+            break;
+        }
+        set->worker_count++;
+    }
+    if (set->worker_count == 0) {
+        poolset_stop(set);
+        return false;
+    }
+    return true;
+}
+
+void poolset_stop(PoolSet *set) {
+    if (set->worker_count > 0) {
+        pthread_mutex_lock(&set->lock);
+        set->stopping = true;
+        pthread_cond_broadcast(&set->need_work);
+        pthread_mutex_unlock(&set->lock);
+        sudoku_cancel_token_cancel(set->cancel);
+
+        for (int i = 0; i < set->worker_count; i++) {
+            pthread_join(set->workers[i], NULL);
+        }
+        pthread_cond_destroy(&set->need_work);
+        pthread_mutex_destroy(&set->lock);
+    }
+
+    for (int i = 0; i < set->pool_count; i++) {
+        free(set->pools[i].slots);
+    }
+    free(set->pools);
+    free(set->workers);
+    for (int i = 0; i < 2; i++) {
+        if (set->wake_pipe[i] >= 0) {
+            close(set->wake_pipe[i]);
+        }
+    }
+    sudoku_cancel_token_destroy(set->cancel);
+    memset(set, 0, sizeof(*set));
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    SERVING
+// ═══════════════════════════════════════════════════════════════════
+
+PuzzlePool* poolset_find(PoolSet *set, int subgrid_size, int difficulty) {
+    for (int i = 0; i < set->pool_count; i++) {
+        if (set->pools[i].subgrid_size == subgrid_size &&
+            (int)set->pools[i].difficulty == difficulty) {
+            return &set->pools[i];
+        }
+    }
+    return NULL;
+}
+
+int poolset_take(PoolSet *set, PuzzlePool *pool, uint8_t *out, int count,
+                 bool *unreachable) {
+    pthread_mutex_lock(&set->lock);
+    int ready = 0;
+    while (ready < count && pool->count > 0) {
+        memcpy(out + (size_t)ready * pool->cells,
+               pool->slots + (size_t)pool->head * pool->cells, pool->cells);
+        pool->head = (pool->head + 1) % pool->capacity;
+        pool->count--;
+        ready++;
+    }
+    pool->served += ready;
+    if (ready > 0) {
+        pthread_cond_broadcast(&set->need_work);
+    }
+    if (unreachable != NULL) {
+        *unreachable = pool->unreachable;
+    }
+    pthread_mutex_unlock(&set->lock);
+    return ready;
+}
+
+void poolset_wait(PoolSet *set, PuzzlePool *pool, int delta) {
+    pthread_mutex_lock(&set->lock);
+    pool->waiters += delta;
+    if (delta > 0) {
+        pool->misses++;
+    }
+    pthread_mutex_unlock(&set->lock);
+}
+
+int poolset_wake_fd(const PoolSet *set) {
+    return set->wake_pipe[0];
+}
+
+void poolset_drain_wake(PoolSet *set) {
+    char sink[64];
+    while (read(set->wake_pipe[0], sink, sizeof(sink)) > 0) {
+        // Only the wake-up matters, not how many bytes
+    }
+}
+
+size_t poolset_format_stats(PoolSet *set, char *buffer, size_t capacity) {
+    size_t used = 0;
+    pthread_mutex_lock(&set->lock);
+
+    int written = snprintf(buffer, capacity, "pools %d\ngenerator_threads %d\n",
+                           set->pool_count, set->worker_count);
+    used = (written > 0) ? (size_t)written : 0;
+
+    for (int i = 0; i < set->pool_count && used < capacity; i++) {
+        const PuzzlePool *p = &set->pools[i];
+        int n = p->subgrid_size * p->subgrid_size;
+        written = snprintf(buffer + used, capacity - used,
+                           "pool %dx%d %s available %d capacity %d waiters %d unreachable %d "
+                           "served %llu generated %llu misses %llu failures %llu\n",
+                           n, n, sudoku_difficulty_to_string(p->difficulty),
+                           p->count, p->capacity, p->waiters, p->unreachable ? 1 : 0,
+                           (unsigned long long)p->served,
+                           (unsigned long long)p->generated,
+                           (unsigned long long)p->misses,
+                           (unsigned long long)p->failures);
+        used += (written > 0) ? (size_t)written : 0;
+    }
+
+    pthread_mutex_unlock(&set->lock);
+    return used < capacity ? used : capacity;
+}
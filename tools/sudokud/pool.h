@@ -0,0 +1,134 @@
+/**
+ * @file pool.h
+ * @brief Warm puzzle pools of sudokud, refilled by background threads
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * One pool per (subgrid size, difficulty) pair. A pool is a ring of
+ * ready puzzles, stored as board_size² bytes each. Generator threads
+ * keep refilling whichever pool is emptiest (relative to its capacity)
+ * and sleep when all of them are full; taking puzzles wakes them.
+ *
+ * Nothing generates on the caller's thread: a GET that finds a pool
+ * short (a "miss") registers as a waiter and takes the rest as the
+ * workers produce it. Workers write a byte to wake_fd whenever a pool
+ * with waiters gains puzzles or fails, so the server's poll() loop can
+ * sleep on it instead of blocking in a generation.
+ *
+ * Not every bucket exists at every size (a 4×4 board is too small for
+ * EXPERT). A pool whose generation fails a full round of attempts is
+ * marked unreachable: GETs on it fail immediately, and workers leave it
+ * alone until its retry time. Each further failed round doubles the
+ * delay (POOL_RETRY_MIN_MS up to POOL_RETRY_MAX_MS); a success clears it.
+ */
+
+#ifndef SUDOKUD_POOL_H
+#define SUDOKUD_POOL_H
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "sudoku/core/types.h"
+
+/**
+ * @brief Ready puzzles of one size and difficulty
+ */
+typedef struct {
+    int subgrid_size;
+    SudokuDifficulty difficulty;
+    int cells;                  ///< Bytes per puzzle (board_size²)
+    int capacity;               ///< Puzzles the ring holds
+    uint8_t *slots;             ///< capacity × cells bytes
+    int head;                   ///< Oldest puzzle
+    int count;                  ///< Puzzles available
+    int in_flight;              ///< Puzzles being generated for this pool
+    int waiters;                ///< GETs parked until this pool refills
+    bool unreachable;           ///< Last round failed; retried at retry_at_ns
+    uint64_t retry_at_ns;       ///< CLOCK_MONOTONIC time of the next attempt
+    int retry_delay_ms;         ///< Delay after the next failed round
+
+    uint64_t served;            ///< Puzzles handed out
+    uint64_t generated;         ///< Puzzles added by the generator threads
+    uint64_t misses;            ///< GETs that found the pool short and waited
+    uint64_t failures;          ///< Rounds of attempts that produced nothing
+} PuzzlePool;
+
+/**
+ * @brief All pools plus the threads that refill them
+ */
+typedef struct {
+    PuzzlePool *pools;
+    int pool_count;
+
+    pthread_mutex_t lock;       ///< Guards every pool
+    pthread_cond_t need_work;   ///< Signalled when a pool has room
+    bool stopping;
+    int wake_pipe[2];           ///< Written when a pool with waiters changes
+    SudokuCancelToken *cancel;  ///< Interrupts in-flight generations on stop
+
+    pthread_t *workers;
+    int worker_count;
+} PoolSet;
+
+/**
+ * @brief Create one pool per size × difficulty and start the workers
+ *
+ * @param sizes Subgrid sizes to serve
+ * @param size_count Entries in @p sizes
+ * @param capacity Puzzles per pool
+ * @param workers Generator threads (at least 1)
+ * @return false on allocation or thread creation failure
+ */
+bool poolset_start(PoolSet *set, const int *sizes, int size_count,
+                   int capacity, int workers);
+
+/**
+ * @brief Stop the workers (interrupting their generations) and free everything
+ */
+void poolset_stop(PoolSet *set);
+
+/**
+ * @brief Pool of a size and difficulty, or NULL if not served
+ */
+PuzzlePool* poolset_find(PoolSet *set, int subgrid_size, int difficulty);
+
+/**
+ * @brief Copy up to @p count ready puzzles into @p out
+ *
+ * Never generates: a short result means the caller should wait (see
+ * poolset_wait()) unless @p unreachable is set.
+ *
+ * @param out count × pool->cells bytes
+ * @param[out] unreachable Whether the pool is failing (may be NULL)
+ * @return Puzzles written
+ */
+int poolset_take(PoolSet *set, PuzzlePool *pool, uint8_t *out, int count,
+                 bool *unreachable);
+
+/**
+ * @brief Register (+1) or drop (-1) a GET waiting on @p pool
+ *
+ * While a pool has waiters, every puzzle added to it and every failed
+ * round writes to poolset_wake_fd().
+ */
+void poolset_wait(PoolSet *set, PuzzlePool *pool, int delta);
+
+/**
+ * @brief Read end of the wake-up pipe, for poll()
+ */
+int poolset_wake_fd(const PoolSet *set);
+
+/**
+ * @brief Empty the wake-up pipe after poll() reported it readable
+ */
+void poolset_drain_wake(PoolSet *set);
+
+/**
+ * @brief Render levels and counters as "key value" lines
+ *
+ * @return Bytes written (truncated to @p capacity)
+ */
+size_t poolset_format_stats(PoolSet *set, char *buffer, size_t capacity);
+
+#endif // SUDOKUD_POOL_H
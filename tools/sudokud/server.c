@@ -0,0 +1,395 @@
+/**
+ * @file server.c
+ * @brief Client handling and poll() loop of sudokud
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * See server.h.
+ */
+
+#define _GNU_SOURCE     // accept4(), SOCK_NONBLOCK
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include "server.h"
+
+// ═══════════════════════════════════════════════════════════════════
+//                    OUTPUT BUFFERS
+// ═══════════════════════════════════════════════════════════════════
+
+static size_t client_pending(const Client *c) {
+    return c->out_len - c->out_sent;
+}
+
+/**
+ * @brief Reserve @p bytes at the end of the client's output buffer
+ *
+ * @return Pointer to the reserved space, or NULL on allocation failure
+ */
+static uint8_t* client_reserve(Client *c, size_t bytes) {
+    if (c->out_sent > 0) {
+        // Drop what the socket already took
+        memmove(c->out, c->out + c->out_sent, client_pending(c));
+        c->out_len -= c->out_sent;
+        c->out_sent = 0;
+    }
+    if (c->out_len + bytes > c->out_capacity) {
+        size_t capacity = c->out_capacity ? c->out_capacity : 4096;
+        while (capacity < c->out_len + bytes) {
+            capacity *= 2;
+        }
+        uint8_t *grown = realloc(c->out, capacity);
+        if (grown == NULL) {
+            return NULL;
+        }
+        c->out = grown;
+        c->out_capacity = capacity;
+    }
+    uint8_t *p = c->out + c->out_len;
+    c->out_len += bytes;
+    return p;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    PARKED GETS
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Forget the client's parked GET and its puzzles
+ */
+static void unpark(Client *c, PoolSet *pools) {
+    if (c->parked != NULL) {
+        poolset_wait(pools, c->parked, -1);
+    }
+    free(c->parked_puzzles);
+    c->parked = NULL;
+    c->parked_puzzles = NULL;
+    c->parked_taken = 0;
+}
+
+/**
+ * @brief Take more puzzles for the parked GET; reply once it is settled
+ *
+ * The GET is settled when it has all its puzzles (SUDOKUD_OK) or its
+ * pool is unreachable (SUDOKUD_FAILED with what was taken).
+ *
+ * @return false if the reply could not be buffered (client is dropped)
+ */
+static bool resume_parked(Client *c, PoolSet *pools) {
+    PuzzlePool *pool = c->parked;
+    const SudokudRequest *req = &c->parked_request;
+    int wanted = (int)req->count;
+    bool unreachable;
+
+    c->parked_taken += poolset_take(pools, pool,
+                                    c->parked_puzzles + (size_t)c->parked_taken * pool->cells,
+                                    wanted - c->parked_taken, &unreachable);
+    if (c->parked_taken < wanted && !unreachable) {
+        return true;    // Keep waiting
+    }
+
+    SudokudReplyHeader header = {
+        .type = req->type,
+        .status = (c->parked_taken == wanted) ? SUDOKUD_OK : SUDOKUD_FAILED,
+        .subgrid_size = req->subgrid_size,
+        .difficulty = req->difficulty,
+        .count = (uint32_t)c->parked_taken,
+        .payload_size = (uint32_t)c->parked_taken * (uint32_t)pool->cells
+    };
+    uint8_t *p = client_reserve(c, SUDOKUD_REPLY_HEADER_SIZE + header.payload_size);
+    if (p == NULL) {
+        return false;
+    }
+    sudokud_encode_reply(p, &header);
+    memcpy(p + SUDOKUD_REPLY_HEADER_SIZE, c->parked_puzzles, header.payload_size);
+    unpark(c, pools);
+    return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    REQUEST HANDLING
+// ═══════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Answer a valid GET, or park it if its pool is short
+ *
+ * @return false if the reply could not be buffered (client is dropped)
+ */
+static bool handle_get(Client *c, const SudokudRequest *req, PuzzlePool *pool,
+                       PoolSet *pools, SudokudReplyHeader *header) {
+    // Header and payload are written in place; the header is filled
+    // once the served count is known
+    size_t payload = (size_t)req->count * pool->cells;
+    uint8_t *p = client_reserve(c, SUDOKUD_REPLY_HEADER_SIZE + payload);
+    if (p == NULL) {
+        return false;
+    }
+    bool unreachable;
+    int taken = poolset_take(pools, pool, p + SUDOKUD_REPLY_HEADER_SIZE,
+                             (int)req->count, &unreachable);
+
+    if ((uint32_t)taken == req->count || unreachable) {
+        header->count = (uint32_t)taken;
+        header->payload_size = (uint32_t)taken * (uint32_t)pool->cells;
+        if ((uint32_t)taken < req->count) {
+            header->status = SUDOKUD_FAILED;
+            c->out_len -= payload - header->payload_size;
+        }
+        sudokud_encode_reply(p, header);
+        return true;
+    }
+
+    // Short pool: move what we got aside and wait for the workers
+    c->parked_puzzles = malloc(payload);
+    if (c->parked_puzzles == NULL) {
+        return false;
+    }
+    memcpy(c->parked_puzzles, p + SUDOKUD_REPLY_HEADER_SIZE, (size_t)taken * pool->cells);
+    c->out_len -= SUDOKUD_REPLY_HEADER_SIZE + payload;
+    c->parked = pool;
+    c->parked_request = *req;
+    c->parked_taken = taken;
+    poolset_wait(pools, pool, +1);
+
+    // Puzzles added before the wait was registered woke nobody
+    return resume_parked(c, pools);
+}
+
+/**
+ * @brief Queue the reply to one request
+ *
+ * @return false if the reply could not be buffered (client is dropped)
+ */
+static bool handle_request(Client *c, const SudokudRequest *req,
+                           PoolSet *pools, ServerStats *stats) {
+    SudokudReplyHeader header = {
+        .type = req->type,
+        .status = SUDOKUD_OK,
+        .subgrid_size = req->subgrid_size,
+        .difficulty = req->difficulty
+    };
+    stats->requests++;
+
+    if (req->type == SUDOKUD_REQ_GET) {
+        PuzzlePool *pool = poolset_find(pools, req->subgrid_size, req->difficulty);
+        if (pool == NULL || req->count == 0 || req->count > SUDOKUD_MAX_COUNT) {
+            header.status = SUDOKUD_BAD_REQUEST;
+        } else {
+            return handle_get(c, req, pool, pools, &header);
+        }
+    } else if (req->type == SUDOKUD_REQ_STATS) {
+        char text[SUDOKUD_STATS_CAPACITY];
+        int written = snprintf(text, sizeof(text),
+                               "uptime_seconds %lld\nconnections %llu\n"
+                               "requests %llu\nbad_requests %llu\n",
+                               (long long)(time(NULL) - stats->started),
+                               (unsigned long long)stats->connections,
+                               (unsigned long long)stats->requests,
+                               (unsigned long long)stats->bad_requests);
+        size_t used = (written > 0) ? (size_t)written : 0;
+        used += poolset_format_stats(pools, text + used, sizeof(text) - used);
+
+        uint8_t *p = client_reserve(c, SUDOKUD_REPLY_HEADER_SIZE + used);
+        if (p == NULL) {
+            return false;
+        }
+        header.payload_size = (uint32_t)used;
+        sudokud_encode_reply(p, &header);
+        memcpy(p + SUDOKUD_REPLY_HEADER_SIZE, text, used);
+        return true;
+    } else if (req->type != SUDOKUD_REQ_PING) {
+        header.status = SUDOKUD_BAD_REQUEST;
+    }
+
+    if (header.status == SUDOKUD_BAD_REQUEST) {
+        stats->bad_requests++;
+    }
+    uint8_t *p = client_reserve(c, SUDOKUD_REPLY_HEADER_SIZE);
+    if (p == NULL) {
+        return false;
+    }
+    sudokud_encode_reply(p, &header);
+    return true;
+}
+
+/**
+ * @brief Answer every complete request in the input buffer, in order
+ *
+ * Stops early while the client has too many unsent bytes or a parked
+ * GET; the rest of the input stays buffered until then.
+ */
+static bool process_input(Client *c, PoolSet *pools, ServerStats *stats) {
+    size_t offset = 0;
+    while (c->parked == NULL && c->in_len - offset >= SUDOKUD_REQUEST_SIZE &&
+           client_pending(c) < SUDOKUD_MAX_PENDING) {
+        SudokudRequest req;
+        sudokud_decode_request(c->in + offset, &req);
+        offset += SUDOKUD_REQUEST_SIZE;
+        if (!handle_request(c, &req, pools, stats)) {
+            return false;
+        }
+    }
+    memmove(c->in, c->in + offset, c->in_len - offset);
+    c->in_len -= offset;
+    return true;
+}
+
+/**
+ * @brief Write as much pending output as the socket accepts
+ *
+ * @return false if the connection is broken
+ */
+static bool flush_output(Client *c) {
+    while (client_pending(c) > 0) {
+        ssize_t n = send(c->fd, c->out + c->out_sent, client_pending(c), MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        c->out_sent += (size_t)n;
+    }
+    return true;
+}
+
+/**
+ * @brief Answer buffered requests and send, until blocked on either side
+ */
+static bool service_client(Client *c, PoolSet *pools, ServerStats *stats) {
+    do {
+        if (c->parked != NULL && !resume_parked(c, pools)) {
+            return false;
+        }
+        if (!process_input(c, pools, stats) || !flush_output(c)) {
+            return false;
+        }
+    } while (c->parked == NULL && c->in_len >= SUDOKUD_REQUEST_SIZE &&
+             client_pending(c) < SUDOKUD_MAX_PENDING);
+    return true;
+}
+
+static void client_close(Client *c, PoolSet *pools) {
+    unpark(c, pools);
+    close(c->fd);
+    free(c->out);
+    memset(c, 0, sizeof(*c));
+    c->fd = -1;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+//                    SERVER
+// ═══════════════════════════════════════════════════════════════════
+
+void server_init(SudokudServer *server, PoolSet *pools, int listener) {
+    memset(server, 0, sizeof(*server));
+    server->pools = pools;
+    server->listener = listener;
+    server->stats.started = time(NULL);
+    for (int i = 0; i < SUDOKUD_MAX_CLIENTS; i++) {
+        server->clients[i].fd = -1;
+    }
+}
+
+bool server_add_client(SudokudServer *server, int fd) {
+    for (int i = 0; i < SUDOKUD_MAX_CLIENTS; i++) {
+        if (server->clients[i].fd < 0) {
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+            server->clients[i].fd = fd;
+            server->stats.connections++;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void accept_clients(SudokudServer *server) {
+    for (;;) {
+        int fd = accept4(server->listener, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            return;     // EAGAIN: backlog drained
+        }
+        if (!server_add_client(server, fd)) {
+            close(fd);
+        }
+    }
+}
+
+bool server_poll(SudokudServer *server, int timeout_ms) {
+    struct pollfd fds[SUDOKUD_MAX_CLIENTS + 2];
+    int owners[SUDOKUD_MAX_CLIENTS + 2];
+    int nfds = 0;
+
+    fds[nfds++] = (struct pollfd){ .fd = poolset_wake_fd(server->pools), .events = POLLIN };
+    fds[nfds++] = (struct pollfd){ .fd = server->listener, .events = POLLIN };  // -1 is ignored
+    int first_client = nfds;
+    for (int i = 0; i < SUDOKUD_MAX_CLIENTS; i++) {
+        Client *c = &server->clients[i];
+        if (c->fd < 0) {
+            continue;
+        }
+        short events = 0;
+        if (c->in_len < sizeof(c->in)) {
+            events |= POLLIN;
+        }
+        if (client_pending(c) > 0) {
+            events |= POLLOUT;
+        }
+        owners[nfds] = i;
+        fds[nfds++] = (struct pollfd){ .fd = c->fd, .events = events };
+    }
+
+    if (poll(fds, (nfds_t)nfds, timeout_ms) < 0) {
+        if (errno == EINTR) {
+            return true;
+        }
+        perror("sudokud: poll");
+        return false;
+    }
+
+    if (fds[0].revents & POLLIN) {
+        poolset_drain_wake(server->pools);
+    }
+    if (fds[1].revents & POLLIN) {
+        accept_clients(server);
+    }
+
+    for (int f = first_client; f < nfds; f++) {
+        Client *c = &server->clients[owners[f]];
+        bool alive = true;
+
+        if (fds[f].revents & POLLIN) {
+            ssize_t n = recv(c->fd, c->in + c->in_len, sizeof(c->in) - c->in_len, 0);
+            if (n > 0) {
+                c->in_len += (size_t)n;
+            } else if (n == 0 || (errno != EAGAIN && errno != EINTR)) {
+                alive = false;
+            }
+        } else if (fds[f].revents & (POLLERR | POLLHUP)) {
+            alive = false;
+        }
+
+        // Requests held back by backpressure or a parked GET are
+        // answered here too, once the client or the pool catches up
+        alive = alive && service_client(c, server->pools, &server->stats);
+        if (!alive) {
+            client_close(c, server->pools);
+        }
+    }
+    return true;
+}
+
+void server_close(SudokudServer *server) {
+    for (int i = 0; i < SUDOKUD_MAX_CLIENTS; i++) {
+        if (server->clients[i].fd >= 0) {
+            client_close(&server->clients[i], server->pools);
+        }
+    }
+}
@@ -0,0 +1,104 @@
+/**
+ * @file server.h
+ * @brief Client handling and poll() loop of sudokud
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * The server is a single poll() loop: every client has an input buffer
+ * that may hold several pipelined requests, and an output buffer that
+ * collects their replies in order. Requests stop being parsed while a
+ * client has more than SUDOKUD_MAX_PENDING bytes of unsent replies, so
+ * a client that never reads cannot make the daemon grow without bound.
+ *
+ * A GET that finds its pool short is parked on the client: the puzzles
+ * already taken are kept aside, the client's later requests wait, and
+ * the loop keeps serving everyone else. The pool's wake-up pipe
+ * (poolset_wake_fd()) is polled too, so the parked GET is completed as
+ * soon as the generator threads add puzzles, or answered with
+ * SUDOKUD_FAILED and what it got if the pool turns out unreachable.
+ * The wire format is documented in sudokud_protocol.h.
+ */
+
+#ifndef SUDOKUD_SERVER_H
+#define SUDOKUD_SERVER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+#include "pool.h"
+#include "sudokud_protocol.h"
+
+/** @brief Connected clients served at once */
+#define SUDOKUD_MAX_CLIENTS 64
+
+/** @brief Unsent reply bytes above which a client's requests wait */
+#define SUDOKUD_MAX_PENDING (1u << 20)
+
+/** @brief Size of the STATS text buffer */
+#define SUDOKUD_STATS_CAPACITY 4096
+
+/**
+ * @brief One connection and its buffers
+ */
+typedef struct {
+    int fd;                     ///< -1 = free slot
+    uint8_t in[SUDOKUD_REQUEST_SIZE * 64];
+    size_t in_len;
+    uint8_t *out;
+    size_t out_len;             ///< Bytes queued
+    size_t out_sent;            ///< Bytes of out already written
+    size_t out_capacity;
+
+    PuzzlePool *parked;         ///< Pool a GET waits on (NULL = none)
+    SudokudRequest parked_request;
+    uint8_t *parked_puzzles;    ///< count × cells bytes, parked_taken filled
+    int parked_taken;
+} Client;
+
+typedef struct {
+    time_t started;
+    uint64_t connections;
+    uint64_t requests;
+    uint64_t bad_requests;
+} ServerStats;
+
+/**
+ * @brief Listener, clients and the pools they are served from
+ */
+typedef struct {
+    PoolSet *pools;
+    int listener;               ///< Listening socket (-1 = none)
+    Client clients[SUDOKUD_MAX_CLIENTS];
+    ServerStats stats;
+} SudokudServer;
+
+/**
+ * @brief Prepare a server with no clients
+ *
+ * @param listener Non-blocking listening socket, or -1 to serve only
+ *                 clients added with server_add_client()
+ */
+void server_init(SudokudServer *server, PoolSet *pools, int listener);
+
+/**
+ * @brief Serve an already connected socket (made non-blocking here)
+ *
+ * @return false if every client slot is taken (@p fd is not closed)
+ */
+bool server_add_client(SudokudServer *server, int fd);
+
+/**
+ * @brief Wait for activity once and serve everything that is ready
+ *
+ * @param timeout_ms poll() timeout (-1 = until something happens)
+ * @return false if poll() failed (EINTR is not a failure)
+ */
+bool server_poll(SudokudServer *server, int timeout_ms);
+
+/**
+ * @brief Close every client (the listener belongs to the caller)
+ */
+void server_close(SudokudServer *server);
+
+#endif // SUDOKUD_SERVER_H
@@ -0,0 +1,131 @@
+/**
+ * @file sudokud_protocol.h
+ * @brief Wire format of the sudokud Unix-socket protocol
+ * @author Gonzalo Ramírez
+ * @date 2026-10-16
+ *
+ * Clients send fixed 8-byte requests and may send several before
+ * reading anything (pipelining); replies come back in request order,
+ * each a 12-byte header followed by its payload. All multi-byte fields
+ * are little-endian.
+ *
+ * REQUEST (8 bytes):
+ *
+ *   offset  size  field
+ *   0       1     type          SUDOKUD_REQ_GET / _STATS / _PING
+ *   1       1     subgrid_size  2 = 4×4, 3 = 9×9, ... (GET only)
+ *   2       1     difficulty    SudokuDifficulty value (GET only)
+ *   3       1     reserved      0
+ *   4       4     count         puzzles wanted, 1..SUDOKUD_MAX_COUNT (GET only)
+ *
+ * REPLY HEADER (12 bytes):
+ *
+ *   0       1     type          echoed from the request
+ *   1       1     status        SUDOKUD_OK / _BAD_REQUEST / _FAILED
+ *   2       1     subgrid_size  echoed
+ *   3       1     difficulty    echoed
+ *   4       4     count         puzzles in the payload (GET)
+ *   8       4     payload_size  bytes that follow the header
+ *
+ * PAYLOADS:
+ * - GET: count puzzles of board_size² bytes each, row-major, one byte
+ *   per cell (0 = empty). One reply carries the whole batch.
+ * - STATS: UTF-8 text, one "key value" pair per line
+ * - PING and every error reply: none
+ */
+
+#ifndef SUDOKUD_PROTOCOL_H
+#define SUDOKUD_PROTOCOL_H
+
+#include <stdint.h>
+
+/** @brief Socket path used when -S is not given */
+#define SUDOKUD_DEFAULT_SOCKET "/tmp/sudokud.sock"
+
+#define SUDOKUD_REQUEST_SIZE 8
+#define SUDOKUD_REPLY_HEADER_SIZE 12
+
+/** @brief Largest batch one GET may ask for */
+#define SUDOKUD_MAX_COUNT 1024
+
+/** @brief Request types */
+enum {
+    SUDOKUD_REQ_GET = 1,        ///< Take puzzles from a pool
+    SUDOKUD_REQ_STATS = 2,      ///< Pool levels and counters, as text
+    SUDOKUD_REQ_PING = 3        ///< Empty OK reply
+};
+
+/** @brief Reply status codes */
+enum {
+    SUDOKUD_OK = 0,
+    SUDOKUD_BAD_REQUEST = 1,    ///< Unknown type, no such pool or bad count
+    SUDOKUD_FAILED = 2          ///< Generation failed; count holds what was served
+};
+
+/**
+ * @brief Decoded request
+ */
+typedef struct {
+    uint8_t type;
+    uint8_t subgrid_size;
+    uint8_t difficulty;
+    uint32_t count;
+} SudokudRequest;
+
+/**
+ * @brief Decoded reply header
+ */
+typedef struct {
+    uint8_t type;
+    uint8_t status;
+    uint8_t subgrid_size;
+    uint8_t difficulty;
+    uint32_t count;
+    uint32_t payload_size;
+} SudokudReplyHeader;
+
+static inline void sudokud_put_u32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static inline uint32_t sudokud_get_u32(const uint8_t *p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static inline void sudokud_encode_request(uint8_t *p, const SudokudRequest *req) {
+    p[0] = req->type;
+    p[1] = req->subgrid_size;
+    p[2] = req->difficulty;
+    p[3] = 0;
+    sudokud_put_u32(p + 4, req->count);
+}
+
+static inline void sudokud_decode_request(const uint8_t *p, SudokudRequest *req) {
+    req->type = p[0];
+    req->subgrid_size = p[1];
+    req->difficulty = p[2];
+    req->count = sudokud_get_u32(p + 4);
+}
+
+static inline void sudokud_encode_reply(uint8_t *p, const SudokudReplyHeader *h) {
+    p[0] = h->type;
+    p[1] = h->status;
+    p[2] = h->subgrid_size;
+    p[3] = h->difficulty;
+    sudokud_put_u32(p + 4, h->count);
+    sudokud_put_u32(p + 8, h->payload_size);
+}
+
+static inline void sudokud_decode_reply(const uint8_t *p, SudokudReplyHeader *h) {
+    h->type = p[0];
+    h->status = p[1];
+    h->subgrid_size = p[2];
+    h->difficulty = p[3];
+    h->count = sudokud_get_u32(p + 4);
+    h->payload_size = sudokud_get_u32(p + 8);
+}
+
+#endif // SUDOKUD_PROTOCOL_H